@@ -18,12 +18,36 @@
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>  // malloc
+#include <string.h>
 
+#include <algorithm>
 #include <atomic>
 #include <limits>
+#include <thread>
+#include <vector>
 
 #include "hwy/base.h"
 
+#if HWY_ALLOCATION_STATS
+#include <mutex>  // NOLINT
+#include <unordered_map>
+#if HWY_COMPILER_MSVC
+#include <intrin.h>
+#define HWY_ALLOCATION_CALLER _ReturnAddress()
+#else
+#define HWY_ALLOCATION_CALLER __builtin_return_address(0)
+#endif
+#endif  // HWY_ALLOCATION_STATS
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#define HWY_ALLOCATOR_HAVE_MMAP 1
+#else
+#define HWY_ALLOCATOR_HAVE_MMAP 0
+#endif
+
 namespace hwy {
 namespace {
 
@@ -60,8 +84,286 @@ size_t NextAlignedOffset() {
   return offset;
 }
 
+// Used if the AllocPtr/FreePtr passed to AllocateAlignedBytes etc. are null.
+AllocPtr default_alloc_ptr = nullptr;
+FreePtr default_free_ptr = nullptr;
+void* default_opaque_ptr = nullptr;
+
+void* AllocateRaw(size_t size, AllocPtr alloc_ptr, void* opaque_ptr) {
+  if (alloc_ptr == nullptr) {
+    if (default_alloc_ptr == nullptr) return malloc(size);
+    return (*default_alloc_ptr)(default_opaque_ptr, size);
+  }
+  return (*alloc_ptr)(opaque_ptr, size);
+}
+
+void FreeRaw(void* allocated, FreePtr free_ptr, void* opaque_ptr) {
+  if (free_ptr == nullptr) {
+    if (default_free_ptr == nullptr) {
+      free(allocated);
+    } else {
+      (*default_free_ptr)(default_opaque_ptr, allocated);
+    }
+    return;
+  }
+  (*free_ptr)(opaque_ptr, allocated);
+}
+
+// Precedes the memory returned by PolicyAlloc, which is kAlignment bytes after
+// `mapping`. mapped_bytes == 0 indicates `mapping` is from malloc.
+struct PolicyHeader {
+  void* mapping;
+  size_t mapped_bytes;
+};
+static_assert(sizeof(PolicyHeader) <= kAlignment, "Header does not fit");
+
+// Writes to one byte per page so that the OS backs [begin, begin + bytes) with
+// physical memory. Each thread handles a contiguous range, which is then also
+// placed on its node if there is no NUMA policy.
+void Prefault(uint8_t* begin, size_t bytes, size_t page_bytes,
+              size_t num_threads) {
+  const size_t num_pages = (bytes + page_bytes - 1) / page_bytes;
+  num_threads = HWY_MIN(HWY_MAX(num_threads, size_t{1}), num_pages);
+  const auto touch = [=](size_t first_page, size_t end_page) {
+    for (size_t page = first_page; page < end_page; ++page) {
+      reinterpret_cast<volatile uint8_t*>(begin)[page * page_bytes] = 0;
+    }
+  };
+  if (num_threads <= 1) {
+    touch(0, num_pages);
+    return;
+  }
+
+  const size_t pages_per_thread = (num_pages + num_threads - 1) / num_threads;
+  std::vector<std::thread> threads;
+  threads.reserve(num_threads);
+  for (size_t first = 0; first < num_pages; first += pages_per_thread) {
+    threads.emplace_back(touch, first,
+                         HWY_MIN(first + pages_per_thread, num_pages));
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+}
+
+#if HWY_ALLOCATOR_HAVE_MMAP
+
+constexpr size_t kHugePageBytes = size_t{2} << 20;
+
+size_t RoundUpTo(size_t bytes, size_t multiple) {
+  return (bytes + multiple - 1) / multiple * multiple;
+}
+
+bool NeedsMapping(const AllocationPolicy& policy) {
+  return policy.pages != AllocationPolicy::Pages::kDefault ||
+         policy.numa != AllocationPolicy::Numa::kDefault;
+}
+
+// Returns the start of a mapping of at least `bytes` according to `policy` and
+// stores its size in `mapped_bytes` and its page size in `page_bytes`, or
+// returns nullptr if the OS refuses.
+void* MapPages(const AllocationPolicy& policy, size_t bytes,
+               size_t* mapped_bytes, size_t* page_bytes) {
+  constexpr int kProt = PROT_READ | PROT_WRITE;
+  constexpr int kFlags = MAP_PRIVATE | MAP_ANONYMOUS;
+
+#ifdef MAP_HUGETLB
+  if (policy.pages == AllocationPolicy::Pages::kExplicitHuge) {
+    // Requires pages reserved via /proc/sys/vm/nr_hugepages; else falls back.
+    const size_t size = RoundUpTo(bytes, kHugePageBytes);
+    void* mapping = mmap(nullptr, size, kProt, kFlags | MAP_HUGETLB, -1, 0);
+    if (mapping != MAP_FAILED) {
+      *mapped_bytes = size;
+      *page_bytes = kHugePageBytes;
+      return mapping;
+    }
+  }
+#endif
+
+  const size_t small_page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  if (policy.pages == AllocationPolicy::Pages::kDefault) {
+    const size_t size = RoundUpTo(bytes, small_page);
+    void* mapping = mmap(nullptr, size, kProt, kFlags, -1, 0);
+    if (mapping == MAP_FAILED) return nullptr;
+    *mapped_bytes = size;
+    *page_bytes = small_page;
+    return mapping;
+  }
+
+  // Transparent huge pages are only used for 2 MiB-aligned ranges, so map
+  // extra and unmap the misaligned head and the tail.
+  const size_t size = RoundUpTo(bytes, kHugePageBytes);
+  const size_t padded_size = size + kHugePageBytes;
+  void* padded = mmap(nullptr, padded_size, kProt, kFlags, -1, 0);
+  if (padded == MAP_FAILED) return nullptr;
+  const uintptr_t begin = reinterpret_cast<uintptr_t>(padded);
+  const uintptr_t aligned = RoundUpTo(begin, kHugePageBytes);
+  if (aligned != begin) {
+    munmap(padded, aligned - begin);
+  }
+  const size_t tail = begin + padded_size - (aligned + size);
+  if (tail != 0) {
+    munmap(reinterpret_cast<void*>(aligned + size), tail);
+  }
+  void* mapping = reinterpret_cast<void*>(aligned);
+#ifdef MADV_HUGEPAGE
+  madvise(mapping, size, MADV_HUGEPAGE);  // only a hint; ignore errors
+#endif
+  *mapped_bytes = size;
+  *page_bytes = small_page;  // huge pages are not guaranteed
+  return mapping;
+}
+
+// Best effort: NUMA may be unavailable (e.g. ENOSYS) or nodes invalid.
+void ApplyNumaPolicy(const AllocationPolicy& policy, void* mapping,
+                     size_t mapped_bytes) {
+#ifdef SYS_mbind
+  // From <linux/mempolicy.h>, which may not be installed.
+  constexpr int kModeBind = 2;
+  constexpr int kModeInterleave = 3;
+  int mode;
+  switch (policy.numa) {
+    case AllocationPolicy::Numa::kBind:
+      mode = kModeBind;
+      break;
+    case AllocationPolicy::Numa::kInterleave:
+      mode = kModeInterleave;
+      break;
+    default:
+      return;
+  }
+  const unsigned long node_mask = static_cast<unsigned long>(policy.numa_nodes);
+  const unsigned long max_node = sizeof(node_mask) * 8;
+  (void)syscall(SYS_mbind, mapping, mapped_bytes, mode, &node_mask, max_node,
+                0u);
+#else
+  (void)policy;
+  (void)mapping;
+  (void)mapped_bytes;
+#endif
+}
+
+#endif  // HWY_ALLOCATOR_HAVE_MMAP
+
+#if HWY_ALLOCATION_STATS
+
+// Static storage => zero-initialized before any allocation.
+std::atomic<uint64_t> live_bytes;
+std::atomic<uint64_t> peak_bytes;
+std::atomic<uint64_t> num_allocations;
+std::atomic<uint64_t> num_frees;
+std::atomic<uint64_t> allocated_bytes;
+std::atomic<uint64_t> allocations_by_size[AllocationStats::kNumBuckets];
+
+std::atomic<bool> track_sites{false};
+
+struct Sites {
+  std::mutex mutex;
+  std::unordered_map<const void*, AllocationSite> map;
+};
+
+// Never destroyed because allocations may happen during static destruction.
+Sites& GetSites() {
+  static Sites* sites = new Sites;
+  return *sites;
+}
+
+size_t SizeBucket(size_t payload_size) {
+  size_t bucket = 0;
+  while (bucket + 1 < AllocationStats::kNumBuckets &&
+         (payload_size >> (bucket + 1)) != 0) {
+    ++bucket;
+  }
+  return bucket;
+}
+
+void RecordAllocation(size_t payload_size, const void* caller) {
+  const uint64_t live =
+      live_bytes.fetch_add(payload_size, std::memory_order_relaxed) +
+      payload_size;
+  uint64_t peak = peak_bytes.load(std::memory_order_relaxed);
+  while (live > peak && !peak_bytes.compare_exchange_weak(peak, live)) {
+  }
+  num_allocations.fetch_add(1, std::memory_order_relaxed);
+  allocated_bytes.fetch_add(payload_size, std::memory_order_relaxed);
+  allocations_by_size[SizeBucket(payload_size)].fetch_add(
+      1, std::memory_order_relaxed);
+
+  if (HWY_UNLIKELY(track_sites.load(std::memory_order_relaxed))) {
+    Sites& sites = GetSites();
+    std::lock_guard<std::mutex> lock(sites.mutex);
+    AllocationSite& site = sites.map[caller];
+    site.return_address = caller;
+    site.num_allocations += 1;
+    site.allocated_bytes += payload_size;
+  }
+}
+
+void RecordFree(size_t payload_size, FreePtr free_ptr) {
+  // Arena memory is not individually allocated.
+  if (free_ptr == &AlignedFreer::DoNothing) return;
+  live_bytes.fetch_sub(payload_size, std::memory_order_relaxed);
+  num_frees.fetch_add(1, std::memory_order_relaxed);
+}
+
+#endif  // HWY_ALLOCATION_STATS
+
 }  // namespace
 
+void SetDefaultAllocator(AllocPtr alloc_ptr, FreePtr free_ptr,
+                         void* opaque_ptr) {
+  default_alloc_ptr = alloc_ptr;
+  default_free_ptr = free_ptr;
+  default_opaque_ptr = opaque_ptr;
+}
+
+void* PolicyAlloc(void* opaque_policy, size_t bytes) {
+  const AllocationPolicy& policy =
+      *static_cast<const AllocationPolicy*>(opaque_policy);
+  const size_t total = kAlignment + bytes;
+
+  uint8_t* mapping = nullptr;
+  size_t mapped_bytes = 0;
+  size_t page_bytes = 4096;
+#if HWY_ALLOCATOR_HAVE_MMAP
+  if (NeedsMapping(policy)) {
+    mapping = static_cast<uint8_t*>(
+        MapPages(policy, total, &mapped_bytes, &page_bytes));
+    if (mapping != nullptr) {
+      ApplyNumaPolicy(policy, mapping, mapped_bytes);
+    }
+  }
+#endif
+  if (mapping == nullptr) {
+    mapped_bytes = 0;
+    mapping = static_cast<uint8_t*>(malloc(total));
+    if (mapping == nullptr) return nullptr;
+  }
+
+  if (policy.prefault_threads != 0) {
+    Prefault(mapping, total, page_bytes, policy.prefault_threads);
+  }
+
+  PolicyHeader* header = reinterpret_cast<PolicyHeader*>(mapping);
+  header->mapping = mapping;
+  header->mapped_bytes = mapped_bytes;
+  return mapping + kAlignment;
+}
+
+void PolicyFree(void* opaque_policy, void* memory) {
+  (void)opaque_policy;
+  if (memory == nullptr) return;
+  const PolicyHeader* header = reinterpret_cast<const PolicyHeader*>(
+      static_cast<uint8_t*>(memory) - kAlignment);
+  if (header->mapped_bytes == 0) {
+    free(header->mapping);
+    return;
+  }
+#if HWY_ALLOCATOR_HAVE_MMAP
+  munmap(header->mapping, header->mapped_bytes);
+#endif
+}
+
 void* AllocateAlignedBytes(const size_t payload_size, AllocPtr alloc_ptr,
                            void* opaque_ptr) {
   HWY_ASSERT(payload_size != 0);  // likely a bug in caller
@@ -84,12 +386,7 @@ void* AllocateAlignedBytes(const size_t payload_size, AllocPtr alloc_ptr,
   }
 
   const size_t allocated_size = kAlias + offset + payload_size;
-  void* allocated;
-  if (alloc_ptr == nullptr) {
-    allocated = malloc(allocated_size);
-  } else {
-    allocated = (*alloc_ptr)(opaque_ptr, allocated_size);
-  }
+  void* allocated = AllocateRaw(allocated_size, alloc_ptr, opaque_ptr);
   if (allocated == nullptr) return nullptr;
   // Always round up even if already aligned - we already asked for kAlias
   // extra bytes and there's no way to give them back.
@@ -106,6 +403,9 @@ void* AllocateAlignedBytes(const size_t payload_size, AllocPtr alloc_ptr,
   header->allocated = allocated;
   header->payload_size = payload_size;
 
+#if HWY_ALLOCATION_STATS
+  RecordAllocation(payload_size, HWY_ALLOCATION_CALLER);
+#endif
   return HWY_ASSUME_ALIGNED(reinterpret_cast<void*>(payload), kAlignment);
 }
 
@@ -118,13 +418,77 @@ void FreeAlignedBytes(const void* aligned_pointer, FreePtr free_ptr,
   const AllocationHeader* header =
       reinterpret_cast<const AllocationHeader*>(payload) - 1;
 
-  if (free_ptr == nullptr) {
-    free(header->allocated);
-  } else {
-    (*free_ptr)(opaque_ptr, header->allocated);
+#if HWY_ALLOCATION_STATS
+  RecordFree(header->payload_size, free_ptr);
+#endif
+  FreeRaw(header->allocated, free_ptr, opaque_ptr);
+}
+
+Arena::Arena(size_t block_bytes, AllocPtr alloc_ptr, FreePtr free_ptr,
+             void* opaque_ptr)
+    : block_bytes_(block_bytes),
+      alloc_ptr_(alloc_ptr),
+      free_ptr_(free_ptr),
+      opaque_ptr_(opaque_ptr) {}
+
+Arena::~Arena() {
+  for (const Block& block : blocks_) {
+    FreeAlignedBytes(block.begin, free_ptr_, opaque_ptr_);
   }
 }
 
+void* Arena::AllocateBytes(const size_t payload_size) {
+  HWY_ASSERT(payload_size != 0);  // likely a bug in caller
+  if (payload_size >= std::numeric_limits<size_t>::max() / 2) {
+    HWY_DASSERT(false && "payload_size too large");
+    return nullptr;
+  }
+
+  // As in AllocateAlignedBytes, the payload is preceded by an unused area
+  // ending with the AllocationHeader (for FreeAlignedBytes) and cycles between
+  // kAlias / kAlignment offsets. Because the area is nonempty, buffers whose
+  // sizes are multiples of 4 KiB are also staggered.
+  constexpr size_t kGroups = kAlias / kAlignment;
+  const size_t offset = kAlignment * (1 + num_allocations_ % kGroups);
+  const size_t needed = offset + payload_size;
+
+  // Skip blocks that are too small; they remain unused until Reset.
+  while (current_ < blocks_.size() &&
+         used_ + needed > blocks_[current_].size) {
+    ++current_;
+    used_ = 0;
+  }
+  if (current_ == blocks_.size()) {
+    const size_t size = HWY_MAX(block_bytes_, kAlias + payload_size);
+    void* begin = AllocateAlignedBytes(size, alloc_ptr_, opaque_ptr_);
+    if (begin == nullptr) return nullptr;
+    blocks_.push_back(Block{static_cast<uint8_t*>(begin), size});
+    used_ = 0;
+  }
+
+  uint8_t* payload = blocks_[current_].begin + used_ + offset;
+  used_ += (needed + kAlignment - 1) & ~(kAlignment - 1);
+  ++num_allocations_;
+
+  AllocationHeader* header = reinterpret_cast<AllocationHeader*>(payload) - 1;
+  header->allocated = payload;
+  header->payload_size = payload_size;
+  return HWY_ASSUME_ALIGNED(static_cast<void*>(payload), kAlignment);
+}
+
+void Arena::Reset() {
+  current_ = 0;
+  used_ = 0;
+}
+
+size_t Arena::CapacityBytes() const {
+  size_t total = 0;
+  for (const Block& block : blocks_) {
+    total += block.size;
+  }
+  return total;
+}
+
 // static
 void AlignedDeleter::DeleteAlignedArray(void* aligned_pointer, FreePtr free_ptr,
                                         void* opaque_ptr,
@@ -140,10 +504,94 @@ void AlignedDeleter::DeleteAlignedArray(void* aligned_pointer, FreePtr free_ptr,
     (*deleter)(aligned_pointer, header->payload_size);
   }
 
-  if (free_ptr == nullptr) {
-    free(header->allocated);
-  } else {
-    (*free_ptr)(opaque_ptr, header->allocated);
+#if HWY_ALLOCATION_STATS
+  RecordFree(header->payload_size, free_ptr);
+#endif
+  FreeRaw(header->allocated, free_ptr, opaque_ptr);
+}
+
+constexpr size_t AllocationStats::kNumBuckets;
+
+AllocationStats GetAllocationStats() {
+  AllocationStats stats = {};
+#if HWY_ALLOCATION_STATS
+  stats.live_bytes = live_bytes.load(std::memory_order_relaxed);
+  stats.peak_bytes = peak_bytes.load(std::memory_order_relaxed);
+  stats.num_allocations = num_allocations.load(std::memory_order_relaxed);
+  stats.num_frees = num_frees.load(std::memory_order_relaxed);
+  stats.allocated_bytes = allocated_bytes.load(std::memory_order_relaxed);
+  for (size_t i = 0; i < AllocationStats::kNumBuckets; ++i) {
+    stats.allocations_by_size[i] =
+        allocations_by_size[i].load(std::memory_order_relaxed);
+  }
+#endif
+  return stats;
+}
+
+void ResetAllocationStats() {
+#if HWY_ALLOCATION_STATS
+  peak_bytes.store(live_bytes.load(std::memory_order_relaxed),
+                   std::memory_order_relaxed);
+  num_allocations.store(0, std::memory_order_relaxed);
+  num_frees.store(0, std::memory_order_relaxed);
+  allocated_bytes.store(0, std::memory_order_relaxed);
+  for (std::atomic<uint64_t>& count : allocations_by_size) {
+    count.store(0, std::memory_order_relaxed);
+  }
+  Sites& sites = GetSites();
+  std::lock_guard<std::mutex> lock(sites.mutex);
+  sites.map.clear();
+#endif
+}
+
+void SetAllocationSiteTracking(bool enabled) {
+#if HWY_ALLOCATION_STATS
+  track_sites.store(enabled, std::memory_order_relaxed);
+#else
+  (void)enabled;
+#endif
+}
+
+std::vector<AllocationSite> GetAllocationSites() {
+  std::vector<AllocationSite> result;
+#if HWY_ALLOCATION_STATS
+  {
+    Sites& sites = GetSites();
+    std::lock_guard<std::mutex> lock(sites.mutex);
+    result.reserve(sites.map.size());
+    for (const auto& site : sites.map) {
+      result.push_back(site.second);
+    }
+  }
+  std::sort(result.begin(), result.end(),
+            [](const AllocationSite& a, const AllocationSite& b) {
+              return a.num_allocations > b.num_allocations;
+            });
+#endif
+  return result;
+}
+
+void PrintAllocationStats(FILE* f, size_t max_sites) {
+  const AllocationStats stats = GetAllocationStats();
+  fprintf(f, "Allocations: %llu, frees: %llu, bytes: %llu\n",
+          static_cast<unsigned long long>(stats.num_allocations),
+          static_cast<unsigned long long>(stats.num_frees),
+          static_cast<unsigned long long>(stats.allocated_bytes));
+  fprintf(f, "Live bytes: %llu, peak: %llu\n",
+          static_cast<unsigned long long>(stats.live_bytes),
+          static_cast<unsigned long long>(stats.peak_bytes));
+  for (size_t i = 0; i < AllocationStats::kNumBuckets; ++i) {
+    if (stats.allocations_by_size[i] == 0) continue;
+    fprintf(f, "  [2^%2zu, 2^%2zu): %12llu\n", i, i + 1,
+            static_cast<unsigned long long>(stats.allocations_by_size[i]));
+  }
+
+  const std::vector<AllocationSite> sites = GetAllocationSites();
+  for (size_t i = 0; i < sites.size() && i < max_sites; ++i) {
+    fprintf(f, "  %p: %12llu allocations, %14llu bytes\n",
+            sites[i].return_address,
+            static_cast<unsigned long long>(sites[i].num_allocations),
+            static_cast<unsigned long long>(sites[i].allocated_bytes));
   }
 }
 
@@ -18,7 +18,11 @@
 // Memory allocator with support for alignment and offsets.
 
 #include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
 #include <memory>
+#include <vector>
 
 namespace hwy {
 
@@ -46,6 +50,45 @@ void* AllocateAlignedBytes(size_t payload_size, AllocPtr alloc_ptr,
 void FreeAlignedBytes(const void* aligned_pointer, FreePtr free_ptr,
                       void* opaque_ptr);
 
+// Replaces malloc/free as the functions called by AllocateAlignedBytes and
+// FreeAlignedBytes if their `alloc_ptr`/`free_ptr` are null, e.g. to apply an
+// AllocationPolicy to all allocations. Passing null restores malloc/free.
+// Not thread-safe, and must not be called while any memory obtained via the
+// previous defaults is still allocated.
+void SetDefaultAllocator(AllocPtr alloc_ptr, FreePtr free_ptr,
+                         void* opaque_ptr);
+
+// Options for obtaining memory directly from the OS, which helps reduce TLB
+// misses and cross-socket traffic for large (multi-MiB) buffers. To use, pass
+// PolicyAlloc, PolicyFree and a pointer to the policy as the `alloc`, `free`
+// and `opaque` arguments of the functions below, or to SetDefaultAllocator.
+// The policy must outlive the allocations. Options not supported by the
+// platform (currently all except on Linux) or denied by the OS are ignored.
+struct AllocationPolicy {
+  enum class Pages {
+    kDefault,          // malloc unless other options are set
+    kTransparentHuge,  // 2 MiB-aligned mmap plus madvise(MADV_HUGEPAGE)
+    kExplicitHuge,     // mmap(MAP_HUGETLB), else as for kTransparentHuge
+  };
+  enum class Numa {
+    kDefault,     // first touch
+    kBind,        // only on `numa_nodes`
+    kInterleave,  // page-wise round robin across `numa_nodes`
+  };
+
+  Pages pages = Pages::kDefault;
+  Numa numa = Numa::kDefault;
+  uint64_t numa_nodes = 1;  // bit i selects node i
+
+  // If nonzero, this many threads write to every page before the allocation
+  // returns, so that page faults are not incurred later.
+  size_t prefault_threads = 0;
+};
+
+// AllocPtr and FreePtr for an `opaque` pointer to AllocationPolicy.
+void* PolicyAlloc(void* opaque_policy, size_t bytes);
+void PolicyFree(void* opaque_policy, void* memory);
+
 // Class that deletes the aligned pointer passed to operator() calling the
 // destructor before freeing the pointer. This is equivalent to the
 // std::default_delete but for aligned objects. For a similar deleter equivalent
@@ -202,5 +245,110 @@ AlignedFreeUniquePtr<T[]> AllocateAligned(const size_t items) {
   return AllocateAligned<T>(items, nullptr, nullptr, nullptr);
 }
 
+// Bump allocator for scratch buffers whose lifetimes end together, e.g. per
+// request. Sub-buffers are carved from blocks obtained via
+// AllocateAlignedBytes; each is aligned and, as with AllocateAlignedBytes,
+// offset so that successive buffers are not congruent modulo 4 KiB. Memory is
+// only reclaimed by Reset or the destructor. Not thread-safe.
+class Arena {
+ public:
+  // Blocks have at least `block_bytes`; larger requests get their own block.
+  explicit Arena(size_t block_bytes = size_t{1} << 20,
+                 AllocPtr alloc_ptr = nullptr, FreePtr free_ptr = nullptr,
+                 void* opaque_ptr = nullptr);
+  ~Arena();
+
+  Arena(const Arena&) = delete;
+  Arena& operator=(const Arena&) = delete;
+
+  // Returns uninitialized memory that remains valid until Reset or the
+  // destructor, or nullptr if allocation failed. The pointer may also be
+  // passed to FreeAlignedBytes together with AlignedFreer::DoNothing.
+  void* AllocateBytes(size_t payload_size);
+
+  // Returns a handle to uninitialized POD items whose deleter does nothing,
+  // which must not be used after Reset or the destructor.
+  template <typename T>
+  AlignedFreeUniquePtr<T[]> Allocate(size_t items) {
+    const size_t bytes = items * sizeof(T);
+    T* ptr = (bytes / sizeof(T) == items)  // else overflowed
+                 ? static_cast<T*>(AllocateBytes(bytes))
+                 : nullptr;
+    return AlignedFreeUniquePtr<T[]>(
+        ptr, AlignedFreer(&AlignedFreer::DoNothing, nullptr));
+  }
+
+  // Invalidates all prior allocations. Their blocks are reused rather than
+  // freed, so subsequent allocations of similar total size are a pointer bump.
+  void Reset();
+
+  // Total size of all blocks obtained so far.
+  size_t CapacityBytes() const;
+
+ private:
+  struct Block {
+    uint8_t* begin;
+    size_t size;
+  };
+
+  const size_t block_bytes_;
+  const AllocPtr alloc_ptr_;
+  const FreePtr free_ptr_;
+  void* const opaque_ptr_;
+
+  std::vector<Block> blocks_;
+  size_t current_ = 0;  // index of the block to allocate from
+  size_t used_ = 0;     // bytes of blocks_[current_] already used
+  size_t num_allocations_ = 0;
+};
+
+// Optional statistics about AllocateAlignedBytes and FreeAlignedBytes (and
+// thus all of the above), for finding the allocations that dominate the
+// allocation rate or memory usage. Enabled by compiling the library with
+// HWY_ALLOCATION_STATS=1, e.g. via the CMake option of the same name.
+// Otherwise, allocation has no overhead and the functions below report zeros.
+#ifndef HWY_ALLOCATION_STATS
+#define HWY_ALLOCATION_STATS 0
+#endif
+
+struct AllocationStats {
+  // Bucket i counts allocations with payload_size in [2^i, 2^(i+1)).
+  static constexpr size_t kNumBuckets = 64;
+
+  uint64_t live_bytes;  // allocated and not yet freed
+  uint64_t peak_bytes;  // maximum of live_bytes since the last reset
+  uint64_t num_allocations;
+  uint64_t num_frees;
+  uint64_t allocated_bytes;  // sum of all payload_size
+  uint64_t allocations_by_size[kNumBuckets];
+};
+
+// Counts allocations from one call site, identified by the return address of
+// the call to AllocateAlignedBytes. In optimized builds, the templates above
+// are typically inlined, so this points into their caller.
+struct AllocationSite {
+  const void* return_address;
+  uint64_t num_allocations;
+  uint64_t allocated_bytes;
+};
+
+// Returns a snapshot of the counters. Thread-safe.
+AllocationStats GetAllocationStats();
+
+// Zeros all counters and sites except live_bytes; peak_bytes restarts from
+// live_bytes.
+void ResetAllocationStats();
+
+// Per-site counting requires a lock and is thus disabled by default.
+void SetAllocationSiteTracking(bool enabled);
+
+// Returns the sites recorded while tracking was enabled, most allocations
+// first.
+std::vector<AllocationSite> GetAllocationSites();
+
+// Writes the counters, non-empty size buckets and up to `max_sites` sites.
+// Addresses can be converted to source locations via e.g. addr2line.
+void PrintAllocationStats(FILE* f, size_t max_sites = 20);
+
 }  // namespace hwy
 #endif  // HIGHWAY_HWY_ALIGNED_ALLOCATOR_H_
@@ -15,6 +15,7 @@
 #include "hwy/aligned_allocator.h"
 
 #include <stddef.h>
+#include <string.h>
 
 #include <array>
 #include <new>
@@ -275,6 +276,176 @@ TEST(AlignedAllocatorTest, DefaultInit) {
             (addr2 >> (kBits - 1)) >> (kBits - 1));
 }
 
+TEST(AlignedAllocatorTest, Policies) {
+  using Pages = AllocationPolicy::Pages;
+  using Numa = AllocationPolicy::Numa;
+  // Larger than a huge page, and not a multiple of one.
+  const size_t kSize = (size_t{5} << 20) + 123;
+  for (Pages pages : {Pages::kDefault, Pages::kTransparentHuge,
+                      Pages::kExplicitHuge}) {
+    for (Numa numa : {Numa::kDefault, Numa::kBind, Numa::kInterleave}) {
+      for (size_t prefault_threads : {size_t{0}, size_t{3}}) {
+        AllocationPolicy policy;
+        policy.pages = pages;
+        policy.numa = numa;
+        policy.numa_nodes = 1;  // node 0 always exists
+        policy.prefault_threads = prefault_threads;
+        auto ptr = AllocateAligned<uint8_t>(kSize, &PolicyAlloc, &PolicyFree,
+                                            &policy);
+        ASSERT_TRUE(ptr != nullptr);
+        EXPECT_EQ(0U, reinterpret_cast<uintptr_t>(ptr.get()) % HWY_ALIGNMENT);
+        memset(ptr.get(), 0xAB, kSize);
+        EXPECT_EQ(0xAB, ptr[kSize - 1]);
+      }
+    }
+  }
+}
+
+TEST(AlignedAllocatorTest, DefaultAllocator) {
+  FakeAllocator fake_alloc;
+  SetDefaultAllocator(&FakeAllocator::StaticAlloc, &FakeAllocator::StaticFree,
+                      &fake_alloc);
+  {
+    auto ptr = AllocateAligned<int>(100);
+    auto arr = MakeUniqueAlignedArray<SampleObject<24>>(3);
+    EXPECT_EQ(2U, fake_alloc.PendingAllocs());
+  }
+  EXPECT_EQ(0U, fake_alloc.PendingAllocs());
+
+  // Explicit AllocPtr take precedence.
+  FakeAllocator other_alloc;
+  void* ptr = AllocateAlignedBytes(100, &FakeAllocator::StaticAlloc,
+                                   &other_alloc);
+  EXPECT_EQ(0U, fake_alloc.PendingAllocs());
+  EXPECT_EQ(1U, other_alloc.PendingAllocs());
+  FreeAlignedBytes(ptr, &FakeAllocator::StaticFree, &other_alloc);
+
+  SetDefaultAllocator(nullptr, nullptr, nullptr);
+  AllocateAligned<int>(100);
+  EXPECT_EQ(0U, fake_alloc.PendingAllocs());
+}
+
+TEST(AlignedAllocatorTest, Arena) {
+  Arena arena(16384);
+  std::vector<uint8_t*> ptrs;
+  std::vector<size_t> sizes;
+  for (size_t i = 0; i < 100; ++i) {
+    const size_t bytes = 1 + (i * 997) % 3000;
+    uint8_t* ptr = static_cast<uint8_t*>(arena.AllocateBytes(bytes));
+    ASSERT_NE(nullptr, ptr);
+    EXPECT_EQ(0U, reinterpret_cast<uintptr_t>(ptr) % HWY_ALIGNMENT);
+    memset(ptr, static_cast<int>(i), bytes);
+    ptrs.push_back(ptr);
+    sizes.push_back(bytes);
+  }
+  // No overlap.
+  for (size_t i = 0; i < ptrs.size(); ++i) {
+    for (size_t j = 0; j < sizes[i]; ++j) {
+      ASSERT_EQ(static_cast<uint8_t>(i), ptrs[i][j]);
+    }
+  }
+
+  // Freeing via the no-op deleter is allowed.
+  FreeAlignedBytes(ptrs[0], &AlignedFreer::DoNothing, nullptr);
+
+  // Reuses the same blocks after Reset.
+  const size_t capacity = arena.CapacityBytes();
+  arena.Reset();
+  EXPECT_EQ(ptrs[0], arena.AllocateBytes(sizes[0]));
+  EXPECT_EQ(capacity, arena.CapacityBytes());
+
+  // Larger than a block.
+  uint8_t* large = static_cast<uint8_t*>(arena.AllocateBytes(100000));
+  ASSERT_NE(nullptr, large);
+  memset(large, 0xAB, 100000);
+  EXPECT_LT(capacity, arena.CapacityBytes());
+}
+
+TEST(AlignedAllocatorTest, ArenaStaggered) {
+  Arena arena;
+  const size_t kSize = 4096;
+  uintptr_t prev = 0;
+  for (size_t i = 0; i < 16; ++i) {
+    auto ptr = arena.Allocate<float>(kSize / sizeof(float));
+    const uintptr_t address = reinterpret_cast<uintptr_t>(ptr.get());
+    if (i != 0) {
+      EXPECT_NE(prev % 4096, address % 4096);
+    }
+    prev = address;
+  }
+}
+
+TEST(AlignedAllocatorTest, ArenaCustomAlloc) {
+  FakeAllocator fake_alloc;
+  {
+    Arena arena(4096, &FakeAllocator::StaticAlloc, &FakeAllocator::StaticFree,
+                &fake_alloc);
+    // Unique pointers do not free anything.
+    {
+      auto ptr1 = arena.Allocate<uint32_t>(100);
+      auto ptr2 = arena.Allocate<uint32_t>(100);
+      EXPECT_EQ(1U, fake_alloc.PendingAllocs());
+    }
+    EXPECT_EQ(1U, fake_alloc.PendingAllocs());
+    arena.Allocate<uint32_t>(1000);
+    EXPECT_EQ(2U, fake_alloc.PendingAllocs());
+    arena.Reset();
+    arena.Allocate<uint32_t>(100);
+    EXPECT_EQ(2U, fake_alloc.PendingAllocs());
+    EXPECT_EQ(nullptr, arena.Allocate<uint64_t>(~size_t{0} / 4).get());
+  }
+  EXPECT_EQ(0U, fake_alloc.PendingAllocs());
+}
+
+TEST(AlignedAllocatorTest, AllocationStats) {
+  ResetAllocationStats();
+  SetAllocationSiteTracking(true);
+  const uint64_t live_before = GetAllocationStats().live_bytes;
+  {
+    auto ptr1 = AllocateAligned<uint8_t>(1000);
+    auto ptr2 = AllocateAligned<uint8_t>(3000);
+    const AllocationStats stats = GetAllocationStats();
+    if (HWY_ALLOCATION_STATS) {
+      EXPECT_EQ(2U, stats.num_allocations);
+      EXPECT_EQ(0U, stats.num_frees);
+      EXPECT_EQ(4000U, stats.allocated_bytes);
+      EXPECT_EQ(live_before + 4000, stats.live_bytes);
+      EXPECT_EQ(stats.live_bytes, stats.peak_bytes);
+      EXPECT_EQ(1U, stats.allocations_by_size[9]);   // [512, 1024)
+      EXPECT_EQ(1U, stats.allocations_by_size[11]);  // [2048, 4096)
+    } else {
+      EXPECT_EQ(0U, stats.num_allocations);
+    }
+  }
+  AllocationStats stats = GetAllocationStats();
+  EXPECT_EQ(live_before, stats.live_bytes);
+  EXPECT_EQ(HWY_ALLOCATION_STATS ? 2U : 0U, stats.num_frees);
+
+  // Only the arena's block counts, not its sub-buffers.
+  {
+    Arena arena(8192);
+    arena.Allocate<float>(100);
+    arena.Allocate<float>(100);
+  }
+  stats = GetAllocationStats();
+  EXPECT_EQ(HWY_ALLOCATION_STATS ? 3U : 0U, stats.num_allocations);
+  EXPECT_EQ(HWY_ALLOCATION_STATS ? 3U : 0U, stats.num_frees);
+  EXPECT_EQ(live_before, stats.live_bytes);
+
+  const std::vector<AllocationSite> sites = GetAllocationSites();
+  uint64_t site_allocations = 0;
+  for (const AllocationSite& site : sites) {
+    EXPECT_NE(nullptr, site.return_address);
+    site_allocations += site.num_allocations;
+  }
+  EXPECT_EQ(stats.num_allocations, site_allocations);
+
+  SetAllocationSiteTracking(false);
+  ResetAllocationStats();
+  EXPECT_EQ(0U, GetAllocationStats().num_allocations);
+  EXPECT_TRUE(GetAllocationSites().empty());
+}
+
 }  // namespace hwy
 
 // Ought not to be necessary, but without this, no tests run on RVV.
@@ -0,0 +1,199 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef HIGHWAY_HWY_ALIGNED_VECTOR_H_
+#define HIGHWAY_HWY_ALIGNED_VECTOR_H_
+
+// Resizable array whose storage is aligned and padded to whole vectors, so
+// that loops can process full vectors without a scalar remainder.
+
+#include <stddef.h>
+#include <string.h>
+
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
+
+#include "hwy/aligned_allocator.h"
+#include "hwy/base.h"
+
+namespace hwy {
+
+// Upper bound on the size of HWY_FULL vectors of all targets for the current
+// architecture. aligned_vector_test verifies this for the compiled targets.
+#if HWY_ARCH_X86
+static constexpr size_t kPaddedVectorBytes = 64;  // AVX-512
+#elif HWY_ARCH_ARM
+static constexpr size_t kPaddedVectorBytes = 256;  // SVE: at most 2048 bits
+#elif HWY_ARCH_RVV
+// HWY_FULL is LMUL=1. The spec allows VLEN up to 64 Kibit, but using that as
+// the bound would add up to 8 KiB of padding to every vector. Precondition:
+// VLEN is at most 2048 bits. Otherwise, whole-vector loops over padded_size()
+// would access memory beyond the padding; kernels may check this via
+// HWY_DASSERT(Lanes(d) <= AlignedVector<T>::kLanes).
+static constexpr size_t kPaddedVectorBytes = 256;
+#else
+static constexpr size_t kPaddedVectorBytes = 16;  // 128-bit (WASM, PPC)
+#endif
+
+// Similar to std::vector<T> for trivial T, but the storage is aligned to
+// HWY_ALIGNMENT and its capacity is a multiple of kLanes, the number of T in
+// the largest vector. The elements in [size(), padded_size()) are zero, so
+// kernels may load and store full vectors of all padded_size() elements; stores
+// to the padding are allowed, but the next operation that changes size() may
+// reset them to zero. Iterators and pointers are invalidated by reallocation.
+template <typename T>
+class AlignedVector {
+  static_assert(std::is_trivial<T>::value, "Only for trivial types");
+
+ public:
+  using value_type = T;
+  using iterator = T*;
+  using const_iterator = const T*;
+
+  static constexpr size_t kLanes = HWY_MAX(kPaddedVectorBytes / sizeof(T), 1);
+
+  AlignedVector() = default;
+  // Value-initializes (zeros) all elements.
+  explicit AlignedVector(size_t size) { resize(size); }
+  AlignedVector(size_t size, const T& value) { resize(size, value); }
+  AlignedVector(std::initializer_list<T> values) {
+    resize_uninitialized(values.size());
+    if (values.size() != 0) {
+      memcpy(data_, values.begin(), values.size() * sizeof(T));
+    }
+  }
+
+  AlignedVector(const AlignedVector& other) { *this = other; }
+  AlignedVector& operator=(const AlignedVector& other) {
+    if (this != &other) {
+      resize_uninitialized(other.size_);
+      if (size_ != 0) memcpy(data_, other.data_, size_ * sizeof(T));
+    }
+    return *this;
+  }
+
+  AlignedVector(AlignedVector&& other) noexcept { swap(other); }
+  AlignedVector& operator=(AlignedVector&& other) noexcept {
+    swap(other);
+    return *this;
+  }
+
+  ~AlignedVector() { FreeAlignedBytes(data_, nullptr, nullptr); }
+
+  void swap(AlignedVector& other) noexcept {
+    std::swap(data_, other.data_);
+    std::swap(size_, other.size_);
+    std::swap(capacity_, other.capacity_);
+  }
+
+  size_t size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+  size_t capacity() const { return capacity_; }
+
+  // Returns size() rounded up to a multiple of kLanes. Elements up to this
+  // index may be accessed via data().
+  size_t padded_size() const { return RoundUp(size_); }
+
+  T* data() { return data_; }
+  const T* data() const { return data_; }
+
+  T& operator[](size_t i) { return data_[i]; }
+  const T& operator[](size_t i) const { return data_[i]; }
+  T& front() { return data_[0]; }
+  const T& front() const { return data_[0]; }
+  T& back() { return data_[size_ - 1]; }
+  const T& back() const { return data_[size_ - 1]; }
+
+  iterator begin() { return data_; }
+  iterator end() { return data_ + size_; }
+  const_iterator begin() const { return data_; }
+  const_iterator end() const { return data_ + size_; }
+
+  // Ensures capacity() >= n without changing size().
+  void reserve(size_t n) {
+    if (n > capacity_) Reallocate(RoundUp(n));
+  }
+
+  // New elements are value-initialized (zero).
+  void resize(size_t n) {
+    const size_t old_size = size_;
+    resize_uninitialized(n);
+    if (n > old_size) ZeroRange(old_size, n);
+  }
+
+  void resize(size_t n, const T& value) {
+    const size_t old_size = size_;
+    resize_uninitialized(n);
+    for (size_t i = old_size; i < n; ++i) {
+      data_[i] = value;
+    }
+  }
+
+  // Same as resize, but new elements are left uninitialized, which avoids the
+  // cost of zeroing if they are about to be overwritten. Padding is still
+  // zeroed.
+  void resize_uninitialized(size_t n) {
+    if (n > capacity_) Grow(n);
+    size_ = n;
+    // At most kLanes - 1 elements, which may previously have been data.
+    ZeroRange(n, padded_size());
+  }
+
+  void push_back(const T& value) {
+    if (size_ == capacity_) Grow(size_ + 1);
+    // The slot is padding and thus already zero, unless it starts a new vector.
+    if (size_ % kLanes == 0) ZeroRange(size_, size_ + kLanes);
+    data_[size_++] = value;
+  }
+
+  void pop_back() { data_[--size_] = T(); }
+
+  void clear() { resize_uninitialized(0); }
+
+ private:
+  static size_t RoundUp(size_t n) { return (n + kLanes - 1) / kLanes * kLanes; }
+
+  void ZeroRange(size_t begin, size_t end) {
+    if (end > begin) memset(data_ + begin, 0, (end - begin) * sizeof(T));
+  }
+
+  // Amortized doubling.
+  void Grow(size_t min_capacity) {
+    Reallocate(RoundUp(HWY_MAX(min_capacity, 2 * capacity_)));
+  }
+
+  // Copies size() elements and their padding to new storage.
+  void Reallocate(size_t capacity) {
+    HWY_DASSERT(capacity % kLanes == 0 && capacity >= padded_size());
+    T* data = static_cast<T*>(
+        AllocateAlignedBytes(capacity * sizeof(T), nullptr, nullptr));
+    HWY_ASSERT(data != nullptr);
+    if (size_ != 0) memcpy(data, data_, padded_size() * sizeof(T));
+    FreeAlignedBytes(data_, nullptr, nullptr);
+    data_ = data;
+    capacity_ = capacity;
+  }
+
+  T* data_ = nullptr;
+  size_t size_ = 0;
+  size_t capacity_ = 0;  // multiple of kLanes
+};
+
+template <typename T>
+constexpr size_t AlignedVector<T>::kLanes;
+
+}  // namespace hwy
+
+#endif  // HIGHWAY_HWY_ALIGNED_VECTOR_H_
@@ -0,0 +1,188 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "hwy/aligned_vector.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <utility>
+
+#undef HWY_TARGET_INCLUDE
+#define HWY_TARGET_INCLUDE "hwy/aligned_vector_test.cc"
+#include "hwy/foreach_target.h"
+
+#include "hwy/highway.h"
+#include "hwy/tests/test_util-inl.h"
+
+HWY_BEFORE_NAMESPACE();
+namespace hwy {
+namespace HWY_NAMESPACE {
+
+// Whole vectors of this target fit into the padding.
+struct TestPaddedLanes {
+  template <typename T>
+  void operator()(T /*unused*/) const {
+    const HWY_FULL(T) d;
+    // Fails on RVV with VLEN > 2048 bits, see kPaddedVectorBytes.
+    HWY_ASSERT(Lanes(d) * sizeof(T) <= kPaddedVectorBytes);
+    HWY_ASSERT(Lanes(d) <= AlignedVector<T>::kLanes);
+    HWY_ASSERT(AlignedVector<T>::kLanes % Lanes(d) == 0);
+  }
+};
+
+HWY_NOINLINE void TestAllPaddedLanes() { ForAllTypes(TestPaddedLanes()); }
+
+// Processes whole vectors only; relies on zero padding.
+float SumPadded(const AlignedVector<float>& v) {
+  const HWY_FULL(float) d;
+  HWY_ASSERT(Lanes(d) <= AlignedVector<float>::kLanes);
+  auto sum = Zero(d);
+  for (size_t i = 0; i < v.padded_size(); i += Lanes(d)) {
+    sum += Load(d, v.data() + i);
+  }
+  return GetLane(SumOfLanes(d, sum));
+}
+
+HWY_NOINLINE void TestFullVectors() {
+  AlignedVector<float> v;
+  float expected = 0.0f;
+  for (size_t i = 0; i < 37; ++i) {
+    v.push_back(1.0f);
+    expected += 1.0f;
+    HWY_ASSERT_EQ(expected, SumPadded(v));
+  }
+  v.resize(5);
+  HWY_ASSERT_EQ(5.0f, SumPadded(v));
+}
+
+// NOLINTNEXTLINE(google-readability-namespace-comments)
+}  // namespace HWY_NAMESPACE
+}  // namespace hwy
+HWY_AFTER_NAMESPACE();
+
+#if HWY_ONCE
+
+namespace hwy {
+HWY_BEFORE_TEST(AlignedVectorTargetTest);
+HWY_EXPORT_AND_TEST_P(AlignedVectorTargetTest, TestAllPaddedLanes);
+HWY_EXPORT_AND_TEST_P(AlignedVectorTargetTest, TestFullVectors);
+
+namespace {
+
+template <typename T>
+void CheckInvariants(const AlignedVector<T>& v) {
+  EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(v.data()) % HWY_ALIGNMENT);
+  EXPECT_EQ(0u, v.padded_size() % AlignedVector<T>::kLanes);
+  EXPECT_EQ(0u, v.capacity() % AlignedVector<T>::kLanes);
+  EXPECT_LE(v.size(), v.padded_size());
+  EXPECT_LE(v.padded_size(), v.capacity());
+  EXPECT_LT(v.padded_size() - v.size(), AlignedVector<T>::kLanes);
+  for (size_t i = v.size(); i < v.padded_size(); ++i) {
+    EXPECT_EQ(T(0), v.data()[i]) << i;
+  }
+}
+
+TEST(AlignedVectorTest, Empty) {
+  AlignedVector<float> v;
+  EXPECT_TRUE(v.empty());
+  EXPECT_EQ(0u, v.padded_size());
+  EXPECT_EQ(v.begin(), v.end());
+  v.reserve(0);
+  v.clear();
+  EXPECT_EQ(0u, v.capacity());
+}
+
+TEST(AlignedVectorTest, Resize) {
+  AlignedVector<int32_t> v(3);
+  CheckInvariants(v);
+  EXPECT_EQ(3u, v.size());
+  EXPECT_EQ(0, v[2]);
+
+  v.resize(5, 7);
+  CheckInvariants(v);
+  EXPECT_EQ(0, v[2]);
+  EXPECT_EQ(7, v[3]);
+  EXPECT_EQ(7, v.back());
+
+  // Shrinking zeroes the elements that become padding.
+  v.resize(1);
+  CheckInvariants(v);
+
+  // Growing across several vectors preserves the contents.
+  v[0] = 42;
+  v.resize_uninitialized(1000);
+  CheckInvariants(v);
+  EXPECT_EQ(42, v.front());
+  for (size_t i = 1; i < v.size(); ++i) {
+    v[i] = static_cast<int32_t>(i);
+  }
+  v.resize(2000);
+  CheckInvariants(v);
+  EXPECT_EQ(999, v[999]);
+  EXPECT_EQ(0, v[1000]);
+}
+
+TEST(AlignedVectorTest, PushPop) {
+  AlignedVector<uint8_t> v;
+  for (size_t i = 0; i < 300; ++i) {
+    v.push_back(static_cast<uint8_t>(i + 1));
+    CheckInvariants(v);
+  }
+  size_t i = 0;
+  for (uint8_t x : v) {
+    EXPECT_EQ(static_cast<uint8_t>(i + 1), x);
+    ++i;
+  }
+  EXPECT_EQ(300u, i);
+  while (!v.empty()) {
+    v.pop_back();
+    CheckInvariants(v);
+  }
+}
+
+TEST(AlignedVectorTest, CopyMove) {
+  AlignedVector<double> v = {1.0, 2.0, 3.0};
+  CheckInvariants(v);
+  AlignedVector<double> copy(v);
+  CheckInvariants(copy);
+  EXPECT_NE(v.data(), copy.data());
+  EXPECT_EQ(3.0, copy[2]);
+
+  copy.resize(100);
+  copy = v;
+  EXPECT_EQ(3u, copy.size());
+  CheckInvariants(copy);
+
+  const double* data = v.data();
+  AlignedVector<double> moved(std::move(v));
+  EXPECT_EQ(data, moved.data());
+  EXPECT_EQ(3u, moved.size());
+
+  AlignedVector<double> assigned;
+  assigned = std::move(moved);
+  EXPECT_EQ(data, assigned.data());
+  EXPECT_EQ(2.0, assigned[1]);
+}
+
+}  // namespace
+}  // namespace hwy
+
+// Ought not to be necessary, but without this, no tests run on RVV.
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
+
+#endif
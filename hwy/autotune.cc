@@ -0,0 +1,148 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "hwy/autotune.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <map>
+#include <mutex>  // NOLINT
+#include <set>
+#include <string>
+
+namespace hwy {
+namespace {
+
+// Key -> HWY_* target. Only accessed during the first call of each autotuned
+// function and when saving/loading, hence a simple mutex suffices.
+struct TunedTargets {
+  std::mutex mutex;
+  std::map<std::string, uint32_t> targets;
+  std::set<std::string> registered_keys;
+  AutotuneParams params;
+};
+
+// Longest key accepted by RegisterAutotunedKey and LoadTunedTargets.
+constexpr size_t kMaxKeyLength = 255;
+
+TunedTargets& GetTunedTargets() {
+  static TunedTargets* tuned = new TunedTargets;  // never freed
+  return *tuned;
+}
+
+}  // namespace
+
+uint32_t GetTunedTarget(const char* key) {
+  TunedTargets& tuned = GetTunedTargets();
+  std::lock_guard<std::mutex> lock(tuned.mutex);
+  const auto it = tuned.targets.find(key);
+  return it == tuned.targets.end() ? 0 : it->second;
+}
+
+void SetTunedTarget(const char* key, uint32_t target) {
+  TunedTargets& tuned = GetTunedTargets();
+  std::lock_guard<std::mutex> lock(tuned.mutex);
+  tuned.targets[key] = target;
+}
+
+bool RegisterAutotunedKey(const char* key) {
+  const size_t length = strlen(key);
+  // Keys are written as whitespace-separated tokens by SaveTunedTargets.
+  if (length == 0 || length > kMaxKeyLength ||
+      strpbrk(key, " \t\n\v\f\r") != nullptr) {
+    return false;
+  }
+  TunedTargets& tuned = GetTunedTargets();
+  std::lock_guard<std::mutex> lock(tuned.mutex);
+  return tuned.registered_keys.insert(key).second;
+}
+
+void ClearTunedTargets() {
+  TunedTargets& tuned = GetTunedTargets();
+  std::lock_guard<std::mutex> lock(tuned.mutex);
+  tuned.targets.clear();
+}
+
+void SetAutotuneParams(const AutotuneParams& params) {
+  TunedTargets& tuned = GetTunedTargets();
+  std::lock_guard<std::mutex> lock(tuned.mutex);
+  tuned.params = params;
+}
+
+AutotuneParams GetAutotuneParams() {
+  TunedTargets& tuned = GetTunedTargets();
+  std::lock_guard<std::mutex> lock(tuned.mutex);
+  return tuned.params;
+}
+
+uint32_t TargetFromName(const char* target_name) {
+  for (uint32_t bit = 0; bit < 32; ++bit) {
+    const uint32_t target = 1u << bit;
+    if (strcmp(TargetName(target), "Unknown") != 0 &&
+        strcmp(TargetName(target), target_name) == 0) {
+      return target;
+    }
+  }
+  return 0;
+}
+
+bool SaveTunedTargets(const char* path) {
+  FILE* f = fopen(path, "w");
+  if (f == nullptr) return false;
+  bool ok = fprintf(f, "cpu %s\n", GetCpuInfo().model) >= 0;
+  {
+    TunedTargets& tuned = GetTunedTargets();
+    std::lock_guard<std::mutex> lock(tuned.mutex);
+    for (const auto& name_target : tuned.targets) {
+      if (fprintf(f, "%s %s\n", name_target.first.c_str(),
+                  TargetName(name_target.second)) < 0) {
+        ok = false;
+      }
+    }
+  }
+  if (fclose(f) != 0) ok = false;
+  return ok;
+}
+
+bool LoadTunedTargets(const char* path) {
+  FILE* f = fopen(path, "r");
+  if (f == nullptr) return false;
+
+  // Decisions from another CPU model (e.g. a copied file) are not applicable.
+  char line[sizeof(CpuInfo::model) + 8];
+  const std::string expected = std::string("cpu ") + GetCpuInfo().model;
+  if (fgets(line, sizeof(line), f) == nullptr) {
+    fclose(f);
+    return false;
+  }
+  line[strcspn(line, "\n")] = '\0';
+  if (expected != line) {
+    fclose(f);
+    return false;
+  }
+
+  char key[kMaxKeyLength + 1];
+  char target_name[32];
+  // Keys cannot contain whitespace, see RegisterAutotunedKey.
+  while (fscanf(f, "%255s %31s", key, target_name) == 2) {
+    const uint32_t target = TargetFromName(target_name);
+    if (target != 0) SetTunedTarget(key, target);
+  }
+  fclose(f);
+  return true;
+}
+
+}  // namespace hwy
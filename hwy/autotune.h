@@ -0,0 +1,251 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef HIGHWAY_HWY_AUTOTUNE_H_
+#define HIGHWAY_HWY_AUTOTUNE_H_
+
+// Benchmark-driven choice of the target for individual exported functions.
+//
+// HWY_DYNAMIC_DISPATCH always calls the best target supported by the CPU, but
+// wider vectors are not always faster: for example, AVX-512 instructions may
+// reduce the clock frequency, which is not amortized if the function only runs
+// for short bursts. For functions exported via HWY_EXPORT_AUTOTUNED, the first
+// HWY_AUTOTUNED_DISPATCH instead measures each supported target with
+// nanobenchmark on a caller-provided representative input and then always
+// calls the fastest. Decisions are stored per key, a string that must be unique
+// within the program (e.g. the qualified function name), and can be saved to
+// and loaded from a file to avoid re-tuning at every startup.
+//
+// Example (RunMyFunction is typically a lambda or function):
+//
+//   HWY_EXPORT_AUTOTUNED(MyFunction, "mylib::MyFunction");
+//
+//   void MyFunction(const float* HWY_RESTRICT in, size_t num) {
+//     const auto run = [](decltype(&HWY_STATIC_DISPATCH(MyFunction)) func,
+//                         hwy::FuncInput input) -> hwy::FuncOutput {
+//       func(kRepresentativeData, kRepresentativeSize);
+//       return input;
+//     };
+//     return HWY_AUTOTUNED_DISPATCH(MyFunction, run)(in, num);
+//   }
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <vector>
+
+#include "hwy/base.h"
+#include "hwy/nanobenchmark.h"
+#include "hwy/targets.h"
+
+namespace hwy {
+
+// Returns the target (a single HWY_* bit) tuned or set for the function with
+// the given key, or 0 if there is none.
+uint32_t GetTunedTarget(const char* key);
+
+// Records "target" as the one to use for the function with the given key. This
+// is also useful for pinning a target without measuring, e.g. during A/B
+// comparisons.
+void SetTunedTarget(const char* key, uint32_t target);
+
+// Reserves "key" for one HWY_EXPORT_AUTOTUNED, which aborts if this fails.
+// Returns false if the key is already reserved or invalid: empty, longer than
+// 255 characters or containing whitespace.
+bool RegisterAutotunedKey(const char* key);
+
+// Forgets all decisions. Functions already resolved by HWY_AUTOTUNED_DISPATCH
+// are not affected until HWY_RESET_AUTOTUNED_DISPATCH.
+void ClearTunedTargets();
+
+// Writes all decisions to "path": a "cpu" line with CpuInfo::model, then one
+// "key TargetName" pair per line. Returns false if the file could not be
+// written.
+bool SaveTunedTargets(const char* path);
+
+// Adds the decisions stored by SaveTunedTargets in "path". Lines with unknown
+// target names are ignored. Returns false, without adding any decisions, if
+// the file could not be read or was written on a different CPU model, whose
+// fastest targets may differ.
+bool LoadTunedTargets(const char* path);
+
+// Returns the target (a single HWY_* bit) for a target name as returned by
+// TargetName, or 0 if unknown.
+uint32_t TargetFromName(const char* target_name);
+
+// Bounds the time that the first call of an autotuned function spends
+// measuring. Each supported target is measured up to max_attempts times, and
+// each attempt runs "run" for at most about 5 * seconds_per_eval *
+// (2^max_evals - 1) seconds (see nanobenchmark's Params). The defaults limit
+// this to roughly 0.15 s per target in the worst case, and much less if the
+// measurements are stable.
+struct AutotuneParams {
+  double seconds_per_eval = 1E-3;
+  size_t max_evals = 4;
+  // Maximum variability (see Params::target_rel_mad). Comparing targets does
+  // not require nanobenchmark's default precision.
+  double target_rel_mad = 0.01;
+  size_t max_attempts = 2;
+};
+
+// Affects subsequent autotuning, e.g. after HWY_RESET_AUTOTUNED_DISPATCH.
+void SetAutotuneParams(const AutotuneParams& params);
+AutotuneParams GetAutotuneParams();
+
+namespace detail {
+
+// Returns the index of "target" in a table defined by HWY_EXPORT. Must be in
+// the header so it uses the HWY_TARGETS of the caller's translation unit.
+static HWY_INLINE size_t AutotuneTableIndex(uint32_t target) {
+#if HWY_IDE || ((HWY_TARGETS & (HWY_TARGETS - 1)) == 0)
+  (void)target;
+  return 0;
+#else
+  if (target == HWY_SCALAR) return HWY_MAX_DYNAMIC_TARGETS + 1;
+  const uint32_t shifted = HWY_CHOSEN_TARGET_SHIFT(target);
+  return shifted == 0 ? 0 : Num0BitsBelowLS1Bit_Nonzero32(shifted);
+#endif
+}
+
+}  // namespace detail
+
+// Returns the entry of "table" (from HWY_EXPORT) for the fastest target,
+// measuring each supported target by calling run(func, input) if there is no
+// usable decision for "key" yet. The decision is recorded via SetTunedTarget.
+template <typename FunctionType, class Run>
+FunctionType Autotune(const char* key, FunctionType const* table,
+                      const Run& run) {
+  const std::vector<uint32_t> targets = SupportedAndGeneratedTargets();
+
+  // Reuse an existing decision if it is still supported, e.g. not disabled.
+  const uint32_t tuned = GetTunedTarget(key);
+  for (uint32_t target : targets) {
+    if (target == tuned) {
+      const FunctionType func = table[detail::AutotuneTableIndex(target)];
+      if (func != nullptr) return func;
+    }
+  }
+
+  const FuncInput inputs[1] = {static_cast<FuncInput>(Unpredictable1())};
+  const AutotuneParams budget = GetAutotuneParams();
+  Params params;
+  params.seconds_per_eval = budget.seconds_per_eval;
+  params.max_evals = budget.max_evals;
+  params.target_rel_mad = budget.target_rel_mad;
+  params.verbose = false;
+
+  uint32_t best_target = 0;
+  FunctionType best_func = nullptr;
+  float best_ticks = 0.0f;
+  for (uint32_t target : targets) {
+    const FunctionType func = table[detail::AutotuneTableIndex(target)];
+    if (func == nullptr) continue;
+    const auto closure = [&run, func](FuncInput input) {
+      return run(func, input);
+    };
+    Result results[1];
+    // Measure sometimes fails due to noise in its overhead estimate; retry.
+    size_t num_results = 0;
+    for (size_t attempt = 0; attempt < budget.max_attempts && num_results != 1;
+         ++attempt) {
+      num_results = MeasureClosure(closure, inputs, 1, results, params);
+    }
+    if (num_results != 1) continue;
+    if (best_func == nullptr || results[0].ticks < best_ticks) {
+      best_target = target;
+      best_func = func;
+      best_ticks = results[0].ticks;
+    }
+  }
+
+  // Measurement failed (e.g. no usable timer): behave like HWY_EXPORT, whose
+  // first entry chooses the best supported target.
+  if (best_func == nullptr) return table[0];
+
+  SetTunedTarget(key, best_target);
+  return best_func;
+}
+
+// Returns the cached function pointer, or autotunes and caches it.
+template <typename FunctionType, class Run>
+HWY_INLINE FunctionType AutotunedFunction(const char* key,
+                                          FunctionType const* table,
+                                          std::atomic<FunctionType>* cache,
+                                          const Run& run) {
+  FunctionType func = cache->load(std::memory_order_acquire);
+  if (HWY_UNLIKELY(func == nullptr)) {
+    func = Autotune(key, table, run);
+    cache->store(func, std::memory_order_release);
+  }
+  return func;
+}
+
+}  // namespace hwy
+
+#define HWY_AUTOTUNE_CACHE(FUNC_NAME) \
+  HWY_CONCAT(FUNC_NAME, HighwayAutotuneCache)
+#define HWY_AUTOTUNE_KEY(FUNC_NAME) HWY_CONCAT(FUNC_NAME, HighwayAutotuneKey)
+
+// Defines the key and reserves it during static initialization.
+#define HWY_DEFINE_AUTOTUNE_KEY(FUNC_NAME, KEY)                              \
+  HWY_MAYBE_UNUSED static constexpr const char* HWY_AUTOTUNE_KEY(FUNC_NAME) = \
+      KEY;                                                                   \
+  HWY_MAYBE_UNUSED static const bool HWY_CONCAT(                             \
+      FUNC_NAME, HighwayAutotuneKeyRegistered) =                             \
+      hwy::RegisterAutotunedKey(KEY) ||                                      \
+      (HWY_ABORT("Duplicate or invalid autotune key %s", KEY), false)
+
+#if HWY_IDE || ((HWY_TARGETS & (HWY_TARGETS - 1)) == 0)
+
+// With a single target there is nothing to choose; "RUN" is never called.
+#define HWY_EXPORT_AUTOTUNED(FUNC_NAME, KEY) \
+  HWY_EXPORT(FUNC_NAME);                     \
+  HWY_DEFINE_AUTOTUNE_KEY(FUNC_NAME, KEY)
+#define HWY_AUTOTUNED_DISPATCH(FUNC_NAME, RUN) \
+  (*((void)(RUN), &HWY_STATIC_DISPATCH(FUNC_NAME)))
+#define HWY_RESET_AUTOTUNED_DISPATCH(FUNC_NAME) (void)0
+
+#else
+
+// HWY_EXPORT_AUTOTUNED(FUNC_NAME, KEY); is used instead of HWY_EXPORT. It
+// defines the same table plus a function pointer which is resolved on the first
+// call. KEY is a string literal identifying the decision, which must be unique
+// within the program (e.g. the function name including its namespace).
+#define HWY_EXPORT_AUTOTUNED(FUNC_NAME, KEY)                         \
+  HWY_EXPORT(FUNC_NAME);                                             \
+  HWY_DEFINE_AUTOTUNE_KEY(FUNC_NAME, KEY);                           \
+  HWY_MAYBE_UNUSED static std::atomic<decltype(&HWY_STATIC_DISPATCH( \
+      FUNC_NAME))> HWY_AUTOTUNE_CACHE(FUNC_NAME) {                   \
+    nullptr                                                          \
+  }
+
+// "RUN" is a callable (typically a named lambda; commas in a capture list would
+// split the macro argument) taking the function pointer and a FuncInput, which
+// calls the function with representative arguments and returns a FuncOutput.
+// Each call should take at least several hundred cycles; if the measurements
+// fail, the best supported target is used without recording a decision.
+#define HWY_AUTOTUNED_DISPATCH(FUNC_NAME, RUN)                      \
+  (*hwy::AutotunedFunction(HWY_AUTOTUNE_KEY(FUNC_NAME),            \
+                           HWY_DISPATCH_TABLE(FUNC_NAME),          \
+                           &HWY_AUTOTUNE_CACHE(FUNC_NAME), RUN))
+
+// Causes the next HWY_AUTOTUNED_DISPATCH(FUNC_NAME) to consult the decisions
+// again, e.g. after LoadTunedTargets or DisableTargets.
+#define HWY_RESET_AUTOTUNED_DISPATCH(FUNC_NAME) \
+  HWY_AUTOTUNE_CACHE(FUNC_NAME).store(nullptr, std::memory_order_release)
+
+#endif  // HWY_IDE || ((HWY_TARGETS & (HWY_TARGETS - 1)) == 0)
+
+#endif  // HIGHWAY_HWY_AUTOTUNE_H_
@@ -0,0 +1,206 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "hwy/autotune.h"
+
+#include <stdio.h>
+
+#include <string>
+#include <vector>
+
+#include "hwy/tests/test_util-inl.h"
+
+namespace fake {
+
+// Whether HWY_AUTOTUNED_DISPATCH chooses among multiple targets.
+constexpr bool kIsDynamic =
+    !HWY_IDE && ((HWY_TARGETS & (HWY_TARGETS - 1)) != 0);
+
+// This target is much faster than all others. It still does some work because
+// measurements of empty functions are unreliable.
+uint32_t g_fast_target = 0;
+
+HWY_NOINLINE void Spin(uint32_t iterations) {
+  volatile uint32_t sum = 0;
+  for (uint32_t i = 0; i < iterations; ++i) {
+    sum = sum + i;
+  }
+}
+
+#define DECLARE_FUNCTION(TGT)                                  \
+  namespace N_##TGT {                                          \
+    uint32_t FakeTunedFunction(int) {                          \
+      Spin(HWY_##TGT == g_fast_target ? 10 : 1000);            \
+      return HWY_##TGT;                                        \
+    }                                                          \
+    uint32_t FakePinnedFunction(int) { return HWY_##TGT; }     \
+  }
+
+DECLARE_FUNCTION(AVX3_DL)
+DECLARE_FUNCTION(AVX3)
+DECLARE_FUNCTION(AVX2)
+DECLARE_FUNCTION(SSE4)
+DECLARE_FUNCTION(SSSE3)
+DECLARE_FUNCTION(NEON)
+DECLARE_FUNCTION(SVE)
+DECLARE_FUNCTION(SVE2)
+DECLARE_FUNCTION(PPC8)
+DECLARE_FUNCTION(WASM)
+DECLARE_FUNCTION(RVV)
+DECLARE_FUNCTION(SCALAR)
+
+HWY_EXPORT_AUTOTUNED(FakeTunedFunction, "fake::FakeTunedFunction");
+HWY_EXPORT_AUTOTUNED(FakePinnedFunction, "fake::FakePinnedFunction");
+
+using TunedFunc = decltype(&HWY_STATIC_DISPATCH(FakeTunedFunction));
+using PinnedFunc = decltype(&HWY_STATIC_DISPATCH(FakePinnedFunction));
+
+uint32_t CallTuned() {
+  const auto run = [](TunedFunc func, hwy::FuncInput input) {
+    return static_cast<hwy::FuncOutput>(func(static_cast<int>(input)));
+  };
+  return HWY_AUTOTUNED_DISPATCH(FakeTunedFunction, run)(42);
+}
+
+uint32_t CallPinned() {
+  const auto run = [](PinnedFunc func, hwy::FuncInput input) {
+    return static_cast<hwy::FuncOutput>(func(static_cast<int>(input)));
+  };
+  return HWY_AUTOTUNED_DISPATCH(FakePinnedFunction, run)(42);
+}
+
+void ResetTuned() { HWY_RESET_AUTOTUNED_DISPATCH(FakeTunedFunction); }
+void ResetPinned() { HWY_RESET_AUTOTUNED_DISPATCH(FakePinnedFunction); }
+
+}  // namespace fake
+
+namespace hwy {
+
+class HwyAutotuneTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    Reset();
+    // The fake functions differ by two orders of magnitude, hence a small
+    // measurement budget suffices.
+    AutotuneParams params;
+    params.seconds_per_eval = 1E-4;
+    params.max_evals = 3;
+    params.target_rel_mad = 0.05;
+    SetAutotuneParams(params);
+  }
+  void TearDown() override {
+    Reset();
+    SetAutotuneParams(AutotuneParams());
+  }
+
+  static void Reset() {
+    ClearTunedTargets();
+    DisableTargets(0);
+    fake::ResetTuned();
+    fake::ResetPinned();
+  }
+};
+
+TEST_F(HwyAutotuneTest, TestTargetFromName) {
+  for (uint32_t target : SupportedAndGeneratedTargets()) {
+    EXPECT_EQ(target, TargetFromName(TargetName(target)));
+  }
+  EXPECT_EQ(0u, TargetFromName("Unknown"));
+  EXPECT_EQ(0u, TargetFromName("NotATarget"));
+}
+
+// Autotuning must choose the fastest target even if it is not the best.
+TEST_F(HwyAutotuneTest, TestChoosesFastest) {
+  const std::vector<uint32_t> targets = SupportedAndGeneratedTargets();
+  // Lowest priority, i.e. the one HWY_DYNAMIC_DISPATCH would never choose.
+  fake::g_fast_target = targets.back();
+  EXPECT_EQ(fake::g_fast_target, fake::CallTuned());
+  EXPECT_EQ(fake::g_fast_target, fake::CallTuned());
+  if (fake::kIsDynamic) {
+    EXPECT_EQ(fake::g_fast_target, GetTunedTarget("fake::FakeTunedFunction"));
+  }
+}
+
+// Keys identify decisions and thus must be unique and representable in files.
+TEST_F(HwyAutotuneTest, TestRegisterKey) {
+  EXPECT_FALSE(RegisterAutotunedKey("fake::FakeTunedFunction"));
+  EXPECT_TRUE(RegisterAutotunedKey("other::FakeTunedFunction"));
+  EXPECT_FALSE(RegisterAutotunedKey("other::FakeTunedFunction"));
+  EXPECT_FALSE(RegisterAutotunedKey(""));
+  EXPECT_FALSE(RegisterAutotunedKey("has space"));
+  EXPECT_FALSE(RegisterAutotunedKey(std::string(256, 'k').c_str()));
+}
+
+// An existing decision is used without measuring.
+TEST_F(HwyAutotuneTest, TestPinned) {
+  for (uint32_t target : SupportedAndGeneratedTargets()) {
+    SetTunedTarget("fake::FakePinnedFunction", target);
+    fake::ResetPinned();
+    const uint32_t expected =
+        fake::kIsDynamic ? target : uint32_t(HWY_STATIC_TARGET);
+    EXPECT_EQ(expected, fake::CallPinned());
+  }
+}
+
+// A decision for a target that is no longer supported is replaced.
+TEST_F(HwyAutotuneTest, TestDisabledDecision) {
+  const std::vector<uint32_t> targets = SupportedAndGeneratedTargets();
+  const uint32_t best = targets.front();
+  if (!fake::kIsDynamic) return;
+  if ((best & HWY_ENABLED_BASELINE) != 0) return;  // cannot disable
+  fake::g_fast_target = targets.back();
+  SetTunedTarget("fake::FakeTunedFunction", best);
+  DisableTargets(best);
+  EXPECT_EQ(fake::g_fast_target, fake::CallTuned());
+  EXPECT_EQ(fake::g_fast_target, GetTunedTarget("fake::FakeTunedFunction"));
+}
+
+TEST_F(HwyAutotuneTest, TestSaveLoad) {
+  const std::vector<uint32_t> targets = SupportedAndGeneratedTargets();
+  const std::string path = testing::TempDir() + "hwy_autotune_test.txt";
+  SetTunedTarget("fake::FakeTunedFunction", targets.back());
+  SetTunedTarget("fake::FakePinnedFunction", targets.front());
+  ASSERT_TRUE(SaveTunedTargets(path.c_str()));
+
+  ClearTunedTargets();
+  EXPECT_EQ(0u, GetTunedTarget("fake::FakeTunedFunction"));
+  ASSERT_TRUE(LoadTunedTargets(path.c_str()));
+  EXPECT_EQ(targets.back(), GetTunedTarget("fake::FakeTunedFunction"));
+  EXPECT_EQ(targets.front(), GetTunedTarget("fake::FakePinnedFunction"));
+  remove(path.c_str());
+
+  EXPECT_FALSE(LoadTunedTargets((path + ".does_not_exist").c_str()));
+}
+
+// Files written on another CPU model are ignored.
+TEST_F(HwyAutotuneTest, TestLoadOtherCpu) {
+  const std::string path = testing::TempDir() + "hwy_autotune_other_cpu.txt";
+  FILE* f = fopen(path.c_str(), "w");
+  ASSERT_TRUE(f != nullptr);
+  fprintf(f, "cpu NotThisCpu 1.2.3\nfake::FakeTunedFunction %s\n",
+          TargetName(HWY_SCALAR));
+  fclose(f);
+
+  EXPECT_FALSE(LoadTunedTargets(path.c_str()));
+  EXPECT_EQ(0u, GetTunedTarget("fake::FakeTunedFunction"));
+  remove(path.c_str());
+}
+
+}  // namespace hwy
+
+// Ought not to be necessary, but without this, no tests run on RVV.
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,101 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Compares the cost of AllocateAligned plus free for short-lived scratch
+// buffers via malloc (the default) and via the pool allocator, with multiple
+// threads allocating concurrently.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include <atomic>
+#include <chrono>  // NOLINT
+#include <thread>  // NOLINT
+#include <vector>
+
+#include "hwy/aligned_allocator.h"
+#include "hwy/base.h"
+#include "hwy/pool_allocator.h"
+
+namespace hwy {
+namespace {
+
+// Unlike platform::Now, does not require an invariant TSC.
+double Now() {
+  return std::chrono::duration<double>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+constexpr size_t kIterations = 200000;
+constexpr size_t kLive = 4;  // buffers allocated at the same time
+
+// Allocates kLive buffers of varying sizes, writes to them and frees them.
+// Returns a value that depends on the writes.
+float Scratch(AllocPtr alloc, FreePtr free, size_t seed) {
+  float sum = 0.0f;
+  uint32_t sizes = static_cast<uint32_t>(seed) * 2654435761u;
+  for (size_t i = 0; i < kIterations; ++i) {
+    AlignedFreeUniquePtr<float[]> buffers[kLive];
+    for (size_t j = 0; j < kLive; ++j) {
+      sizes = sizes * 1103515245u + 12345u;
+      const size_t num = 16 + (sizes >> 16) % 4096;  // up to 16 KiB
+      buffers[j] = AllocateAligned<float>(num, alloc, free, nullptr);
+      buffers[j][0] = static_cast<float>(j);
+      buffers[j][num - 1] = 1.0f;
+      sum += buffers[j][0];
+    }
+  }
+  return sum;
+}
+
+// Returns nanoseconds per AllocateAligned/free pair.
+double Run(AllocPtr alloc, FreePtr free, size_t num_threads) {
+  std::atomic<uint32_t> sink{0};
+  const double t0 = Now();
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < num_threads; ++t) {
+    threads.emplace_back([alloc, free, t, &sink]() {
+      sink.fetch_add(static_cast<uint32_t>(Scratch(alloc, free, t)));
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  const double elapsed = Now() - t0;
+  if (sink.load() == 1) printf("\n");  // prevent elision
+  return elapsed * 1E9 / (kIterations * kLive);
+}
+
+}  // namespace
+}  // namespace hwy
+
+int main(int /*argc*/, char** /*argv*/) {
+  // At least 4 so that contention is visible even on small machines.
+  const size_t max_threads =
+      HWY_MAX(static_cast<size_t>(std::thread::hardware_concurrency()), 4);
+  printf("%8s %12s %12s (ns per allocation, wall time)\n", "Threads", "malloc",
+         "pool");
+  for (size_t num_threads = 1;; num_threads *= 2) {
+    num_threads = HWY_MIN(num_threads, max_threads);
+    const double malloc_ns = hwy::Run(nullptr, nullptr, num_threads);
+    const double pool_ns = hwy::Run(&hwy::PoolAlloc, &hwy::PoolFree,
+                                    num_threads);
+    printf("%8zu %12.1f %12.1f\n", num_threads, malloc_ns, pool_ns);
+    if (num_threads == max_threads) break;
+  }
+  hwy::TrimPool();
+  return 0;
+}
@@ -0,0 +1,167 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Compares AllocationPolicy settings for a large buffer: the time until the
+// first write completes (including page faults), streaming read bandwidth and
+// the latency of random reads, which is sensitive to TLB misses.
+//
+// Usage: bandwidth_benchmark [MiB], default 1024.
+
+#undef HWY_TARGET_INCLUDE
+#define HWY_TARGET_INCLUDE "hwy/bench/bandwidth_benchmark.cc"
+#include "hwy/foreach_target.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <chrono>  // NOLINT
+
+#include "hwy/aligned_allocator.h"
+#include "hwy/highway.h"
+
+HWY_BEFORE_NAMESPACE();
+namespace hwy {
+namespace HWY_NAMESPACE {
+
+// Returns the sum of all `num` elements; independent accumulators keep
+// multiple loads in flight. `num` is a multiple of 4 vectors.
+HWY_NOINLINE uint64_t SumAll(const uint64_t* HWY_RESTRICT data, size_t num) {
+  const HWY_FULL(uint64_t) d;
+  const size_t N = Lanes(d);
+  auto sum0 = Zero(d);
+  auto sum1 = Zero(d);
+  auto sum2 = Zero(d);
+  auto sum3 = Zero(d);
+  for (size_t i = 0; i < num; i += 4 * N) {
+    sum0 += Load(d, data + i + 0 * N);
+    sum1 += Load(d, data + i + 1 * N);
+    sum2 += Load(d, data + i + 2 * N);
+    sum3 += Load(d, data + i + 3 * N);
+  }
+  return GetLane(SumOfLanes(d, (sum0 + sum1) + (sum2 + sum3)));
+}
+
+// NOLINTNEXTLINE(google-readability-namespace-comments)
+}  // namespace HWY_NAMESPACE
+}  // namespace hwy
+HWY_AFTER_NAMESPACE();
+
+#if HWY_ONCE
+namespace hwy {
+
+HWY_EXPORT(SumAll);
+
+// Unlike platform::Now, does not require an invariant TSC.
+double Now() {
+  return std::chrono::duration<double>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+// Reads `num_reads` elements at pseudo-random positions. The position of each
+// read depends on the previous value, so they cannot overlap.
+uint64_t RandomReads(const uint64_t* HWY_RESTRICT data, size_t num,
+                     size_t num_reads) {
+  uint64_t state = 0x9E3779B97F4A7C15ull;
+  uint64_t sum = 0;
+  for (size_t i = 0; i < num_reads; ++i) {
+    state = state * 6364136223846793005ull + 1442695040888963407ull + sum;
+    sum += data[(state >> 20) % num];
+  }
+  return sum;
+}
+
+void Run(const char* caption, AllocationPolicy policy, size_t bytes) {
+  const size_t num = bytes / sizeof(uint64_t);
+  const double gib = static_cast<double>(bytes) / (1ull << 30);
+
+  double t0 = Now();
+  auto data =
+      AllocateAligned<uint64_t>(num, &PolicyAlloc, &PolicyFree, &policy);
+  if (!data) {
+    fprintf(stderr, "%-28s allocation failed.\n", caption);
+    return;
+  }
+  const double alloc_sec = Now() - t0;
+
+  t0 = Now();
+  for (size_t i = 0; i < num; ++i) {
+    data[i] = i;
+  }
+  const double write_sec = Now() - t0;
+
+  double read_sec = 1E10;
+  uint64_t sum = 0;
+  for (int rep = 0; rep < 5; ++rep) {
+    t0 = Now();
+    sum += HWY_DYNAMIC_DISPATCH(SumAll)(data.get(), num);
+    read_sec = HWY_MIN(read_sec, Now() - t0);
+  }
+
+  const size_t kNumReads = 4 << 20;
+  t0 = Now();
+  sum += RandomReads(data.get(), num, kNumReads);
+  const double random_sec = Now() - t0;
+
+  printf(
+      "%-28s alloc %7.2f ms  first write %6.2f GB/s  read %6.2f GB/s  "
+      "random %6.1f ns  (%llu)\n",
+      caption, alloc_sec * 1E3, gib / write_sec, gib / read_sec,
+      random_sec * 1E9 / kNumReads, static_cast<unsigned long long>(sum & 1));
+}
+
+}  // namespace hwy
+
+int main(int argc, char** argv) {
+  using Pages = hwy::AllocationPolicy::Pages;
+  using Numa = hwy::AllocationPolicy::Numa;
+
+  size_t mib = 1024;
+  if (argc > 1) mib = static_cast<size_t>(strtoul(argv[1], nullptr, 10));
+  // Multiple of the SumAll unroll factor for all targets.
+  const size_t bytes = HWY_MAX(mib, size_t{1}) << 20;
+
+  const hwy::CpuInfo& info = hwy::GetCpuInfo();
+  const size_t numa_nodes = HWY_MAX(info.numa_nodes, size_t{1});
+  const uint64_t all_nodes =
+      numa_nodes >= 64 ? ~0ull : (1ull << numa_nodes) - 1;
+  printf("%zu MiB, %zu NUMA node(s), %zu threads\n", bytes >> 20,
+         info.numa_nodes, info.logical_cores);
+
+  hwy::AllocationPolicy policy;
+  hwy::Run("malloc", policy, bytes);
+
+  policy.pages = Pages::kTransparentHuge;
+  hwy::Run("transparent huge", policy, bytes);
+
+  policy.pages = Pages::kExplicitHuge;
+  hwy::Run("explicit huge", policy, bytes);
+
+  policy.pages = Pages::kTransparentHuge;
+  policy.numa = Numa::kInterleave;
+  policy.numa_nodes = all_nodes;
+  hwy::Run("huge + interleave", policy, bytes);
+
+  policy.numa = Numa::kBind;
+  policy.numa_nodes = 1;
+  hwy::Run("huge + bind node 0", policy, bytes);
+
+  policy.numa = Numa::kDefault;
+  policy.prefault_threads = HWY_MAX(info.logical_cores, size_t{1});
+  hwy::Run("huge + prefault", policy, bytes);
+  return 0;
+}
+#endif  // HWY_ONCE
@@ -0,0 +1,99 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Compares the per-call overhead of HWY_STATIC_DISPATCH, HWY_DYNAMIC_DISPATCH
+// and HWY_CACHED_DISPATCH for a function that does almost no work.
+
+#undef HWY_TARGET_INCLUDE
+#define HWY_TARGET_INCLUDE "hwy/bench/dispatch_benchmark.cc"
+#include "hwy/foreach_target.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "hwy/highway.h"
+#include "hwy/nanobenchmark.h"
+
+HWY_BEFORE_NAMESPACE();
+namespace hwy {
+namespace HWY_NAMESPACE {
+
+// Each call depends on the previous result, so calls cannot overlap.
+HWY_NOINLINE uint32_t AddOne(uint32_t x) { return x + 1; }
+
+// NOLINTNEXTLINE(google-readability-namespace-comments)
+}  // namespace HWY_NAMESPACE
+}  // namespace hwy
+HWY_AFTER_NAMESPACE();
+
+#if HWY_ONCE
+namespace hwy {
+
+// Also defines the table used by HWY_DYNAMIC_DISPATCH.
+HWY_EXPORT_CACHED(AddOne);
+
+FuncOutput CallStatic(const void* /*arg*/, const FuncInput num_calls) {
+  uint32_t x = 0;
+  for (size_t i = 0; i < num_calls; ++i) {
+    x = HWY_STATIC_DISPATCH(AddOne)(x);
+  }
+  return x;
+}
+
+FuncOutput CallDynamic(const void* /*arg*/, const FuncInput num_calls) {
+  uint32_t x = 0;
+  for (size_t i = 0; i < num_calls; ++i) {
+    x = HWY_DYNAMIC_DISPATCH(AddOne)(x);
+  }
+  return x;
+}
+
+FuncOutput CallCached(const void* /*arg*/, const FuncInput num_calls) {
+  uint32_t x = 0;
+  for (size_t i = 0; i < num_calls; ++i) {
+    x = HWY_CACHED_DISPATCH(AddOne)(x);
+  }
+  return x;
+}
+
+void Run() {
+  const size_t kNumInputs = 1;
+  const FuncInput inputs[kNumInputs] = {1000 * size_t(Unpredictable1())};
+  Params p;
+  p.verbose = false;
+  p.max_evals = 9;
+  p.target_rel_mad = 0.002;
+
+  const Func funcs[3] = {&CallStatic, &CallDynamic, &CallCached};
+  const char* names[3] = {"static", "dynamic", "cached"};
+  for (size_t i = 0; i < 3; ++i) {
+    Result result[kNumInputs];
+    if (Measure(funcs[i], nullptr, inputs, kNumInputs, result, p) !=
+        kNumInputs) {
+      fprintf(stderr, "Measure failed.\n");
+      return;
+    }
+    printf("%8s: %6.3f cycles/call\n", names[i],
+           result[0].ticks / double(result[0].input));
+  }
+}
+
+}  // namespace hwy
+
+int main(int /*argc*/, char** /*argv*/) {
+  hwy::Run();
+  return 0;
+}
+#endif  // HWY_ONCE
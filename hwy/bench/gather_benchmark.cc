@@ -0,0 +1,236 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Compares GatherIndex/MaskedGatherIndex against scalar table lookups. Some
+// targets and lane sizes have native gathers, others emulate them. For 8 and
+// 16-bit lanes, also measures the alternative of 32-bit gathers whose results
+// are truncated and packed.
+
+#undef HWY_TARGET_INCLUDE
+#define HWY_TARGET_INCLUDE "hwy/bench/gather_benchmark.cc"
+#include "hwy/foreach_target.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "hwy/aligned_allocator.h"
+#include "hwy/highway.h"
+#include "hwy/nanobenchmark.h"
+
+HWY_BEFORE_NAMESPACE();
+namespace hwy {
+namespace HWY_NAMESPACE {
+
+template <typename T>
+class GatherBenchmark {
+  using TI = MakeSigned<T>;
+  using TU = MakeUnsigned<T>;
+
+ public:
+  // Multiple of the largest vector size.
+  static size_t NumItems() { return 4096; }
+
+  // Power of two. 8-bit indices are unsigned, so 8-bit tables have 256 entries.
+  static size_t TableSize() {
+    return sizeof(T) == 1 ? 256 : 4096;
+  }
+
+  GatherBenchmark()
+      // Padding for the 32-bit loads in Widened.
+      : table_(AllocateAligned<T>(TableSize() + 4)),
+        indices_(AllocateAligned<TI>(NumItems())),
+        out_(AllocateAligned<T>(NumItems())) {
+    for (size_t i = 0; i < TableSize() + 4; ++i) {
+      table_[i] = static_cast<T>(i * 2654435761u);
+    }
+    uint32_t state = 12345;
+    for (size_t i = 0; i < NumItems(); ++i) {
+      state = state * 1103515245u + 12345u;
+      indices_[i] = static_cast<TI>((state >> 8) % TableSize());
+    }
+  }
+
+  FuncOutput Scalar(const size_t num_items) {
+    const T* HWY_RESTRICT table = table_.get();
+    const TI* HWY_RESTRICT indices = indices_.get();
+    T* HWY_RESTRICT out = out_.get();
+    for (size_t i = 0; i < num_items; ++i) {
+      out[i] = table[static_cast<TU>(indices[i])];
+    }
+    return static_cast<FuncOutput>(out[num_items - 1]);
+  }
+
+  FuncOutput Vector(const size_t num_items) {
+    const HWY_FULL(T) d;
+    const Rebind<TI, decltype(d)> di;
+    for (size_t i = 0; i < num_items; i += Lanes(d)) {
+      const auto idx = Load(di, indices_.get() + i);
+      Store(GatherIndex(d, table_.get(), idx), d, out_.get() + i);
+    }
+    return static_cast<FuncOutput>(out_[num_items - 1]);
+  }
+
+  // Bounds-checks the indices. All are valid, so the output matches Vector().
+  FuncOutput Masked(const size_t num_items) {
+    const HWY_FULL(T) d;
+    const Rebind<TI, decltype(d)> di;
+    const auto bits = Set(di, static_cast<TI>(TableSize() - 1));
+    for (size_t i = 0; i < num_items; i += Lanes(d)) {
+      const auto idx = Load(di, indices_.get() + i);
+      const auto valid = RebindMask(d, Eq(And(idx, bits), idx));
+      Store(MaskedGatherIndex(valid, d, table_.get(), idx), d, out_.get() + i);
+    }
+    return static_cast<FuncOutput>(out_[num_items - 1]);
+  }
+
+  // Instead of emulating 8/16-bit gathers, loads 32 bits starting at each
+  // element (hence the table padding) and keeps only the lower bits.
+  FuncOutput Widened(const size_t num_items) {
+    const HWY_FULL(int32_t) d32;
+    const Rebind<TU, decltype(d32)> du;
+    const Rebind<T, decltype(d32)> d;
+    constexpr int kShift = sizeof(T) == 1 ? 0 : 1;
+    const auto lower = Set(d32, static_cast<int32_t>(LimitsMax<TU>()));
+    const int32_t* table32 = reinterpret_cast<const int32_t*>(table_.get());
+    const TU* indices = reinterpret_cast<const TU*>(indices_.get());
+    for (size_t i = 0; i < num_items; i += Lanes(d32)) {
+      const auto idx = PromoteTo(d32, LoadU(du, indices + i));
+      const auto offsets = ShiftLeft<kShift>(idx);
+      const auto words = GatherOffset(d32, table32, offsets);
+      StoreU(BitCast(d, DemoteTo(du, And(words, lower))), d, out_.get() + i);
+    }
+    return static_cast<FuncOutput>(out_[num_items - 1]);
+  }
+
+  bool Verify(size_t num_items) const {
+    for (size_t i = 0; i < num_items; ++i) {
+      if (out_[i] != table_[static_cast<TU>(indices_[i])]) {
+        fprintf(stderr, "Mismatch at %zu\n", i);
+        return false;
+      }
+    }
+    return true;
+  }
+
+ private:
+  AlignedFreeUniquePtr<T[]> table_;
+  AlignedFreeUniquePtr<TI[]> indices_;
+  AlignedFreeUniquePtr<T[]> out_;
+};
+
+// Returns cycles per item for Widened, or 0 if not applicable/failed.
+template <typename T, hwy::EnableIf<(sizeof(T) <= 2)>* = nullptr>
+double MeasureWidened(GatherBenchmark<T>& benchmark, const FuncInput* inputs,
+                      const Params& p) {
+  Result widened[1];
+  if (MeasureClosure(
+          [&benchmark](const FuncInput input) {
+            return benchmark.Widened(input);
+          },
+          inputs, 1, widened, p) != 1 ||
+      !benchmark.Verify(inputs[0])) {
+    return 0.0;
+  }
+  return widened[0].ticks / double(widened[0].input);
+}
+
+template <typename T, hwy::EnableIf<(sizeof(T) > 2)>* = nullptr>
+double MeasureWidened(GatherBenchmark<T>& /*benchmark*/,
+                      const FuncInput* /*inputs*/, const Params& /*p*/) {
+  return 0.0;
+}
+
+// Measures durations, verifies results, prints timings.
+template <typename T>
+void RunBenchmark(const char* caption) {
+  const size_t kNumInputs = 1;
+  const size_t num_items =
+      GatherBenchmark<T>::NumItems() * size_t(Unpredictable1());
+  const FuncInput inputs[kNumInputs] = {num_items};
+  Result scalar[kNumInputs];
+  Result vector[kNumInputs];
+  Result masked[kNumInputs];
+
+  GatherBenchmark<T> benchmark;
+
+  Params p;
+  p.verbose = false;
+  p.max_evals = 7;
+  p.target_rel_mad = 0.002;
+  const size_t num_scalar = MeasureClosure(
+      [&benchmark](const FuncInput input) { return benchmark.Scalar(input); },
+      inputs, kNumInputs, scalar, p);
+  const size_t num_vector = MeasureClosure(
+      [&benchmark](const FuncInput input) { return benchmark.Vector(input); },
+      inputs, kNumInputs, vector, p);
+  if (!benchmark.Verify(num_items)) return;
+  const size_t num_masked = MeasureClosure(
+      [&benchmark](const FuncInput input) { return benchmark.Masked(input); },
+      inputs, kNumInputs, masked, p);
+  if (!benchmark.Verify(num_items)) return;
+  if (num_scalar != kNumInputs || num_vector != kNumInputs ||
+      num_masked != kNumInputs) {
+    fprintf(stderr, "MeasureClosure failed.\n");
+    return;
+  }
+
+  const double scalar_cycles = scalar[0].ticks / double(scalar[0].input);
+  const double vector_cycles = vector[0].ticks / double(vector[0].input);
+  const double masked_cycles = masked[0].ticks / double(masked[0].input);
+  const double widened_cycles = MeasureWidened(benchmark, inputs, p);
+  printf("%4s: scalar %6.3f gather %6.3f (%.1fx) masked %6.3f", caption,
+         scalar_cycles, vector_cycles, scalar_cycles / vector_cycles,
+         masked_cycles);
+  if (widened_cycles != 0.0) {
+    printf(" widened32 %6.3f", widened_cycles);
+  }
+  printf(" cycles/item\n");
+}
+
+void RunBenchmarks() {
+  printf("------------------------ %s\n", TargetName(HWY_TARGET));
+  RunBenchmark<uint8_t>("u8");
+  RunBenchmark<uint16_t>("u16");
+  RunBenchmark<uint32_t>("u32");
+  RunBenchmark<float>("f32");
+#if HWY_CAP_INTEGER64
+  RunBenchmark<uint64_t>("u64");
+#endif
+}
+
+// NOLINTNEXTLINE(google-readability-namespace-comments)
+}  // namespace HWY_NAMESPACE
+}  // namespace hwy
+HWY_AFTER_NAMESPACE();
+
+#if HWY_ONCE
+namespace hwy {
+HWY_EXPORT(RunBenchmarks);
+
+void Run() {
+  for (uint32_t target : SupportedAndGeneratedTargets()) {
+    SetSupportedTargetsForTest(target);
+    HWY_DYNAMIC_DISPATCH(RunBenchmarks)();
+  }
+  SetSupportedTargetsForTest(0);  // Reset the mask afterwards.
+}
+
+}  // namespace hwy
+
+int main(int /*argc*/, char** /*argv*/) {
+  hwy::Run();
+  return 0;
+}
+#endif  // HWY_ONCE
@@ -0,0 +1,164 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Include guard (still compiled once per target)
+#if defined(HIGHWAY_HWY_CONTRIB_COMPLEX_COMPLEX_INL_H_) == \
+    defined(HWY_TARGET_TOGGLE)
+#ifdef HIGHWAY_HWY_CONTRIB_COMPLEX_COMPLEX_INL_H_
+#undef HIGHWAY_HWY_CONTRIB_COMPLEX_COMPLEX_INL_H_
+#else
+#define HIGHWAY_HWY_CONTRIB_COMPLEX_COMPLEX_INL_H_
+#endif
+
+#include <stddef.h>
+
+#include "hwy/highway.h"
+
+HWY_BEFORE_NAMESPACE();
+namespace hwy {
+namespace HWY_NAMESPACE {
+
+// Operations on complex numbers stored as interleaved (real, imaginary) pairs
+// of float or double lanes, i.e. the layout of std::complex<T> arrays. Even
+// lanes hold real parts, odd lanes the imaginary parts. Requires at least two
+// lanes, which rules out HWY_SCALAR for the vector ops.
+
+// Returns a * b.
+template <class D, class V>
+HWY_API V MulComplex(D d, V a, V b) {
+  const V a_re = DupEven(a);
+  const V a_im = DupOdd(a);
+  // (a_re * b_re - a_im * b_im, a_re * b_im + a_im * b_re)
+  return AddSub(Mul(a_re, b), Mul(a_im, Reverse2(d, b)));
+}
+
+// Returns a * conj(b), as used for correlation.
+template <class D, class V>
+HWY_API V MulComplexConj(D d, V a, V b) {
+  const V b_re = DupEven(b);
+  const V b_im = DupOdd(b);
+  // (a_re * b_re + a_im * b_im, a_im * b_re - a_re * b_im)
+  return AddSub(Mul(b_re, a), Neg(Mul(b_im, Reverse2(d, a))));
+}
+
+// Returns a * b + c; the real products are fused with c where FMA exists.
+template <class D, class V>
+HWY_API V MulComplexAdd(D d, V a, V b, V c) {
+  const V a_re = DupEven(a);
+  const V a_im = DupOdd(a);
+  return AddSub(MulAdd(a_re, b, c), Mul(a_im, Reverse2(d, b)));
+}
+
+// Returns |v|^2 = re^2 + im^2 in both lanes of each pair.
+template <class D, class V>
+HWY_API V MagnitudeSquared(D d, V v) {
+  const V squared = Mul(v, v);
+  return Add(squared, Reverse2(d, squared));
+}
+
+namespace detail {
+
+template <typename T>
+HWY_INLINE void MulComplexScalar(const T* HWY_RESTRICT a,
+                                 const T* HWY_RESTRICT b, T* HWY_RESTRICT out) {
+  const T re = a[0] * b[0] - a[1] * b[1];
+  const T im = a[0] * b[1] + a[1] * b[0];
+  out[0] = re;
+  out[1] = im;
+}
+
+template <typename T>
+HWY_INLINE void MulComplexConjScalar(const T* HWY_RESTRICT a,
+                                     const T* HWY_RESTRICT b,
+                                     T* HWY_RESTRICT out) {
+  const T re = a[0] * b[0] + a[1] * b[1];
+  const T im = a[1] * b[0] - a[0] * b[1];
+  out[0] = re;
+  out[1] = im;
+}
+
+}  // namespace detail
+
+// Array versions: `num` is the number of complex values, i.e. each array holds
+// 2 * num lanes. Remainders are handled with scalar code, as is everything on
+// HWY_SCALAR; otherwise, Lanes(d) must be at least two.
+
+// out[i] = a[i] * b[i].
+template <class D, typename T = TFromD<D>>
+HWY_API void MulComplexArrays(D d, const T* HWY_RESTRICT a,
+                              const T* HWY_RESTRICT b, size_t num,
+                              T* HWY_RESTRICT out) {
+  size_t i = 0;
+#if HWY_TARGET != HWY_SCALAR
+  const size_t N = Lanes(d);
+  for (; i + N <= 2 * num; i += N) {
+    StoreU(MulComplex(d, LoadU(d, a + i), LoadU(d, b + i)), d, out + i);
+  }
+#else
+  (void)d;
+#endif
+  for (; i < 2 * num; i += 2) {
+    detail::MulComplexScalar(a + i, b + i, out + i);
+  }
+}
+
+// out[i] = a[i] * conj(b[i]).
+template <class D, typename T = TFromD<D>>
+HWY_API void MulComplexConjArrays(D d, const T* HWY_RESTRICT a,
+                                  const T* HWY_RESTRICT b, size_t num,
+                                  T* HWY_RESTRICT out) {
+  size_t i = 0;
+#if HWY_TARGET != HWY_SCALAR
+  const size_t N = Lanes(d);
+  for (; i + N <= 2 * num; i += N) {
+    StoreU(MulComplexConj(d, LoadU(d, a + i), LoadU(d, b + i)), d, out + i);
+  }
+#else
+  (void)d;
+#endif
+  for (; i < 2 * num; i += 2) {
+    detail::MulComplexConjScalar(a + i, b + i, out + i);
+  }
+}
+
+// acc[i] += a[i] * b[i].
+template <class D, typename T = TFromD<D>>
+HWY_API void MulAddComplexArrays(D d, const T* HWY_RESTRICT a,
+                                 const T* HWY_RESTRICT b, size_t num,
+                                 T* HWY_RESTRICT acc) {
+  size_t i = 0;
+#if HWY_TARGET != HWY_SCALAR
+  const size_t N = Lanes(d);
+  for (; i + N <= 2 * num; i += N) {
+    const auto sum =
+        MulComplexAdd(d, LoadU(d, a + i), LoadU(d, b + i), LoadU(d, acc + i));
+    StoreU(sum, d, acc + i);
+  }
+#else
+  (void)d;
+#endif
+  for (; i < 2 * num; i += 2) {
+    T product[2];
+    detail::MulComplexScalar(a + i, b + i, product);
+    acc[i + 0] += product[0];
+    acc[i + 1] += product[1];
+  }
+}
+
+// NOLINTNEXTLINE(google-readability-namespace-comments)
+}  // namespace HWY_NAMESPACE
+}  // namespace hwy
+HWY_AFTER_NAMESPACE();
+
+#endif  // HIGHWAY_HWY_CONTRIB_COMPLEX_COMPLEX_INL_H_
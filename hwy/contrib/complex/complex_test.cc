@@ -0,0 +1,173 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <stddef.h>
+#include <stdio.h>
+
+#include <cmath>
+#include <complex>
+#include <limits>
+
+#undef HWY_TARGET_INCLUDE
+#define HWY_TARGET_INCLUDE "hwy/contrib/complex/complex_test.cc"
+#include "hwy/foreach_target.h"
+
+#include "hwy/contrib/complex/complex-inl.h"
+#include "hwy/highway.h"
+#include "hwy/tests/test_util-inl.h"
+
+HWY_BEFORE_NAMESPACE();
+namespace hwy {
+namespace HWY_NAMESPACE {
+
+// Fills `num` complex values with random parts in [-8, 8).
+template <typename T>
+void InitComplex(RandomState& rng, size_t num, T* HWY_RESTRICT parts) {
+  for (size_t i = 0; i < 2 * num; ++i) {
+    parts[i] = static_cast<T>(static_cast<int32_t>(Random32(&rng) & 0xFFFF) -
+                              0x8000) /
+               T(4096);
+  }
+}
+
+// Compares against std::complex; tolerates the rounding differences of FMA.
+template <typename T>
+void AssertComplexNear(const char* what, const std::complex<T> expected,
+                       const T* HWY_RESTRICT actual, size_t i) {
+  const T tolerance = T(4096) * std::numeric_limits<T>::epsilon();
+  const T err_re = std::abs(expected.real() - actual[0]);
+  const T err_im = std::abs(expected.imag() - actual[1]);
+  if (err_re > tolerance || err_im > tolerance) {
+    HWY_ABORT("%s %s: complex %zu expected (%f, %f) actual (%f, %f)\n",
+              hwy::TargetName(HWY_TARGET), what, i,
+              static_cast<double>(expected.real()),
+              static_cast<double>(expected.imag()),
+              static_cast<double>(actual[0]), static_cast<double>(actual[1]));
+  }
+}
+
+template <typename T>
+std::complex<T> ToComplex(const T* HWY_RESTRICT parts) {
+  return std::complex<T>(parts[0], parts[1]);
+}
+
+struct TestComplexOps {
+  template <typename T, class D>
+  HWY_NOINLINE void operator()(T /*unused*/, D d) {
+    const size_t N = Lanes(d);
+    const size_t num = N / 2;
+    auto a = AllocateAligned<T>(N);
+    auto b = AllocateAligned<T>(N);
+    auto c = AllocateAligned<T>(N);
+    auto actual = AllocateAligned<T>(N);
+
+    RandomState rng;
+    for (size_t rep = 0; rep < 100; ++rep) {
+      InitComplex(rng, num, a.get());
+      InitComplex(rng, num, b.get());
+      InitComplex(rng, num, c.get());
+      const auto va = Load(d, a.get());
+      const auto vb = Load(d, b.get());
+      const auto vc = Load(d, c.get());
+
+      Store(MulComplex(d, va, vb), d, actual.get());
+      for (size_t i = 0; i < num; ++i) {
+        const auto expected = ToComplex(&a[2 * i]) * ToComplex(&b[2 * i]);
+        AssertComplexNear("MulComplex", expected, &actual[2 * i], i);
+      }
+
+      Store(MulComplexConj(d, va, vb), d, actual.get());
+      for (size_t i = 0; i < num; ++i) {
+        const auto expected =
+            ToComplex(&a[2 * i]) * std::conj(ToComplex(&b[2 * i]));
+        AssertComplexNear("MulComplexConj", expected, &actual[2 * i], i);
+      }
+
+      Store(MulComplexAdd(d, va, vb, vc), d, actual.get());
+      for (size_t i = 0; i < num; ++i) {
+        const auto expected =
+            ToComplex(&a[2 * i]) * ToComplex(&b[2 * i]) + ToComplex(&c[2 * i]);
+        AssertComplexNear("MulComplexAdd", expected, &actual[2 * i], i);
+      }
+
+      Store(MagnitudeSquared(d, va), d, actual.get());
+      for (size_t i = 0; i < num; ++i) {
+        const T norm = std::norm(ToComplex(&a[2 * i]));
+        AssertComplexNear("MagnitudeSquared", std::complex<T>(norm, norm),
+                          &actual[2 * i], i);
+      }
+    }
+  }
+};
+
+HWY_NOINLINE void TestAllComplexOps() {
+  ForFloatTypes(ForShrinkableVectors<TestComplexOps>());
+}
+
+struct TestComplexArrays {
+  template <typename T, class D>
+  HWY_NOINLINE void operator()(T /*unused*/, D d) {
+    // Includes sizes that are not a multiple of the vector length.
+    for (size_t num = 0; num < 3 * Lanes(d) + 3; ++num) {
+      auto a = AllocateAligned<T>(2 * num + 1);
+      auto b = AllocateAligned<T>(2 * num + 1);
+      auto acc = AllocateAligned<T>(2 * num + 1);
+      auto out = AllocateAligned<T>(2 * num + 1);
+      RandomState rng;
+      InitComplex(rng, num, a.get());
+      InitComplex(rng, num, b.get());
+      InitComplex(rng, num, acc.get());
+
+      MulComplexArrays(d, a.get(), b.get(), num, out.get());
+      for (size_t i = 0; i < num; ++i) {
+        const auto expected = ToComplex(&a[2 * i]) * ToComplex(&b[2 * i]);
+        AssertComplexNear("MulComplexArrays", expected, &out[2 * i], i);
+      }
+
+      MulComplexConjArrays(d, a.get(), b.get(), num, out.get());
+      for (size_t i = 0; i < num; ++i) {
+        const auto expected =
+            ToComplex(&a[2 * i]) * std::conj(ToComplex(&b[2 * i]));
+        AssertComplexNear("MulComplexConjArrays", expected, &out[2 * i], i);
+      }
+
+      for (size_t i = 0; i < 2 * num; ++i) {
+        out[i] = acc[i];
+      }
+      MulAddComplexArrays(d, a.get(), b.get(), num, out.get());
+      for (size_t i = 0; i < num; ++i) {
+        const auto expected = ToComplex(&a[2 * i]) * ToComplex(&b[2 * i]) +
+                              ToComplex(&acc[2 * i]);
+        AssertComplexNear("MulAddComplexArrays", expected, &out[2 * i], i);
+      }
+    }
+  }
+};
+
+HWY_NOINLINE void TestAllComplexArrays() {
+  ForFloatTypes(ForShrinkableVectors<TestComplexArrays>());
+}
+
+// NOLINTNEXTLINE(google-readability-namespace-comments)
+}  // namespace HWY_NAMESPACE
+}  // namespace hwy
+HWY_AFTER_NAMESPACE();
+
+#if HWY_ONCE
+namespace hwy {
+HWY_BEFORE_TEST(HwyComplexTest);
+HWY_EXPORT_AND_TEST_P(HwyComplexTest, TestAllComplexOps);
+HWY_EXPORT_AND_TEST_P(HwyComplexTest, TestAllComplexArrays);
+}  // namespace hwy
+#endif
@@ -0,0 +1,127 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Include guard (still compiled once per target)
+#if defined(HIGHWAY_HWY_CONTRIB_DIVIDE_DIVIDE_INL_H_) == \
+    defined(HWY_TARGET_TOGGLE)
+#ifdef HIGHWAY_HWY_CONTRIB_DIVIDE_DIVIDE_INL_H_
+#undef HIGHWAY_HWY_CONTRIB_DIVIDE_DIVIDE_INL_H_
+#else
+#define HIGHWAY_HWY_CONTRIB_DIVIDE_DIVIDE_INL_H_
+#endif
+
+#include <stddef.h>
+
+#include "hwy/contrib/divide/divisor.h"
+#include "hwy/highway.h"
+
+HWY_BEFORE_NAMESPACE();
+namespace hwy {
+namespace HWY_NAMESPACE {
+
+namespace detail {
+
+template <class D, class V, typename T, HWY_IF_UNSIGNED(T)>
+HWY_INLINE V DivideBy(D d, V n, const Divisor<T>& divisor) {
+  const V t = MulHigh(n, Set(d, divisor.multiplier()));
+  const V sum = Add(t, ShiftRightSame(Sub(n, t), divisor.shift1()));
+  return ShiftRightSame(sum, divisor.shift2());
+}
+
+template <class D, class V, typename T, HWY_IF_SIGNED(T)>
+HWY_INLINE V DivideBy(D d, V n, const Divisor<T>& divisor) {
+  const V sign = Set(d, divisor.sign());
+  const V t = Add(n, MulHigh(n, Set(d, divisor.multiplier())));
+  // Rounds toward zero by adding 1 if n is negative.
+  const V q = Sub(ShiftRightSame(t, divisor.shift1()), BroadcastSignBit(n));
+  return Sub(Xor(q, sign), sign);
+}
+
+}  // namespace detail
+
+/**
+ * Highway SIMD version of n / divisor.divisor() for each lane of 'n', rounding
+ * toward zero like the C++ operator. Only a MulHigh and shifts per vector.
+ *
+ * Valid Lane Types: uint16, uint32, int32, uint64 (if HWY_CAP_INTEGER64)
+ * @return quotient of 'n' divided by 'divisor'
+ */
+template <class D, class V, typename T = TFromD<D>>
+HWY_INLINE V Divide(const D d, V n, const Divisor<T>& divisor) {
+  return detail::DivideBy(d, n, divisor);
+}
+
+/**
+ * Highway SIMD version of n % divisor.divisor() for each lane of 'n'. The
+ * result has the same sign as 'n', as in C++.
+ *
+ * Valid Lane Types: uint16, uint32, int32, uint64 (if HWY_CAP_INTEGER64)
+ * @return remainder of 'n' divided by 'divisor'
+ */
+template <class D, class V, typename T = TFromD<D>>
+HWY_INLINE V Remainder(const D d, V n, const Divisor<T>& divisor) {
+  const V q = Divide(d, n, divisor);
+  return Sub(n, Mul(q, Set(d, divisor.divisor())));
+}
+
+/**
+ * Writes in[i] / divisor.divisor() to out[i] for all i < count. 'in' and 'out'
+ * need not be aligned but must not overlap.
+ */
+template <typename T>
+HWY_NOINLINE void DivideArray(const T* HWY_RESTRICT in, size_t count,
+                              const Divisor<T>& divisor, T* HWY_RESTRICT out) {
+  const HWY_FULL(T) d;
+  const size_t N = Lanes(d);
+  size_t i = 0;
+  if (count >= N) {
+    for (; i <= count - N; i += N) {
+      StoreU(Divide(d, LoadU(d, in + i), divisor), d, out + i);
+    }
+  }
+  // Remainder: one lane at a time.
+  const HWY_CAPPED(T, 1) d1;
+  for (; i < count; ++i) {
+    StoreU(Divide(d1, LoadU(d1, in + i), divisor), d1, out + i);
+  }
+}
+
+/**
+ * Writes in[i] % divisor.divisor() to out[i] for all i < count. Same
+ * requirements as DivideArray.
+ */
+template <typename T>
+HWY_NOINLINE void RemainderArray(const T* HWY_RESTRICT in, size_t count,
+                                 const Divisor<T>& divisor,
+                                 T* HWY_RESTRICT out) {
+  const HWY_FULL(T) d;
+  const size_t N = Lanes(d);
+  size_t i = 0;
+  if (count >= N) {
+    for (; i <= count - N; i += N) {
+      StoreU(Remainder(d, LoadU(d, in + i), divisor), d, out + i);
+    }
+  }
+  const HWY_CAPPED(T, 1) d1;
+  for (; i < count; ++i) {
+    StoreU(Remainder(d1, LoadU(d1, in + i), divisor), d1, out + i);
+  }
+}
+
+// NOLINTNEXTLINE(google-readability-namespace-comments)
+}  // namespace HWY_NAMESPACE
+}  // namespace hwy
+HWY_AFTER_NAMESPACE();
+
+#endif  // HIGHWAY_HWY_CONTRIB_DIVIDE_DIVIDE_INL_H_
@@ -0,0 +1,151 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Compares Divide/DivideArray against the scalar '/' operator.
+
+#undef HWY_TARGET_INCLUDE
+#define HWY_TARGET_INCLUDE "hwy/contrib/divide/divide_benchmark.cc"
+#include "hwy/foreach_target.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "hwy/aligned_allocator.h"
+#include "hwy/contrib/divide/divide-inl.h"
+#include "hwy/highway.h"
+#include "hwy/nanobenchmark.h"
+
+HWY_BEFORE_NAMESPACE();
+namespace hwy {
+namespace HWY_NAMESPACE {
+
+template <typename T>
+class DivideBenchmark {
+ public:
+  // Multiple of the largest vector size.
+  static size_t NumItems() { return 4096; }
+
+  // The divisor is only known at runtime, so the compiler cannot replace the
+  // scalar division with a multiplication.
+  explicit DivideBenchmark(T divisor)
+      : in_(AllocateAligned<T>(NumItems())),
+        out_(AllocateAligned<T>(NumItems())),
+        divisor_(static_cast<T>(divisor * static_cast<T>(Unpredictable1()))),
+        div_(divisor_) {
+    for (size_t i = 0; i < NumItems(); ++i) {
+      in_[i] = static_cast<T>(i * 2654435761u);
+    }
+  }
+
+  FuncOutput Scalar(const size_t num_items) {
+    const T* HWY_RESTRICT in = in_.get();
+    T* HWY_RESTRICT out = out_.get();
+    for (size_t i = 0; i < num_items; ++i) {
+      out[i] = static_cast<T>(in[i] / divisor_);
+    }
+    return static_cast<FuncOutput>(out[num_items - 1]);
+  }
+
+  FuncOutput Vector(const size_t num_items) {
+    DivideArray(in_.get(), num_items, div_, out_.get());
+    return static_cast<FuncOutput>(out_[num_items - 1]);
+  }
+
+  bool Verify(size_t num_items) const {
+    for (size_t i = 0; i < num_items; ++i) {
+      if (out_[i] != static_cast<T>(in_[i] / divisor_)) {
+        fprintf(stderr, "Mismatch at %zu\n", i);
+        return false;
+      }
+    }
+    return true;
+  }
+
+ private:
+  AlignedFreeUniquePtr<T[]> in_;
+  AlignedFreeUniquePtr<T[]> out_;
+  T divisor_;
+  Divisor<T> div_;
+};
+
+// Measures durations, verifies results, prints timings.
+template <typename T>
+void RunBenchmark(const char* caption, T divisor) {
+  const size_t kNumInputs = 1;
+  const size_t num_items =
+      DivideBenchmark<T>::NumItems() * size_t(Unpredictable1());
+  const FuncInput inputs[kNumInputs] = {num_items};
+  Result scalar[kNumInputs];
+  Result vector[kNumInputs];
+
+  DivideBenchmark<T> benchmark(divisor);
+
+  Params p;
+  p.verbose = false;
+  p.max_evals = 7;
+  p.target_rel_mad = 0.002;
+  const size_t num_scalar = MeasureClosure(
+      [&benchmark](const FuncInput input) { return benchmark.Scalar(input); },
+      inputs, kNumInputs, scalar, p);
+  const size_t num_vector = MeasureClosure(
+      [&benchmark](const FuncInput input) { return benchmark.Vector(input); },
+      inputs, kNumInputs, vector, p);
+  if (num_scalar != kNumInputs || num_vector != kNumInputs) {
+    fprintf(stderr, "MeasureClosure failed.\n");
+    return;
+  }
+  if (!benchmark.Verify(num_items)) return;
+
+  const double scalar_cycles = scalar[0].ticks / double(scalar[0].input);
+  const double vector_cycles = vector[0].ticks / double(vector[0].input);
+  printf("%10s: scalar %6.3f vector %6.3f cycles/item (%.1fx)\n", caption,
+         scalar_cycles, vector_cycles, scalar_cycles / vector_cycles);
+}
+
+void RunBenchmarks() {
+  printf("------------------------ %s\n", TargetName(HWY_TARGET));
+  RunBenchmark<uint16_t>("u16 / 7", 7);
+  RunBenchmark<uint32_t>("u32 / 7", 7);
+  RunBenchmark<uint32_t>("u32 / 1000", 1000);
+  RunBenchmark<int32_t>("i32 / -7", -7);
+#if HWY_CAP_INTEGER64
+  RunBenchmark<uint64_t>("u64 / 7", 7);
+#endif
+}
+
+// NOLINTNEXTLINE(google-readability-namespace-comments)
+}  // namespace HWY_NAMESPACE
+}  // namespace hwy
+HWY_AFTER_NAMESPACE();
+
+#if HWY_ONCE
+namespace hwy {
+HWY_EXPORT(RunBenchmarks);
+
+void Run() {
+  for (uint32_t target : SupportedAndGeneratedTargets()) {
+    SetSupportedTargetsForTest(target);
+    HWY_DYNAMIC_DISPATCH(RunBenchmarks)();
+  }
+  SetSupportedTargetsForTest(0);  // Reset the mask afterwards.
+}
+
+}  // namespace hwy
+
+int main(int /*argc*/, char** /*argv*/) {
+  hwy::Run();
+  return 0;
+}
+#endif  // HWY_ONCE
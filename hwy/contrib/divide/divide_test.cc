@@ -0,0 +1,159 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+#undef HWY_TARGET_INCLUDE
+#define HWY_TARGET_INCLUDE "hwy/contrib/divide/divide_test.cc"
+#include "hwy/foreach_target.h"
+
+#include "hwy/contrib/divide/divide-inl.h"
+#include "hwy/highway.h"
+#include "hwy/tests/test_util-inl.h"
+
+HWY_BEFORE_NAMESPACE();
+namespace hwy {
+namespace HWY_NAMESPACE {
+
+// Divisors that exercise the special cases: 1, powers of two, values just
+// above/below them, and the extremes of the lane type. Never zero.
+template <typename T>
+std::vector<T> Divisors(RandomState& rng) {
+  std::vector<T> divisors;
+  const T kMax = LimitsMax<T>();
+  const T kMin = LimitsMin<T>();
+  for (size_t shift = 0; shift < sizeof(T) * 8 - IsSigned<T>(); ++shift) {
+    const T pow2 = static_cast<T>(T(1) << shift);
+    divisors.push_back(pow2);
+    divisors.push_back(static_cast<T>(pow2 + 1));
+    if (pow2 > 2) divisors.push_back(static_cast<T>(pow2 - 1));
+  }
+  for (T d : {T(3), T(5), T(7), T(10), T(641), kMax, T(kMax - 1)}) {
+    divisors.push_back(d);
+  }
+  for (size_t i = 0; i < 100; ++i) {
+    divisors.push_back(static_cast<T>(Random64(&rng)));
+  }
+  if (IsSigned<T>()) {
+    const size_t num_positive = divisors.size();
+    for (size_t i = 0; i < num_positive; ++i) {
+      // Negate via unsigned to avoid overflow for kMin.
+      using TU = MakeUnsigned<T>;
+      divisors.push_back(static_cast<T>(TU(0) - static_cast<TU>(divisors[i])));
+    }
+    divisors.push_back(kMin);
+  }
+  std::vector<T> nonzero;
+  for (T d : divisors) {
+    if (d != 0) nonzero.push_back(d);
+  }
+  return nonzero;
+}
+
+struct TestDivide {
+  template <typename T, class D>
+  HWY_NOINLINE void operator()(T /*unused*/, D d) {
+    RandomState rng;
+    const size_t N = Lanes(d);
+    auto in = AllocateAligned<T>(N);
+    auto expected_q = AllocateAligned<T>(N);
+    auto expected_r = AllocateAligned<T>(N);
+
+    const T kEdge[] = {T(0), T(1), T(2), LimitsMax<T>(),
+                       static_cast<T>(LimitsMax<T>() - 1), LimitsMin<T>(),
+                       static_cast<T>(LimitsMin<T>() + 1)};
+    for (const T divisor : Divisors<T>(rng)) {
+      const Divisor<T> div(divisor);
+      for (size_t rep = 0; rep < 10; ++rep) {
+        for (size_t i = 0; i < N; ++i) {
+          in[i] = (rep == 0) ? kEdge[i % 7] : static_cast<T>(Random64(&rng));
+          // Quotient is not representable.
+          if (IsSigned<T>() && in[i] == LimitsMin<T>() && divisor == T(-1)) {
+            in[i] = 0;
+          }
+          expected_q[i] = static_cast<T>(in[i] / divisor);
+          expected_r[i] = static_cast<T>(in[i] % divisor);
+        }
+        const auto v = Load(d, in.get());
+        HWY_ASSERT_VEC_EQ(d, expected_q.get(), Divide(d, v, div));
+        HWY_ASSERT_VEC_EQ(d, expected_r.get(), Remainder(d, v, div));
+      }
+    }
+  }
+};
+
+HWY_NOINLINE void TestAllDivide() {
+  ForPartialVectors<TestDivide> test;
+  test(uint16_t());
+  test(uint32_t());
+  test(int32_t());
+#if HWY_CAP_INTEGER64
+  test(uint64_t());
+#endif
+}
+
+struct TestDivideArray {
+  template <typename T>
+  void operator()(T /*unused*/) const {
+    RandomState rng;
+    // Not a multiple of the vector size, to cover the remainder loop.
+    const size_t kCount = 1003;
+    auto in = AllocateAligned<T>(kCount);
+    auto out = AllocateAligned<T>(kCount);
+    for (size_t i = 0; i < kCount; ++i) {
+      in[i] = static_cast<T>(Random32(&rng));
+    }
+
+    // All nonzero, also for unsigned T.
+    for (T divisor : {T(1), T(3), T(16), T(1000), T(-7)}) {
+      const Divisor<T> div(divisor);
+      for (size_t count : {size_t(0), size_t(1), kCount}) {
+        DivideArray(in.get(), count, div, out.get());
+        for (size_t i = 0; i < count; ++i) {
+          HWY_ASSERT_EQ(static_cast<T>(in[i] / divisor), out[i]);
+        }
+        RemainderArray(in.get(), count, div, out.get());
+        for (size_t i = 0; i < count; ++i) {
+          HWY_ASSERT_EQ(static_cast<T>(in[i] % divisor), out[i]);
+        }
+      }
+    }
+  }
+};
+
+HWY_NOINLINE void TestAllDivideArray() {
+  const TestDivideArray test;
+  test(uint16_t());
+  test(uint32_t());
+  test(int32_t());
+#if HWY_CAP_INTEGER64
+  test(uint64_t());
+#endif
+}
+
+// NOLINTNEXTLINE(google-readability-namespace-comments)
+}  // namespace HWY_NAMESPACE
+}  // namespace hwy
+HWY_AFTER_NAMESPACE();
+
+#if HWY_ONCE
+namespace hwy {
+HWY_BEFORE_TEST(HwyDivideTest);
+HWY_EXPORT_AND_TEST_P(HwyDivideTest, TestAllDivide);
+HWY_EXPORT_AND_TEST_P(HwyDivideTest, TestAllDivideArray);
+}  // namespace hwy
+#endif
@@ -0,0 +1,131 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef HIGHWAY_HWY_CONTRIB_DIVIDE_DIVISOR_H_
+#define HIGHWAY_HWY_CONTRIB_DIVIDE_DIVISOR_H_
+
+// Precomputed constants for dividing by a runtime-invariant integer. This part
+// is target-independent; see divide-inl.h for the SIMD Divide/Remainder.
+
+#include <stdint.h>
+
+#include "hwy/base.h"
+
+namespace hwy {
+namespace detail {
+
+// Returns ceil(log2(x)) for x != 0.
+static inline int CeilLog2Nonzero(uint64_t x) {
+  int bits = 0;
+  while (bits < 64 && (uint64_t{1} << bits) < x) ++bits;
+  return bits;
+}
+
+// Returns floor(((hi << 64) + lo) / d) for hi < d, i.e. a quotient that fits in
+// 64 bits. Bitwise long division, only called once per Divisor.
+static inline uint64_t Divide128By64(uint64_t hi, uint64_t lo, uint64_t d) {
+  uint64_t quotient = 0;
+  for (int i = 63; i >= 0; --i) {
+    const bool carry = (hi >> 63) != 0;
+    hi = (hi << 1) | ((lo >> i) & 1);
+    quotient <<= 1;
+    if (carry || hi >= d) {
+      hi -= d;
+      quotient |= 1;
+    }
+  }
+  return quotient;
+}
+
+}  // namespace detail
+
+// Magic multiplier and shift counts which turn division by a constant into a
+// MulHigh and shifts (Granlund/Montgomery, "Division by invariant integers
+// using multiplication", 1994). Construct once per divisor, then pass to the
+// Divide/Remainder functions in divide-inl.h. Valid lane types: uint16_t,
+// uint32_t, uint64_t (only if HWY_CAP_INTEGER64) and int32_t.
+template <typename T>
+class Divisor {
+  static_assert(IsSame<T, uint16_t>() || IsSame<T, uint32_t>() ||
+                    IsSame<T, uint64_t>() || IsSame<T, int32_t>(),
+                "Divisor only supports u16/u32/u64/i32");
+  static constexpr int kBits = static_cast<int>(sizeof(T) * 8);
+
+ public:
+  // Division by zero is undefined; the divisor must be nonzero.
+  explicit Divisor(T divisor) : divisor_(divisor) {
+    HWY_ASSERT(divisor != 0);
+    if (IsSigned<T>()) {
+      InitSigned();
+    } else {
+      InitUnsigned();
+    }
+  }
+
+  T divisor() const { return divisor_; }
+  T multiplier() const { return multiplier_; }
+  int shift1() const { return shift1_; }
+  int shift2() const { return shift2_; }
+  // All-ones if the (signed) divisor is negative, otherwise zero.
+  T sign() const { return sign_; }
+
+ private:
+  static uint64_t UnsignedMultiplier(SizeTag<8> /* tag */, uint64_t d,
+                                     int log2) {
+    // 2^log2 - d, modulo 2^64 (log2 may be 64).
+    const uint64_t pow2 = (log2 == 64) ? 0 : (uint64_t{1} << log2);
+    return detail::Divide128By64(pow2 - d, 0, d) + 1;
+  }
+  template <size_t kSize>
+  static uint64_t UnsignedMultiplier(SizeTag<kSize> /* tag */, uint64_t d,
+                                     int log2) {
+    return (((uint64_t{1} << log2) - d) << (kSize * 8)) / d + 1;
+  }
+
+  // q = (t + ((n - t) >> shift1)) >> shift2, where t = MulHigh(n, multiplier).
+  void InitUnsigned() {
+    const uint64_t d = static_cast<uint64_t>(divisor_);
+    const int log2 = detail::CeilLog2Nonzero(d);
+    // multiplier = floor(2^kBits * (2^log2 - d) / d) + 1, which fits in T.
+    const uint64_t m = UnsignedMultiplier(SizeTag<sizeof(T)>(), d, log2);
+    multiplier_ = static_cast<T>(m);
+    shift1_ = HWY_MIN(log2, 1);
+    shift2_ = HWY_MAX(log2 - 1, 0);
+    sign_ = 0;
+  }
+
+  // q = ((n + MulHigh(n, multiplier)) >> shift1) - (n >> (kBits - 1)), then
+  // negated via sign. Only used for 32-bit lanes.
+  void InitSigned() {
+    const int64_t d = static_cast<int64_t>(divisor_);
+    const uint64_t abs_d = static_cast<uint64_t>(d < 0 ? -d : d);
+    const int log2 = HWY_MAX(detail::CeilLog2Nonzero(abs_d), 1);
+    // multiplier = 1 + floor(2^(kBits + log2 - 1) / |d|) - 2^kBits, wrapped.
+    const uint64_t m = 1 + (uint64_t{1} << (kBits + log2 - 1)) / abs_d;
+    multiplier_ = static_cast<T>(static_cast<uint32_t>(m));
+    shift1_ = log2 - 1;
+    shift2_ = 0;
+    sign_ = static_cast<T>(d < 0 ? -1 : 0);
+  }
+
+  T divisor_;
+  T multiplier_;
+  int shift1_;
+  int shift2_;
+  T sign_;
+};
+
+}  // namespace hwy
+
+#endif  // HIGHWAY_HWY_CONTRIB_DIVIDE_DIVISOR_H_
@@ -745,8 +745,15 @@ struct ExpImpl<float> {
   // Sets the exponent of 'x' to 2^e.
   template <class D, class V, class VI32>
   HWY_INLINE V LoadExpShortRange(D d, V x, VI32 e) {
+    // AVX3 scales with a single instruction; the short range otherwise only
+    // requires two multiplications instead of the full-range LdExp.
+#if HWY_TARGET <= HWY_AVX3
+    (void)d;
+    return LdExp(x, e);
+#else
     const VI32 y = ShiftRight<1>(e);
     return Mul(Mul(x, Pow2I(d, y)), Pow2I(d, Sub(e, y)));
+#endif
   }
 
   template <class D, class V, class VI32>
@@ -826,8 +833,13 @@ struct ExpImpl<double> {
   // Sets the exponent of 'x' to 2^e.
   template <class D, class V, class VI32>
   HWY_INLINE V LoadExpShortRange(D d, V x, VI32 e) {
+#if HWY_TARGET <= HWY_AVX3
+    (void)d;
+    return LdExp(x, PromoteTo(Rebind<int64_t, D>(), e));
+#else
     const VI32 y = ShiftRight<1>(e);
     return Mul(Mul(x, Pow2I(d, y)), Pow2I(d, Sub(e, y)));
+#endif
   }
 
   template <class D, class V, class VI32>
@@ -889,16 +901,36 @@ HWY_INLINE V Log(const D d, V x) {
   const V kLn2Lo     = Set(d, (kIsF32 ? 9.0580006145e-6f :
                                         1.90821492927058770002e-10));
   const V kOne       = Set(d, +1.0);
-  const V kMinNormal = Set(d, (kIsF32 ? 1.175494351e-38f :
-                                        2.2250738585072014e-308   ));
-  const V kScale     = Set(d, (kIsF32 ? 3.355443200e+7f  :
-                                        1.8014398509481984e+16    ));
 
   // Integer Constants
   const Rebind<MakeSigned<LaneType>, D> di;
   using VI = decltype(Zero(di));
-  const VI kLowerBits = Set(di, (kIsF32 ? 0x00000000L : 0xFFFFFFFFLL));
+  // sqrt(2) / 2, truncated to 20 mantissa bits for double.
   const VI kMagic     = Set(di, (kIsF32 ? 0x3F3504F3L : 0x3FE6A09E00000000LL));
+  // clang-format on
+
+  // Split x into y * 2^exp with y in [sqrt(2) / 2, sqrt(2)).
+  V exp;
+  V y;
+#if HWY_TARGET <= HWY_AVX3
+  // GetExponent and LdExp are single instructions that also handle subnormals,
+  // hence kAllowSubnormals does not matter. They yield a mantissa in [1, 2),
+  // which is halved if it is at least sqrt(2).
+  const V exp1 = GetExponent(x);
+  const V mantissa = LdExp(x, ConvertTo(di, Neg(exp1)));
+  // kMagic with the exponent incremented, i.e. sqrt(2).
+  const V kSqrt2 = BitCast(
+      d, Add(kMagic, Set(di, (kIsF32 ? 0x00800000L : 0x0010000000000000LL))));
+  const auto is_large = Ge(mantissa, kSqrt2);
+  y = IfThenElse(is_large, Mul(mantissa, Set(d, 0.5)), mantissa);
+  exp = IfThenElse(is_large, Add(exp1, kOne), exp1);
+#else
+  // clang-format off
+  const V kMinNormal = Set(d, (kIsF32 ? 1.175494351e-38f :
+                                        2.2250738585072014e-308   ));
+  const V kScale     = Set(d, (kIsF32 ? 3.355443200e+7f  :
+                                        1.8014398509481984e+16    ));
+  const VI kLowerBits = Set(di, (kIsF32 ? 0x00000000L : 0xFFFFFFFFLL));
   const VI kExpMask   = Set(di, (kIsF32 ? 0x3F800000L : 0x3FF0000000000000LL));
   const VI kExpScale  = Set(di, (kIsF32 ? -25         : -54));
   const VI kManMask   = Set(di, (kIsF32 ? 0x7FFFFFL   : 0xFFFFF00000000LL));
@@ -906,7 +938,6 @@ HWY_INLINE V Log(const D d, V x) {
 
   // Scale up 'x' so that it is no longer denormalized.
   VI exp_bits;
-  V exp;
   if (kAllowSubnormals == true) {
     const auto is_denormal = Lt(x, kMinNormal);
     x = IfThenElse(is_denormal, Mul(x, kScale), x);
@@ -924,8 +955,9 @@ HWY_INLINE V Log(const D d, V x) {
   }
 
   // Renormalize.
-  const V y = Or(And(x, BitCast(d, kLowerBits)),
-                 BitCast(d, Add(And(exp_bits, kManMask), kMagic)));
+  y = Or(And(x, BitCast(d, kLowerBits)),
+         BitCast(d, Add(And(exp_bits, kManMask), kMagic)));
+#endif
 
   // Approximate and reconstruct.
   const V ym1 = Sub(y, kOne);
@@ -944,8 +976,9 @@ HWY_INLINE V Acos(const D d, V x) {
 
   const V kZero = Zero(d);
   const V kHalf = Set(d, +0.5);
-  const V kPi = Set(d, +3.14159265358979323846264);
-  const V kPiOverTwo = Set(d, +1.57079632679489661923132169);
+  const V kPi = Set(d, static_cast<TFromD<D>>(+3.14159265358979323846264));
+  const V kPiOverTwo =
+      Set(d, static_cast<TFromD<D>>(+1.57079632679489661923132169));
 
   const V sign_x = And(SignBit(d), x);
   const V abs_x = Xor(x, sign_x);
@@ -967,7 +1000,7 @@ HWY_INLINE V Acos(const D d, V x) {
 template <class D, class V>
 HWY_INLINE V Acosh(const D d, V x) {
   const V kLarge = Set(d, 268435456.0);
-  const V kLog2 = Set(d, 0.693147180559945286227);
+  const V kLog2 = Set(d, static_cast<TFromD<D>>(0.693147180559945286227));
   const V kOne = Set(d, +1.0);
   const V kTwo = Set(d, +2.0);
 
@@ -995,7 +1028,8 @@ HWY_INLINE V Asin(const D d, V x) {
 
   const V kHalf = Set(d, +0.5);
   const V kTwo = Set(d, +2.0);
-  const V kPiOverTwo = Set(d, +1.57079632679489661923132169);
+  const V kPiOverTwo =
+      Set(d, static_cast<TFromD<D>>(+1.57079632679489661923132169));
 
   const V sign_x = And(SignBit(d), x);
   const V abs_x = Xor(x, sign_x);
@@ -1014,7 +1048,7 @@ template <class D, class V>
 HWY_INLINE V Asinh(const D d, V x) {
   const V kSmall = Set(d, 1.0 / 268435456.0);
   const V kLarge = Set(d, 268435456.0);
-  const V kLog2 = Set(d, 0.693147180559945286227);
+  const V kLog2 = Set(d, static_cast<TFromD<D>>(0.693147180559945286227));
   const V kOne = Set(d, +1.0);
   const V kTwo = Set(d, +2.0);
 
@@ -1046,7 +1080,8 @@ HWY_INLINE V Atan(const D d, V x) {
   using LaneType = LaneType<V>;
 
   const V kOne = Set(d, +1.0);
-  const V kPiOverTwo = Set(d, +1.57079632679489661923132169);
+  const V kPiOverTwo =
+      Set(d, static_cast<TFromD<D>>(+1.57079632679489661923132169));
 
   const V sign = And(SignBit(d), x);
   const V abs_x = Xor(x, sign);
@@ -1075,7 +1110,7 @@ HWY_INLINE V Cos(const D d, V x) {
   impl::CosSinImpl<LaneType> impl;
 
   // Float Constants
-  const V kOneOverPi = Set(d, 0.31830988618379067153);
+  const V kOneOverPi = Set(d, static_cast<TFromD<D>>(0.31830988618379067153));
 
   // Integer Constants
   const Rebind<int32_t, D> di32;
@@ -1101,7 +1136,8 @@ HWY_INLINE V Exp(const D d, V x) {
   const V kLowerBound  = Set(d, (sizeof(LaneType) == 4 ? -104.0 : -1000.0));
   const V kNegZero     = Set(d, -0.0);
   const V kOne         = Set(d, +1.0);
-  const V kOneOverLog2 = Set(d, +1.442695040888963407359924681);
+  const V kOneOverLog2 =
+      Set(d, static_cast<TFromD<D>>(+1.442695040888963407359924681));
   // clang-format on
 
   impl::ExpImpl<LaneType> impl;
@@ -1123,11 +1159,13 @@ HWY_INLINE V Expm1(const D d, V x) {
   // clang-format off
   const V kHalf        = Set(d, +0.5);
   const V kLowerBound  = Set(d, (sizeof(LaneType) == 4 ? -104.0 : -1000.0));
-  const V kLn2Over2    = Set(d, +0.346573590279972654708616);
+  const V kLn2Over2    =
+      Set(d, static_cast<TFromD<D>>(+0.346573590279972654708616));
   const V kNegOne      = Set(d, -1.0);
   const V kNegZero     = Set(d, -0.0);
   const V kOne         = Set(d, +1.0);
-  const V kOneOverLog2 = Set(d, +1.442695040888963407359924681);
+  const V kOneOverLog2 =
+      Set(d, static_cast<TFromD<D>>(+1.442695040888963407359924681));
   // clang-format on
 
   impl::ExpImpl<LaneType> impl;
@@ -1150,7 +1188,8 @@ HWY_INLINE V Log(const D d, V x) {
 
 template <class D, class V>
 HWY_INLINE V Log10(const D d, V x) {
-  return Mul(Log(d, x), Set(d, 0.4342944819032518276511));
+  return Mul(Log(d, x),
+             Set(d, static_cast<TFromD<D>>(0.4342944819032518276511)));
 }
 
 template <class D, class V>
@@ -1167,7 +1206,8 @@ HWY_INLINE V Log1p(const D d, V x) {
 
 template <class D, class V>
 HWY_INLINE V Log2(const D d, V x) {
-  return Mul(Log(d, x), Set(d, 1.44269504088896340735992));
+  return Mul(Log(d, x),
+             Set(d, static_cast<TFromD<D>>(1.44269504088896340735992)));
 }
 
 template <class D, class V>
@@ -1176,7 +1216,7 @@ HWY_INLINE V Sin(const D d, V x) {
   impl::CosSinImpl<LaneType> impl;
 
   // Float Constants
-  const V kOneOverPi = Set(d, 0.31830988618379067153);
+  const V kOneOverPi = Set(d, static_cast<TFromD<D>>(0.31830988618379067153));
   const V kHalf = Set(d, 0.5);
 
   // Integer Constants
@@ -1209,7 +1249,7 @@ HWY_INLINE V Sinh(const D d, V x) {
 
 template <class D, class V>
 HWY_INLINE V Tanh(const D d, V x) {
-  const V kLimit = Set(d, 18.714973875);
+  const V kLimit = Set(d, static_cast<TFromD<D>>(18.714973875));
   const V kOne = Set(d, +1.0);
   const V kTwo = Set(d, +2.0);
 
@@ -115,7 +115,8 @@ void TestMath(const std::string name, T (*fx1)(T), Vec<D> (*fxN)(D, Vec<D>),
     template <class T, class D>                                           \
     HWY_NOINLINE void operator()(T, D d) {                                \
       if (sizeof(T) == 4) {                                               \
-        TestMath<T, D>(HWY_STR(NAME), F32x1, F32xN, d, F32_MIN, F32_MAX,  \
+        TestMath<T, D>(HWY_STR(NAME), F32x1, F32xN, d,                    \
+                       static_cast<T>(F32_MIN), static_cast<T>(F32_MAX),  \
                        F32_ERROR);                                        \
       } else {                                                            \
         TestMath<T, D>(HWY_STR(NAME), F64x1, F64xN, d, F64_MIN, F64_MAX,  \
@@ -0,0 +1,238 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Include guard (still compiled once per target)
+#if defined(HIGHWAY_HWY_CONTRIB_TRANSPOSE_TRANSPOSE_INL_H_) == \
+    defined(HWY_TARGET_TOGGLE)
+#ifdef HIGHWAY_HWY_CONTRIB_TRANSPOSE_TRANSPOSE_INL_H_
+#undef HIGHWAY_HWY_CONTRIB_TRANSPOSE_TRANSPOSE_INL_H_
+#else
+#define HIGHWAY_HWY_CONTRIB_TRANSPOSE_TRANSPOSE_INL_H_
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "hwy/aligned_allocator.h"
+#include "hwy/highway.h"
+
+HWY_BEFORE_NAMESPACE();
+namespace hwy {
+namespace HWY_NAMESPACE {
+
+namespace detail {
+
+// Selects how to transpose kN x kN matrices whose rows occupy kN lanes:
+// 0: via memory; works for any vector size.
+// 1: each row is one 128-bit block: blockwise InterleaveLower/Upper.
+// 2: each row is one 256-bit vector: as 1 for each half, then swap blocks.
+// 3: rows of at most 128 bits: swaps half-rows via OddEven and lane shifts,
+//    which only move data within a row and thus work for any vector size.
+#if HWY_TARGET == HWY_SCALAR
+template <size_t kN, class D>
+constexpr size_t TransposeStrategy(D /* tag */) {
+  return 0;
+}
+#elif HWY_TARGET == HWY_SVE || HWY_TARGET == HWY_SVE2 || HWY_TARGET == HWY_RVV
+// 128-bit blocks are emulated and thus expensive to shuffle.
+template <size_t kN, class D>
+constexpr size_t TransposeStrategy(D d) {
+  return (kN * sizeof(TFromD<D>) <= 16 && MaxLanes(d) >= kN) ? 3 : 0;
+}
+#else
+template <size_t kN, class D>
+constexpr size_t TransposeStrategy(D d) {
+  return (kN * sizeof(TFromD<D>) == 16 && MaxLanes(d) >= kN)   ? 1
+         : (kN * sizeof(TFromD<D>) == 32 && MaxLanes(d) == kN) ? 2
+         : (kN * sizeof(TFromD<D>) < 16 && MaxLanes(d) >= kN)  ? 3
+                                                               : 0;
+}
+#endif
+
+template <size_t kN, class D, class V>
+HWY_INLINE void TransposeRows(hwy::SizeTag<0> /* tag */, D d,
+                              V* const* HWY_RESTRICT rows) {
+  using T = TFromD<D>;
+  const size_t N = Lanes(d);
+  HWY_DASSERT(N % kN == 0);
+#if HWY_TARGET == HWY_SVE || HWY_TARGET == HWY_SVE2 || HWY_TARGET == HWY_RVV
+  // MaxLanes is far larger than the actual vectors, too much for the stack.
+  const AlignedFreeUniquePtr<T[]> storage = AllocateAligned<T>(2 * kN * N);
+  T* HWY_RESTRICT in = storage.get();
+  T* HWY_RESTRICT out = in + kN * N;
+#else
+  HWY_ALIGN T in[kN * MaxLanes(d)];
+  HWY_ALIGN T out[kN * MaxLanes(d)];
+#endif
+  for (size_t r = 0; r < kN; ++r) {
+    Store(*rows[r], d, in + r * N);
+  }
+  for (size_t group = 0; group < N; group += kN) {
+    for (size_t r = 0; r < kN; ++r) {
+      for (size_t c = 0; c < kN; ++c) {
+        out[r * N + group + c] = in[c * N + group + r];
+      }
+    }
+  }
+  for (size_t r = 0; r < kN; ++r) {
+    *rows[r] = Load(d, out + r * N);
+  }
+}
+
+// Each round interleaves row i with row i + kN/2; after log2(kN) rounds, row i
+// holds column i.
+template <size_t kN, class D, class V>
+HWY_INLINE void TransposeRows(hwy::SizeTag<1> /* tag */, D d,
+                              V* const* HWY_RESTRICT rows) {
+  for (size_t round = 1; round < kN; round *= 2) {
+    V interleaved[kN];
+    for (size_t i = 0; i < kN / 2; ++i) {
+      interleaved[2 * i + 0] = InterleaveLower(d, *rows[i], *rows[i + kN / 2]);
+      interleaved[2 * i + 1] = InterleaveUpper(d, *rows[i], *rows[i + kN / 2]);
+    }
+    for (size_t i = 0; i < kN; ++i) {
+      *rows[i] = interleaved[i];
+    }
+  }
+}
+
+template <size_t kN, class D, class V>
+HWY_INLINE void TransposeRows(hwy::SizeTag<2> /* tag */, D d,
+                              V* const* HWY_RESTRICT rows) {
+  constexpr size_t kHalf = kN / 2;
+  // Transpose the four (kN/2)^2 quadrants, each within 128-bit blocks.
+  TransposeRows<kHalf>(hwy::SizeTag<1>(), d, rows);
+  TransposeRows<kHalf>(hwy::SizeTag<1>(), d, rows + kHalf);
+  // Row i < kHalf now holds column i of the top quadrants in its lower block
+  // and column i + kHalf in its upper block; row i + kHalf likewise for the
+  // bottom quadrants.
+  for (size_t i = 0; i < kHalf; ++i) {
+    const V top = *rows[i];
+    const V bottom = *rows[i + kHalf];
+    *rows[i] = ConcatLowerLower(d, bottom, top);
+    *rows[i + kHalf] = ConcatUpperUpper(d, bottom, top);
+  }
+}
+
+#if HWY_TARGET != HWY_SCALAR
+
+template <size_t kBytes>
+struct TransposeUnitT;
+template <>
+struct TransposeUnitT<1> {
+  using type = uint8_t;
+};
+template <>
+struct TransposeUnitT<2> {
+  using type = uint16_t;
+};
+template <>
+struct TransposeUnitT<4> {
+  using type = uint32_t;
+};
+template <>
+struct TransposeUnitT<8> {
+  using type = uint64_t;
+};
+
+// Viewing each kHalf lanes as one lane of type TU, swaps the odd lanes of
+// *upper with the even lanes of *lower (the upper-right and lower-left
+// quadrants of each 2*kHalf square).
+template <size_t kHalf, class D, class V>
+HWY_INLINE void SwapQuadrants(D d, V* HWY_RESTRICT upper,
+                              V* HWY_RESTRICT lower) {
+  using TU = typename TransposeUnitT<kHalf * sizeof(TFromD<D>)>::type;
+  const Repartition<TU, D> du;
+  const auto u = BitCast(du, *upper);
+  const auto l = BitCast(du, *lower);
+  *upper = BitCast(d, OddEven(ShiftLeftLanes<1>(du, l), u));
+  *lower = BitCast(d, OddEven(l, ShiftRightLanes<1>(du, u)));
+}
+
+template <size_t kN, class D, class V>
+HWY_INLINE void TransposeQuadrants(hwy::SizeTag<0> /* tag */, D /* d */,
+                                   V* const* HWY_RESTRICT /* rows */) {}
+
+// Swaps the off-diagonal quadrants of each 2*kHalf square, then recurses into
+// the quadrants, all of which are handled together by halving kHalf.
+template <size_t kN, size_t kHalf, class D, class V>
+HWY_INLINE void TransposeQuadrants(hwy::SizeTag<kHalf> /* tag */, D d,
+                                   V* const* HWY_RESTRICT rows) {
+  for (size_t r = 0; r < kN; ++r) {
+    if ((r & kHalf) == 0) {
+      SwapQuadrants<kHalf>(d, rows[r], rows[r + kHalf]);
+    }
+  }
+  TransposeQuadrants<kN>(hwy::SizeTag<kHalf / 2>(), d, rows);
+}
+
+template <size_t kN, class D, class V>
+HWY_INLINE void TransposeRows(hwy::SizeTag<3> /* tag */, D d,
+                              V* const* HWY_RESTRICT rows) {
+  TransposeQuadrants<kN>(hwy::SizeTag<kN / 2>(), d, rows);
+}
+
+#endif  // HWY_TARGET != HWY_SCALAR
+
+template <size_t kN, class D, class V>
+HWY_INLINE void TransposeRows(D d, V* const* HWY_RESTRICT rows) {
+  TransposeRows<kN>(hwy::SizeTag<TransposeStrategy<kN>(D())>(), d, rows);
+}
+
+}  // namespace detail
+
+// In-place transposes of square matrices held in registers. Each group of kN
+// consecutive lanes (kN = 4, 8 or 16) of the kN input vectors forms one
+// kN x kN matrix whose rows are the vectors; afterwards, lane c of vector r in
+// each group holds the former lane r of vector c. Lanes(d) must be a multiple
+// of kN, which rules out HWY_SCALAR. Supports all lane types.
+//
+// Groups of at most 128 bits stay in registers on all targets: those the size
+// of a block (e.g. 4x4 of 32-bit lanes) use InterleaveLower/Upper where blocks
+// are cheap to shuffle, otherwise log2(kN) rounds of OddEven and lane shifts.
+// Groups of 256 bits use one additional block swap when they fill an AVX2/AVX3
+// vector. Other shapes (e.g. 16x16 of 32-bit lanes on SVE) go through memory,
+// which is heap-allocated on SVE/RVV.
+//
+// The rows are passed as separate references rather than an array of vectors
+// because SVE and RVV vectors are sizeless and thus cannot be array elements.
+
+template <class D, class V>
+HWY_API void Transpose4x4(D d, V& v0, V& v1, V& v2, V& v3) {
+  V* const rows[4] = {&v0, &v1, &v2, &v3};
+  detail::TransposeRows<4>(d, rows);
+}
+
+template <class D, class V>
+HWY_API void Transpose8x8(D d, V& v0, V& v1, V& v2, V& v3, V& v4, V& v5,
+                          V& v6, V& v7) {
+  V* const rows[8] = {&v0, &v1, &v2, &v3, &v4, &v5, &v6, &v7};
+  detail::TransposeRows<8>(d, rows);
+}
+
+template <class D, class V>
+HWY_API void Transpose16x16(D d, V& v0, V& v1, V& v2, V& v3, V& v4, V& v5,
+                            V& v6, V& v7, V& v8, V& v9, V& v10, V& v11,
+                            V& v12, V& v13, V& v14, V& v15) {
+  V* const rows[16] = {&v0, &v1, &v2,  &v3,  &v4,  &v5,  &v6,  &v7,
+                       &v8, &v9, &v10, &v11, &v12, &v13, &v14, &v15};
+  detail::TransposeRows<16>(d, rows);
+}
+
+// NOLINTNEXTLINE(google-readability-namespace-comments)
+}  // namespace HWY_NAMESPACE
+}  // namespace hwy
+HWY_AFTER_NAMESPACE();
+
+#endif  // HIGHWAY_HWY_CONTRIB_TRANSPOSE_TRANSPOSE_INL_H_
@@ -0,0 +1,204 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#undef HWY_TARGET_INCLUDE
+#define HWY_TARGET_INCLUDE "hwy/contrib/transpose/transpose_test.cc"
+#include "hwy/foreach_target.h"
+
+#include "hwy/contrib/transpose/transpose-inl.h"
+#include "hwy/highway.h"
+#include "hwy/tests/test_util-inl.h"
+
+HWY_BEFORE_NAMESPACE();
+namespace hwy {
+namespace HWY_NAMESPACE {
+
+// Fills kN rows of N lanes and the expected result of transposing each group
+// of kN lanes.
+template <typename T>
+void InitTranspose(size_t kN, size_t N, T* HWY_RESTRICT in,
+                   T* HWY_RESTRICT expected) {
+  RandomState rng;
+  for (size_t i = 0; i < kN * N; ++i) {
+    in[i] = static_cast<T>(Random32(&rng) & 0x7FFF);
+  }
+  for (size_t group = 0; group < N; group += kN) {
+    for (size_t r = 0; r < kN; ++r) {
+      for (size_t c = 0; c < kN; ++c) {
+        expected[r * N + group + c] = in[c * N + group + r];
+      }
+    }
+  }
+}
+
+struct TestTranspose4x4 {
+  template <typename T, class D>
+  HWY_NOINLINE void operator()(T /*unused*/, D d) {
+    const size_t N = Lanes(d);
+    if (N % 4 != 0) return;
+    auto in = AllocateAligned<T>(4 * N);
+    auto expected = AllocateAligned<T>(4 * N);
+    InitTranspose(4, N, in.get(), expected.get());
+
+    auto v0 = Load(d, in.get() + 0 * N);
+    auto v1 = Load(d, in.get() + 1 * N);
+    auto v2 = Load(d, in.get() + 2 * N);
+    auto v3 = Load(d, in.get() + 3 * N);
+    Transpose4x4(d, v0, v1, v2, v3);
+    HWY_ASSERT_VEC_EQ(d, expected.get() + 0 * N, v0);
+    HWY_ASSERT_VEC_EQ(d, expected.get() + 1 * N, v1);
+    HWY_ASSERT_VEC_EQ(d, expected.get() + 2 * N, v2);
+    HWY_ASSERT_VEC_EQ(d, expected.get() + 3 * N, v3);
+  }
+};
+
+HWY_NOINLINE void TestAllTranspose4x4() {
+  ForAllTypes(ForPartialVectors<TestTranspose4x4>());
+}
+
+struct TestTranspose8x8 {
+  template <typename T, class D>
+  HWY_NOINLINE void operator()(T /*unused*/, D d) {
+    const size_t N = Lanes(d);
+    if (N % 8 != 0) return;
+    auto in = AllocateAligned<T>(8 * N);
+    auto expected = AllocateAligned<T>(8 * N);
+    InitTranspose(8, N, in.get(), expected.get());
+
+    auto v0 = Load(d, in.get() + 0 * N);
+    auto v1 = Load(d, in.get() + 1 * N);
+    auto v2 = Load(d, in.get() + 2 * N);
+    auto v3 = Load(d, in.get() + 3 * N);
+    auto v4 = Load(d, in.get() + 4 * N);
+    auto v5 = Load(d, in.get() + 5 * N);
+    auto v6 = Load(d, in.get() + 6 * N);
+    auto v7 = Load(d, in.get() + 7 * N);
+    Transpose8x8(d, v0, v1, v2, v3, v4, v5, v6, v7);
+    HWY_ASSERT_VEC_EQ(d, expected.get() + 0 * N, v0);
+    HWY_ASSERT_VEC_EQ(d, expected.get() + 1 * N, v1);
+    HWY_ASSERT_VEC_EQ(d, expected.get() + 2 * N, v2);
+    HWY_ASSERT_VEC_EQ(d, expected.get() + 3 * N, v3);
+    HWY_ASSERT_VEC_EQ(d, expected.get() + 4 * N, v4);
+    HWY_ASSERT_VEC_EQ(d, expected.get() + 5 * N, v5);
+    HWY_ASSERT_VEC_EQ(d, expected.get() + 6 * N, v6);
+    HWY_ASSERT_VEC_EQ(d, expected.get() + 7 * N, v7);
+  }
+};
+
+HWY_NOINLINE void TestAllTranspose8x8() {
+  ForAllTypes(ForPartialVectors<TestTranspose8x8>());
+}
+
+struct TestTranspose16x16 {
+  template <typename T, class D>
+  HWY_NOINLINE void operator()(T /*unused*/, D d) {
+    const size_t N = Lanes(d);
+    if (N % 16 != 0) return;
+    auto in = AllocateAligned<T>(16 * N);
+    auto expected = AllocateAligned<T>(16 * N);
+    InitTranspose(16, N, in.get(), expected.get());
+
+    auto v0 = Load(d, in.get() + 0 * N);
+    auto v1 = Load(d, in.get() + 1 * N);
+    auto v2 = Load(d, in.get() + 2 * N);
+    auto v3 = Load(d, in.get() + 3 * N);
+    auto v4 = Load(d, in.get() + 4 * N);
+    auto v5 = Load(d, in.get() + 5 * N);
+    auto v6 = Load(d, in.get() + 6 * N);
+    auto v7 = Load(d, in.get() + 7 * N);
+    auto v8 = Load(d, in.get() + 8 * N);
+    auto v9 = Load(d, in.get() + 9 * N);
+    auto v10 = Load(d, in.get() + 10 * N);
+    auto v11 = Load(d, in.get() + 11 * N);
+    auto v12 = Load(d, in.get() + 12 * N);
+    auto v13 = Load(d, in.get() + 13 * N);
+    auto v14 = Load(d, in.get() + 14 * N);
+    auto v15 = Load(d, in.get() + 15 * N);
+    Transpose16x16(d, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12,
+                   v13, v14, v15);
+    HWY_ASSERT_VEC_EQ(d, expected.get() + 0 * N, v0);
+    HWY_ASSERT_VEC_EQ(d, expected.get() + 1 * N, v1);
+    HWY_ASSERT_VEC_EQ(d, expected.get() + 2 * N, v2);
+    HWY_ASSERT_VEC_EQ(d, expected.get() + 3 * N, v3);
+    HWY_ASSERT_VEC_EQ(d, expected.get() + 4 * N, v4);
+    HWY_ASSERT_VEC_EQ(d, expected.get() + 5 * N, v5);
+    HWY_ASSERT_VEC_EQ(d, expected.get() + 6 * N, v6);
+    HWY_ASSERT_VEC_EQ(d, expected.get() + 7 * N, v7);
+    HWY_ASSERT_VEC_EQ(d, expected.get() + 8 * N, v8);
+    HWY_ASSERT_VEC_EQ(d, expected.get() + 9 * N, v9);
+    HWY_ASSERT_VEC_EQ(d, expected.get() + 10 * N, v10);
+    HWY_ASSERT_VEC_EQ(d, expected.get() + 11 * N, v11);
+    HWY_ASSERT_VEC_EQ(d, expected.get() + 12 * N, v12);
+    HWY_ASSERT_VEC_EQ(d, expected.get() + 13 * N, v13);
+    HWY_ASSERT_VEC_EQ(d, expected.get() + 14 * N, v14);
+    HWY_ASSERT_VEC_EQ(d, expected.get() + 15 * N, v15);
+  }
+};
+
+HWY_NOINLINE void TestAllTranspose16x16() {
+  ForAllTypes(ForPartialVectors<TestTranspose16x16>());
+}
+
+// Rows of 128 bits use InterleaveLower/Upper on most targets but OddEven and
+// lane shifts on SVE/RVV; also verify the latter on other targets. (Their
+// sizeless vectors cannot be stored in arrays, but Transpose* covers them.)
+struct TestTransposeQuadrants {
+  template <typename T, class D>
+  HWY_NOINLINE void operator()(T /*unused*/, D d) {
+#if HWY_TARGET != HWY_SCALAR && HWY_TARGET != HWY_SVE && \
+    HWY_TARGET != HWY_SVE2 && HWY_TARGET != HWY_RVV
+    constexpr size_t kN = 16 / sizeof(T);
+    const size_t N = Lanes(d);
+    if (N % kN != 0) return;
+    auto in = AllocateAligned<T>(kN * N);
+    auto expected = AllocateAligned<T>(kN * N);
+    InitTranspose(kN, N, in.get(), expected.get());
+
+    Vec<D> v[kN];
+    Vec<D>* rows[kN];
+    for (size_t r = 0; r < kN; ++r) {
+      v[r] = Load(d, in.get() + r * N);
+      rows[r] = &v[r];
+    }
+    detail::TransposeRows<kN>(hwy::SizeTag<3>(), d, rows);
+    for (size_t r = 0; r < kN; ++r) {
+      HWY_ASSERT_VEC_EQ(d, expected.get() + r * N, v[r]);
+    }
+#else
+    (void)d;
+#endif
+  }
+};
+
+HWY_NOINLINE void TestAllTransposeQuadrants() {
+  ForAllTypes(ForGE128Vectors<TestTransposeQuadrants>());
+}
+
+// NOLINTNEXTLINE(google-readability-namespace-comments)
+}  // namespace HWY_NAMESPACE
+}  // namespace hwy
+HWY_AFTER_NAMESPACE();
+
+#if HWY_ONCE
+namespace hwy {
+HWY_BEFORE_TEST(HwyTransposeTest);
+HWY_EXPORT_AND_TEST_P(HwyTransposeTest, TestAllTranspose4x4);
+HWY_EXPORT_AND_TEST_P(HwyTransposeTest, TestAllTranspose8x8);
+HWY_EXPORT_AND_TEST_P(HwyTransposeTest, TestAllTranspose16x16);
+HWY_EXPORT_AND_TEST_P(HwyTransposeTest, TestAllTransposeQuadrants);
+}  // namespace hwy
+#endif
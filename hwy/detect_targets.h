@@ -51,9 +51,9 @@
 
 // 1,2: reserved
 
-// Currently satisfiable by Ice Lake (VNNI, VPCLMULQDQ, VBMI2, VAES). Later to
-// be added: BF16 (Cooper Lake). VP2INTERSECT is only in Tiger Lake? We do not
-// yet have uses for VBMI, VPOPCNTDQ, BITALG, GFNI.
+// Currently satisfiable by Ice Lake (VNNI, VPCLMULQDQ, VBMI, VBMI2, VAES).
+// Later to be added: BF16 (Cooper Lake). VP2INTERSECT is only in Tiger Lake?
+// We do not yet have uses for GFNI.
 #define HWY_AVX3_DL 4  // see HWY_WANT_AVX3_DL below
 #define HWY_AVX3 8
 #define HWY_AVX2 16
@@ -275,7 +275,7 @@
 
 // Require everything in AVX2 plus AVX-512 flags (also set by MSVC)
 #if HWY_BASELINE_AVX2 != 0 && defined(__AVX512F__) && defined(__AVX512BW__) && \
-    defined(__AVX512DQ__) && defined(__AVX512VL__)
+    defined(__AVX512DQ__) && defined(__AVX512VL__) && defined(__AVX512CD__)
 #define HWY_BASELINE_AVX3 HWY_AVX3
 #else
 #define HWY_BASELINE_AVX3 0
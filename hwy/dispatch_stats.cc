@@ -0,0 +1,107 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "hwy/dispatch_stats.h"
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "hwy/timer.h"
+
+namespace hwy {
+namespace {
+
+// Not function-local => no compiler-generated locking. Constant-initialized,
+// so it is valid before the dynamic initialization of any DispatchStats.
+std::atomic<DispatchStats*> first_stats{nullptr};
+
+}  // namespace
+
+namespace detail {
+
+// Declared in dispatch_stats.h
+std::atomic<uint64_t> dispatch_timing_mask{kDispatchTimingDisabled};
+
+// Declared in dispatch_stats.h
+uint64_t DispatchTimerStart() { return timer::Start(); }
+uint64_t DispatchTimerStop() { return timer::Stop(); }
+
+}  // namespace detail
+
+constexpr size_t DispatchStats::kNumEntries;
+
+DispatchStats::DispatchStats(const char* function_name) : name(function_name) {
+  for (size_t i = 0; i < kNumEntries; ++i) {
+    calls[i].store(0, std::memory_order_relaxed);
+    timed_calls[i].store(0, std::memory_order_relaxed);
+    ticks[i].store(0, std::memory_order_relaxed);
+  }
+  next = first_stats.load(std::memory_order_relaxed);
+  while (!first_stats.compare_exchange_weak(next, this)) {
+  }
+}
+
+const DispatchStats* FirstDispatchStats() { return first_stats.load(); }
+
+uint32_t TargetFromDispatchIndex(size_t index) {
+  if (index == 0 || index > HWY_MAX_DYNAMIC_TARGETS) return HWY_SCALAR;
+  // Inverse of HWY_CHOSEN_TARGET_SHIFT.
+  return 1u << (index - 1 + HWY_HIGHEST_TARGET_BIT + 1 -
+                HWY_MAX_DYNAMIC_TARGETS);
+}
+
+void SetDispatchTimingInterval(uint32_t interval) {
+  uint64_t mask = detail::kDispatchTimingDisabled;
+  if (interval != 0) {
+    uint64_t pow2 = 1;
+    while (pow2 < interval) pow2 += pow2;
+    mask = pow2 - 1;
+  }
+  detail::dispatch_timing_mask.store(mask, std::memory_order_relaxed);
+}
+
+void PrintDispatchStats(FILE* f) {
+  fprintf(f, "%-30s %-8s %12s %12s %12s\n", "Function", "Target", "Calls",
+          "Timed", "Ticks/call");
+  for (const DispatchStats* stats = FirstDispatchStats(); stats != nullptr;
+       stats = stats->next) {
+    for (size_t i = 0; i < DispatchStats::kNumEntries; ++i) {
+      const uint64_t calls = stats->calls[i].load(std::memory_order_relaxed);
+      if (calls == 0) continue;
+      const uint64_t timed =
+          stats->timed_calls[i].load(std::memory_order_relaxed);
+      const uint64_t ticks = stats->ticks[i].load(std::memory_order_relaxed);
+      const double ticks_per_call =
+          timed == 0 ? 0.0
+                     : static_cast<double>(ticks) / static_cast<double>(timed);
+      fprintf(f, "%-30s %-8s %12llu %12llu %12.1f\n", stats->name,
+              TargetName(TargetFromDispatchIndex(i)),
+              static_cast<unsigned long long>(calls),
+              static_cast<unsigned long long>(timed), ticks_per_call);
+    }
+  }
+}
+
+void ResetDispatchStats() {
+  for (DispatchStats* stats = first_stats.load(); stats != nullptr;
+       stats = stats->next) {
+    for (size_t i = 0; i < DispatchStats::kNumEntries; ++i) {
+      stats->calls[i].store(0, std::memory_order_relaxed);
+      stats->timed_calls[i].store(0, std::memory_order_relaxed);
+      stats->ticks[i].store(0, std::memory_order_relaxed);
+    }
+  }
+}
+
+}  // namespace hwy
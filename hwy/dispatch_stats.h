@@ -0,0 +1,143 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef HIGHWAY_HWY_DISPATCH_STATS_H_
+#define HIGHWAY_HWY_DISPATCH_STATS_H_
+
+// Optional instrumentation of HWY_DYNAMIC_DISPATCH: for each exported function
+// and target, counts the calls and (optionally, for a sample of calls) their
+// duration in ticks of the nanobenchmark timer.
+//
+// Enabled by defining HWY_DISPATCH_INSTRUMENTATION=1 before including
+// highway.h, which then includes this header. Otherwise, HWY_EXPORT and
+// HWY_DYNAMIC_DISPATCH are unchanged and there is no overhead. This can be
+// enabled per translation unit, and only affects those with multiple targets.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include <atomic>
+#include <utility>
+
+#include "hwy/base.h"
+#include "hwy/targets.h"
+
+namespace hwy {
+
+// Statistics for one function exported via HWY_EXPORT, indexed in the same way
+// as its dispatch table. Defined by HWY_EXPORT and registered on construction,
+// hence they must have static storage duration.
+struct DispatchStats {
+  static constexpr size_t kNumEntries = HWY_MAX_DYNAMIC_TARGETS + 2;
+
+  explicit DispatchStats(const char* function_name);
+
+  const char* name;
+  std::atomic<uint64_t> calls[kNumEntries];
+  std::atomic<uint64_t> timed_calls[kNumEntries];
+  std::atomic<uint64_t> ticks[kNumEntries];  // sum over all timed_calls
+
+  // Intrusive list of all DispatchStats.
+  DispatchStats* next;
+};
+
+// Returns the most recently registered DispatchStats; iterate via `next`.
+const DispatchStats* FirstDispatchStats();
+
+// Returns the HWY_* target corresponding to an index in DispatchStats.
+uint32_t TargetFromDispatchIndex(size_t index);
+
+// Times one of every "interval" calls per function and target. "interval" is
+// rounded up to a power of two. The default of 0 only counts calls.
+void SetDispatchTimingInterval(uint32_t interval);
+
+// Writes a table with the calls, timed calls and average ticks per timed call
+// for every function and target that was called.
+void PrintDispatchStats(FILE* f);
+
+// Sets all counters to zero.
+void ResetDispatchStats();
+
+namespace detail {
+
+// Calls with (prior calls & dispatch_timing_mask) == 0 are timed.
+static constexpr uint64_t kDispatchTimingDisabled = ~uint64_t{0};
+extern std::atomic<uint64_t> dispatch_timing_mask;
+
+// Out of line so that this header does not expose the platform headers
+// required by the timer. Only sampled calls are timed, hence the call overhead
+// is acceptable.
+uint64_t DispatchTimerStart();
+uint64_t DispatchTimerStop();
+
+class ScopedDispatchTimer {
+ public:
+  explicit ScopedDispatchTimer(std::atomic<uint64_t>* ticks)
+      : ticks_(ticks), start_(DispatchTimerStart()) {}
+  ~ScopedDispatchTimer() {
+    ticks_->fetch_add(DispatchTimerStop() - start_, std::memory_order_relaxed);
+  }
+
+ private:
+  std::atomic<uint64_t>* ticks_;
+  const uint64_t start_;
+};
+
+// Returned by HWY_DYNAMIC_DISPATCH instead of a function pointer; records the
+// call before forwarding it.
+template <typename RetType, typename... Args>
+class InstrumentedFunction {
+ public:
+  InstrumentedFunction(RetType (*func)(Args...), DispatchStats* stats,
+                       size_t index)
+      : func_(func), stats_(stats), index_(index) {}
+
+  RetType operator()(Args... args) const {
+    const uint64_t prior =
+        stats_->calls[index_].fetch_add(1, std::memory_order_relaxed);
+    const uint64_t mask = dispatch_timing_mask.load(std::memory_order_relaxed);
+    if (HWY_LIKELY(mask == kDispatchTimingDisabled || (prior & mask) != 0)) {
+      return func_(std::forward<Args>(args)...);
+    }
+    stats_->timed_calls[index_].fetch_add(1, std::memory_order_relaxed);
+    ScopedDispatchTimer timer(&stats_->ticks[index_]);
+    return func_(std::forward<Args>(args)...);
+  }
+
+ private:
+  RetType (*func_)(Args...);
+  DispatchStats* stats_;
+  size_t index_;
+};
+
+// Same as HWY_DYNAMIC_DISPATCH, except that the first call initializes the
+// chosen target here rather than via ChooseAndCall, so that the statistics
+// always refer to the actual target.
+template <typename RetType, typename... Args>
+HWY_INLINE InstrumentedFunction<RetType, Args...> InstrumentedDispatch(
+    RetType (*const* table)(Args...), DispatchStats* stats,
+    const std::atomic<uint32_t>& function_targets) {
+  size_t index = chosen_target.GetIndex(function_targets);
+  if (HWY_UNLIKELY(index == 0)) {
+    chosen_target.Update();
+    index = chosen_target.GetIndex(function_targets);
+  }
+  return InstrumentedFunction<RetType, Args...>(table[index], stats, index);
+}
+
+}  // namespace detail
+}  // namespace hwy
+
+#endif  // HIGHWAY_HWY_DISPATCH_STATS_H_
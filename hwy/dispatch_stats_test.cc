@@ -0,0 +1,162 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#define HWY_DISPATCH_INSTRUMENTATION 1
+
+#include "hwy/dispatch_stats.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "hwy/highway.h"
+#include "hwy/tests/test_util-inl.h"
+
+namespace fake {
+
+uint32_t g_last_target = 0;
+
+#define DECLARE_FUNCTION(TGT)                                  \
+  namespace N_##TGT {                                          \
+    uint32_t FakeFunction(int) { return HWY_##TGT; }           \
+    void FakeVoidFunction(int) { g_last_target = HWY_##TGT; }  \
+  }
+
+DECLARE_FUNCTION(AVX3_DL)
+DECLARE_FUNCTION(AVX3)
+DECLARE_FUNCTION(AVX2)
+DECLARE_FUNCTION(SSE4)
+DECLARE_FUNCTION(SSSE3)
+DECLARE_FUNCTION(NEON)
+DECLARE_FUNCTION(SVE)
+DECLARE_FUNCTION(SVE2)
+DECLARE_FUNCTION(PPC8)
+DECLARE_FUNCTION(WASM)
+DECLARE_FUNCTION(RVV)
+DECLARE_FUNCTION(SCALAR)
+
+HWY_EXPORT(FakeFunction);
+HWY_EXPORT(FakeVoidFunction);
+
+uint32_t CallFakeFunction() { return HWY_DYNAMIC_DISPATCH(FakeFunction)(42); }
+void CallFakeVoidFunction() { HWY_DYNAMIC_DISPATCH(FakeVoidFunction)(42); }
+
+}  // namespace fake
+
+namespace hwy {
+
+// Instrumentation only applies if there are multiple targets.
+constexpr bool kIsDynamic =
+    !HWY_IDE && ((HWY_TARGETS & (HWY_TARGETS - 1)) != 0);
+
+const DispatchStats* FindStats(const char* name) {
+  for (const DispatchStats* stats = FirstDispatchStats(); stats != nullptr;
+       stats = stats->next) {
+    if (strcmp(stats->name, name) == 0) return stats;
+  }
+  return nullptr;
+}
+
+// Returns the index of the only target that was called, or 0.
+size_t CalledIndex(const DispatchStats& stats) {
+  size_t index = 0;
+  for (size_t i = 0; i < DispatchStats::kNumEntries; ++i) {
+    if (stats.calls[i].load() != 0) {
+      EXPECT_EQ(0u, index);
+      index = i;
+    }
+  }
+  return index;
+}
+
+class DispatchStatsTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    ResetDispatchStats();
+    SetDispatchTimingInterval(0);
+  }
+  void TearDown() override {
+    SetDispatchTimingInterval(0);
+    SetThreadTargets(0);
+  }
+};
+
+TEST_F(DispatchStatsTest, TestCounts) {
+  if (!kIsDynamic) return;
+  const DispatchStats* stats = FindStats("FakeFunction");
+  ASSERT_TRUE(stats != nullptr);
+
+  // Also counts the first call, which initializes the chosen target.
+  chosen_target.DeInit();
+  uint32_t target = 0;
+  for (int i = 0; i < 10; ++i) {
+    target = fake::CallFakeFunction();
+  }
+  const size_t index = CalledIndex(*stats);
+  EXPECT_EQ(target, TargetFromDispatchIndex(index));
+  EXPECT_EQ(10u, stats->calls[index].load());
+  EXPECT_EQ(0u, stats->timed_calls[index].load());
+
+  ResetDispatchStats();
+  EXPECT_EQ(0u, stats->calls[index].load());
+}
+
+TEST_F(DispatchStatsTest, TestVoid) {
+  if (!kIsDynamic) return;
+  const DispatchStats* stats = FindStats("FakeVoidFunction");
+  ASSERT_TRUE(stats != nullptr);
+  fake::CallFakeVoidFunction();
+  const size_t index = CalledIndex(*stats);
+  EXPECT_EQ(fake::g_last_target, TargetFromDispatchIndex(index));
+  EXPECT_EQ(1u, stats->calls[index].load());
+}
+
+TEST_F(DispatchStatsTest, TestTiming) {
+  if (!kIsDynamic) return;
+  const DispatchStats* stats = FindStats("FakeFunction");
+  ASSERT_TRUE(stats != nullptr);
+
+  SetDispatchTimingInterval(1);
+  for (int i = 0; i < 8; ++i) fake::CallFakeFunction();
+  const size_t index = CalledIndex(*stats);
+  EXPECT_EQ(8u, stats->timed_calls[index].load());
+  EXPECT_NE(0u, stats->ticks[index].load());
+
+  // Rounded up to 4 => every fourth call is timed.
+  ResetDispatchStats();
+  SetDispatchTimingInterval(3);
+  for (int i = 0; i < 16; ++i) fake::CallFakeFunction();
+  EXPECT_EQ(16u, stats->calls[index].load());
+  EXPECT_EQ(4u, stats->timed_calls[index].load());
+
+  PrintDispatchStats(stderr);
+}
+
+// The statistics refer to the target that was actually called.
+TEST_F(DispatchStatsTest, TestRestrictedTarget) {
+  if (!kIsDynamic) return;
+  const DispatchStats* stats = FindStats("FakeFunction");
+  ASSERT_TRUE(stats != nullptr);
+  const std::vector<uint32_t> targets = SupportedAndGeneratedTargets();
+  SetThreadTargets(targets.back());
+  EXPECT_EQ(targets.back(), fake::CallFakeFunction());
+  EXPECT_EQ(targets.back(), TargetFromDispatchIndex(CalledIndex(*stats)));
+}
+
+}  // namespace hwy
+
+// Ought not to be necessary, but without this, no tests run on RVV.
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -23,6 +23,16 @@
 #include "hwy/base.h"
 #include "hwy/targets.h"
 
+// Define to 1 to record per-target call counts and durations of functions
+// called via HWY_DYNAMIC_DISPATCH; see dispatch_stats.h.
+#ifndef HWY_DISPATCH_INSTRUMENTATION
+#define HWY_DISPATCH_INSTRUMENTATION 0
+#endif
+
+#if HWY_DISPATCH_INSTRUMENTATION
+#include "hwy/dispatch_stats.h"
+#endif
+
 namespace hwy {
 
 // API version (https://semver.org/); keep in sync with CMakeLists.txt.
@@ -102,11 +112,25 @@ struct FunctionCache {
   // global cache, all the highway exported functions, even those exposed by
   // different modules, will be initialized after this function runs for any one
   // of those exported functions.
-  template <FunctionType* const table[]>
+  template <FunctionType* const table[], const std::atomic<uint32_t>* targets>
   static RetType ChooseAndCall(Args... args) {
     // If we are running here it means we need to update the chosen target.
     chosen_target.Update();
-    return (table[chosen_target.GetIndex()])(args...);
+    return (table[chosen_target.GetIndex(*targets)])(args...);
+  }
+
+  // Initial value of the pointer defined by HWY_EXPORT_CACHED. Looks up the
+  // function for the chosen target (initializing it if this is the first
+  // dispatch), stores it in `cache` so that subsequent calls bypass this
+  // function and the table lookup, and calls it.
+  template <FunctionType* const table[], std::atomic<FunctionType*>* cache>
+  static RetType ResolveAndCall(Args... args) {
+    if (!chosen_target.IsInitialized()) {
+      chosen_target.Update();
+    }
+    FunctionType* const func = table[chosen_target.GetIndex()];
+    cache->store(func, std::memory_order_relaxed);
+    return func(args...);
   }
 };
 
@@ -226,6 +250,39 @@ FunctionCache<RetType, Args...> FunctionCacheFactory(RetType (*)(Args...)) {
 //   }  // namespace skeleton
 //
 
+// HWY_EXPORT_CACHED(FUNC_NAME); is an opt-in alternative to HWY_EXPORT for
+// small functions called very frequently. In addition to the table, it defines
+// a function pointer which is resolved on the first call and afterwards points
+// directly to the function for the chosen target. Calling it via
+// HWY_CACHED_DISPATCH(FUNC_NAME)(args) is thus a single indirect call, whereas
+// HWY_DYNAMIC_DISPATCH also loads the ChosenTarget mask and computes the table
+// index on every call. Because the pointer is only resolved once, subsequent
+// DisableTargets or SetSupportedTargetsForTest calls do not affect it until
+// HWY_RESET_CACHED_DISPATCH(FUNC_NAME) is called.
+//
+// ELF ifunc resolvers would also avoid the pointer load, but they run during
+// relocation, before DisableTargets and other static initialization, and may
+// not call into other shared libraries, so they are not used here.
+
+#define HWY_DISPATCH_CACHE(FUNC_NAME) \
+  HWY_CONCAT(FUNC_NAME, HighwayDispatchCache)
+
+// Mask of targets to which HWY_DYNAMIC_DISPATCH(FUNC_NAME) is restricted, or 0.
+#define HWY_DISPATCH_TARGETS(FUNC_NAME) \
+  HWY_CONCAT(FUNC_NAME, HighwayDispatchTargets)
+
+#define HWY_DISPATCH_STATS(FUNC_NAME) \
+  HWY_CONCAT(FUNC_NAME, HighwayDispatchStats)
+
+// Part of HWY_EXPORT: defines the statistics if instrumentation is enabled.
+#if HWY_DISPATCH_INSTRUMENTATION
+#define HWY_DEFINE_DISPATCH_STATS(FUNC_NAME)                     \
+  HWY_MAYBE_UNUSED static hwy::DispatchStats HWY_DISPATCH_STATS( \
+      FUNC_NAME){#FUNC_NAME};
+#else
+#define HWY_DEFINE_DISPATCH_STATS(FUNC_NAME)
+#endif
+
 #if HWY_IDE || ((HWY_TARGETS & (HWY_TARGETS - 1)) == 0)
 
 // Simplified version for IDE or the dynamic dispatch case with only one target.
@@ -237,23 +294,69 @@ FunctionCache<RetType, Args...> FunctionCacheFactory(RetType (*)(Args...)) {
       const HWY_DISPATCH_TABLE(FUNC_NAME)[1] = {                    \
           &HWY_STATIC_DISPATCH(FUNC_NAME)}
 #define HWY_DYNAMIC_DISPATCH(FUNC_NAME) HWY_STATIC_DISPATCH(FUNC_NAME)
+#define HWY_SET_DISPATCH_TARGETS(FUNC_NAME, TARGETS) (void)(TARGETS)
+
+// With a single target, calls are direct and there is nothing to cache.
+#define HWY_EXPORT_CACHED(FUNC_NAME) HWY_EXPORT(FUNC_NAME)
+#define HWY_CACHED_DISPATCH(FUNC_NAME) HWY_STATIC_DISPATCH(FUNC_NAME)
+#define HWY_RESET_CACHED_DISPATCH(FUNC_NAME) (void)0
 
 #else
 
 // Dynamic dispatch case with one entry per dynamic target plus the scalar
 // mode and the initialization wrapper.
-#define HWY_EXPORT(FUNC_NAME)                                              \
-  static decltype(&HWY_STATIC_DISPATCH(FUNC_NAME))                         \
-      const HWY_DISPATCH_TABLE(FUNC_NAME)[HWY_MAX_DYNAMIC_TARGETS + 2] = { \
-          /* The first entry in the table initializes the global cache and \
-           * calls the appropriate function. */                            \
-          &decltype(hwy::FunctionCacheFactory(&HWY_STATIC_DISPATCH(        \
-              FUNC_NAME)))::ChooseAndCall<HWY_DISPATCH_TABLE(FUNC_NAME)>,  \
-          HWY_CHOOSE_TARGET_LIST(FUNC_NAME),                               \
-          HWY_CHOOSE_SCALAR(FUNC_NAME),                                    \
+#define HWY_EXPORT(FUNC_NAME)                                                \
+  HWY_DEFINE_DISPATCH_STATS(FUNC_NAME)                                       \
+  static std::atomic<uint32_t> HWY_DISPATCH_TARGETS(FUNC_NAME){0};           \
+  static decltype(&HWY_STATIC_DISPATCH(FUNC_NAME))                           \
+      const HWY_DISPATCH_TABLE(FUNC_NAME)[HWY_MAX_DYNAMIC_TARGETS + 2] = {   \
+          /* The first entry in the table initializes the global cache and   \
+           * calls the appropriate function. */                              \
+          &decltype(hwy::FunctionCacheFactory(&HWY_STATIC_DISPATCH(          \
+              FUNC_NAME)))::ChooseAndCall<HWY_DISPATCH_TABLE(FUNC_NAME),     \
+                                          &HWY_DISPATCH_TARGETS(FUNC_NAME)>, \
+          HWY_CHOOSE_TARGET_LIST(FUNC_NAME),                                 \
+          HWY_CHOOSE_SCALAR(FUNC_NAME),                                      \
   }
-#define HWY_DYNAMIC_DISPATCH(FUNC_NAME) \
-  (*(HWY_DISPATCH_TABLE(FUNC_NAME)[hwy::chosen_target.GetIndex()]))
+#if HWY_DISPATCH_INSTRUMENTATION
+#define HWY_DYNAMIC_DISPATCH(FUNC_NAME)                             \
+  hwy::detail::InstrumentedDispatch(HWY_DISPATCH_TABLE(FUNC_NAME),  \
+                                    &HWY_DISPATCH_STATS(FUNC_NAME), \
+                                    HWY_DISPATCH_TARGETS(FUNC_NAME))
+#else
+#define HWY_DYNAMIC_DISPATCH(FUNC_NAME)                         \
+  (*(HWY_DISPATCH_TABLE(FUNC_NAME)[hwy::chosen_target.GetIndex( \
+      HWY_DISPATCH_TARGETS(FUNC_NAME))]))
+#endif
+
+// Restricts HWY_DYNAMIC_DISPATCH(FUNC_NAME) in all threads to the given mask of
+// targets, e.g. to compare targets of a single function in a benchmark. Call
+// with 0 to remove the restriction. Must be used in the same translation unit
+// and namespace as HWY_EXPORT(FUNC_NAME). See also hwy::SetThreadTargets.
+#define HWY_SET_DISPATCH_TARGETS(FUNC_NAME, TARGETS) \
+  hwy::detail::SetFunctionTargets(&HWY_DISPATCH_TARGETS(FUNC_NAME), (TARGETS))
+
+// Pointer to the function which resolves and caches FUNC_NAME.
+#define HWY_CACHED_DISPATCH_RESOLVER(FUNC_NAME)                    \
+  (&decltype(hwy::FunctionCacheFactory(&HWY_STATIC_DISPATCH(      \
+      FUNC_NAME)))::ResolveAndCall<HWY_DISPATCH_TABLE(FUNC_NAME), \
+                                   &HWY_DISPATCH_CACHE(FUNC_NAME)>)
+
+#define HWY_EXPORT_CACHED(FUNC_NAME)                                     \
+  HWY_EXPORT(FUNC_NAME);                                                 \
+  HWY_MAYBE_UNUSED static std::atomic<decltype(&HWY_STATIC_DISPATCH(     \
+      FUNC_NAME))> HWY_DISPATCH_CACHE(FUNC_NAME){                        \
+      HWY_CACHED_DISPATCH_RESOLVER(FUNC_NAME)}
+
+// Relaxed loads of pointers compile to plain loads on all supported targets.
+#define HWY_CACHED_DISPATCH(FUNC_NAME) \
+  (*(HWY_DISPATCH_CACHE(FUNC_NAME).load(std::memory_order_relaxed)))
+
+// Causes the next HWY_CACHED_DISPATCH(FUNC_NAME) to resolve the pointer again,
+// e.g. after DisableTargets.
+#define HWY_RESET_CACHED_DISPATCH(FUNC_NAME)                      \
+  HWY_DISPATCH_CACHE(FUNC_NAME)                                   \
+      .store(HWY_CACHED_DISPATCH_RESOLVER(FUNC_NAME), std::memory_order_relaxed)
 
 #endif  // HWY_IDE || ((HWY_TARGETS & (HWY_TARGETS - 1)) == 0)
 
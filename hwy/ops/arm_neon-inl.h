@@ -1122,6 +1122,61 @@ HWY_API Vec128<uint16_t, N> MulHigh(const Vec128<uint16_t, N> a,
   return Vec128<uint16_t, N>(vget_low_u16(vuzp2q_u16(hi_lo, hi_lo)));
 }
 
+// Returns the upper 32 bits of a * b in each lane.
+HWY_API Vec128<int32_t> MulHigh(const Vec128<int32_t> a,
+                                const Vec128<int32_t> b) {
+  int64x2_t rlo = vmull_s32(vget_low_s32(a.raw), vget_low_s32(b.raw));
+#if HWY_ARCH_ARM_A64
+  int64x2_t rhi = vmull_high_s32(a.raw, b.raw);
+#else
+  int64x2_t rhi = vmull_s32(vget_high_s32(a.raw), vget_high_s32(b.raw));
+#endif
+  return Vec128<int32_t>(
+      vuzp2q_s32(vreinterpretq_s32_s64(rlo), vreinterpretq_s32_s64(rhi)));
+}
+HWY_API Vec128<uint32_t> MulHigh(const Vec128<uint32_t> a,
+                                 const Vec128<uint32_t> b) {
+  uint64x2_t rlo = vmull_u32(vget_low_u32(a.raw), vget_low_u32(b.raw));
+#if HWY_ARCH_ARM_A64
+  uint64x2_t rhi = vmull_high_u32(a.raw, b.raw);
+#else
+  uint64x2_t rhi = vmull_u32(vget_high_u32(a.raw), vget_high_u32(b.raw));
+#endif
+  return Vec128<uint32_t>(
+      vuzp2q_u32(vreinterpretq_u32_u64(rlo), vreinterpretq_u32_u64(rhi)));
+}
+
+template <size_t N, HWY_IF_LE64(int32_t, N)>
+HWY_API Vec128<int32_t, N> MulHigh(const Vec128<int32_t, N> a,
+                                   const Vec128<int32_t, N> b) {
+  int32x4_t hi_lo = vreinterpretq_s32_s64(vmull_s32(a.raw, b.raw));
+  return Vec128<int32_t, N>(vget_low_s32(vuzp2q_s32(hi_lo, hi_lo)));
+}
+template <size_t N, HWY_IF_LE64(uint32_t, N)>
+HWY_API Vec128<uint32_t, N> MulHigh(const Vec128<uint32_t, N> a,
+                                    const Vec128<uint32_t, N> b) {
+  uint32x4_t hi_lo = vreinterpretq_u32_u64(vmull_u32(a.raw, b.raw));
+  return Vec128<uint32_t, N>(vget_low_u32(vuzp2q_u32(hi_lo, hi_lo)));
+}
+
+// ------------------------------ MulFixedPoint15
+
+#ifdef HWY_NATIVE_MUL_FIXED_POINT15
+#undef HWY_NATIVE_MUL_FIXED_POINT15
+#else
+#define HWY_NATIVE_MUL_FIXED_POINT15
+#endif
+
+HWY_API Vec128<int16_t> MulFixedPoint15(const Vec128<int16_t> a,
+                                        const Vec128<int16_t> b) {
+  return Vec128<int16_t>(vqrdmulhq_s16(a.raw, b.raw));
+}
+template <size_t N, HWY_IF_LE64(int16_t, N)>
+HWY_API Vec128<int16_t, N> MulFixedPoint15(const Vec128<int16_t, N> a,
+                                           const Vec128<int16_t, N> b) {
+  return Vec128<int16_t, N>(vqrdmulh_s16(a.raw, b.raw));
+}
+
 // Multiplies even lanes (0, 2 ..) and places the double-wide result into
 // even and the upper half into its odd neighbor lane.
 HWY_API Vec128<int64_t> MulEven(const Vec128<int32_t> a,
@@ -1170,6 +1225,86 @@ HWY_INLINE Vec128<uint64_t> MulOdd(const Vec128<uint64_t> a,
   return Vec128<uint64_t>(vsetq_lane_u64(hi, vdupq_n_u64(lo), 1));
 }
 
+// Multiplies odd lanes (1, 3 ..) and places the double-wide result into even
+// and the upper half into its odd neighbor lane.
+HWY_API Vec128<int64_t> MulOdd(const Vec128<int32_t> a,
+                               const Vec128<int32_t> b) {
+  int32x4_t a_packed = vuzp2q_s32(a.raw, a.raw);
+  int32x4_t b_packed = vuzp2q_s32(b.raw, b.raw);
+  return Vec128<int64_t>(
+      vmull_s32(vget_low_s32(a_packed), vget_low_s32(b_packed)));
+}
+HWY_API Vec128<uint64_t> MulOdd(const Vec128<uint32_t> a,
+                                const Vec128<uint32_t> b) {
+  uint32x4_t a_packed = vuzp2q_u32(a.raw, a.raw);
+  uint32x4_t b_packed = vuzp2q_u32(b.raw, b.raw);
+  return Vec128<uint64_t>(
+      vmull_u32(vget_low_u32(a_packed), vget_low_u32(b_packed)));
+}
+
+template <size_t N>
+HWY_API Vec128<int64_t, (N + 1) / 2> MulOdd(const Vec128<int32_t, N> a,
+                                            const Vec128<int32_t, N> b) {
+  int32x2_t a_packed = vuzp2_s32(a.raw, a.raw);
+  int32x2_t b_packed = vuzp2_s32(b.raw, b.raw);
+  return Vec128<int64_t, (N + 1) / 2>(
+      vget_low_s64(vmull_s32(a_packed, b_packed)));
+}
+template <size_t N>
+HWY_API Vec128<uint64_t, (N + 1) / 2> MulOdd(const Vec128<uint32_t, N> a,
+                                             const Vec128<uint32_t, N> b) {
+  uint32x2_t a_packed = vuzp2_u32(a.raw, a.raw);
+  uint32x2_t b_packed = vuzp2_u32(b.raw, b.raw);
+  return Vec128<uint64_t, (N + 1) / 2>(
+      vget_low_u64(vmull_u32(a_packed, b_packed)));
+}
+
+// 64-bit: there is no vmulq_u64, so combine 32x32=64 products. Only the cross
+// terms aH*bL and aL*bH contribute to the upper 32 bits.
+HWY_API Vec128<uint64_t> operator*(const Vec128<uint64_t> a,
+                                   const Vec128<uint64_t> b) {
+  const uint32x2_t aL = vmovn_u64(a.raw);
+  const uint32x2_t bL = vmovn_u64(b.raw);
+  const uint32x2_t aH = vshrn_n_u64(a.raw, 32);
+  const uint32x2_t bH = vshrn_n_u64(b.raw, 32);
+  const uint64x2_t cross = vmlal_u32(vmull_u32(aH, bL), aL, bH);
+  return Vec128<uint64_t>(vmlal_u32(vshlq_n_u64(cross, 32), aL, bL));
+}
+HWY_API Vec128<uint64_t, 1> operator*(const Vec128<uint64_t, 1> a,
+                                      const Vec128<uint64_t, 1> b) {
+  return Vec128<uint64_t, 1>(
+      vdup_n_u64(vget_lane_u64(a.raw, 0) * vget_lane_u64(b.raw, 0)));
+}
+HWY_API Vec128<int64_t> operator*(const Vec128<int64_t> a,
+                                  const Vec128<int64_t> b) {
+  const Vec128<uint64_t> a_u(vreinterpretq_u64_s64(a.raw));
+  const Vec128<uint64_t> b_u(vreinterpretq_u64_s64(b.raw));
+  return Vec128<int64_t>(vreinterpretq_s64_u64((a_u * b_u).raw));
+}
+HWY_API Vec128<int64_t, 1> operator*(const Vec128<int64_t, 1> a,
+                                     const Vec128<int64_t, 1> b) {
+  const Vec128<uint64_t, 1> a_u(vreinterpret_u64_s64(a.raw));
+  const Vec128<uint64_t, 1> b_u(vreinterpret_u64_s64(b.raw));
+  return Vec128<int64_t, 1>(vreinterpret_s64_u64((a_u * b_u).raw));
+}
+
+// Returns the upper 64 bits of a * b in each lane. Scalar UMULH is cheaper
+// than a 32x32=64 Knuth decomposition for just two lanes. i64 is implemented
+// after BroadcastSignBit.
+HWY_API Vec128<uint64_t> MulHigh(const Vec128<uint64_t> a,
+                                 const Vec128<uint64_t> b) {
+  uint64_t hi0, hi1;
+  Mul128(vgetq_lane_u64(a.raw, 0), vgetq_lane_u64(b.raw, 0), &hi0);
+  Mul128(vgetq_lane_u64(a.raw, 1), vgetq_lane_u64(b.raw, 1), &hi1);
+  return Vec128<uint64_t>(vsetq_lane_u64(hi1, vdupq_n_u64(hi0), 1));
+}
+HWY_API Vec128<uint64_t, 1> MulHigh(const Vec128<uint64_t, 1> a,
+                                    const Vec128<uint64_t, 1> b) {
+  uint64_t hi;
+  Mul128(vget_lane_u64(a.raw, 0), vget_lane_u64(b.raw, 0), &hi);
+  return Vec128<uint64_t, 1>(vdup_n_u64(hi));
+}
+
 // ------------------------------ Floating-point mul / div
 
 HWY_NEON_DEF_FUNCTION_ALL_FLOATS(operator*, vmul, _, 2)
@@ -1223,6 +1358,102 @@ HWY_API Vec128<float, N> AbsDiff(const Vec128<float, N> a,
   return Vec128<float, N>(vabd_f32(a.raw, b.raw));
 }
 
+// ------------------------------ SumsOf8
+
+#ifdef HWY_NATIVE_SUMS_OF_8
+#undef HWY_NATIVE_SUMS_OF_8
+#else
+#define HWY_NATIVE_SUMS_OF_8
+#endif
+
+// Widening pairwise additions: u8 -> u16 -> u32 -> u64.
+HWY_API Vec128<uint64_t> SumsOf8(const Vec128<uint8_t> v) {
+  return Vec128<uint64_t>(vpaddlq_u32(vpaddlq_u16(vpaddlq_u8(v.raw))));
+}
+HWY_API Vec128<uint64_t, 1> SumsOf8(const Vec128<uint8_t, 8> v) {
+  return Vec128<uint64_t, 1>(vpaddl_u32(vpaddl_u16(vpaddl_u8(v.raw))));
+}
+
+// ------------------------------ SumsOfAbsDiff
+
+HWY_API Vec128<uint64_t> SumsOfAbsDiff(const Vec128<uint8_t> a,
+                                       const Vec128<uint8_t> b) {
+  return SumsOf8(Vec128<uint8_t>(vabdq_u8(a.raw, b.raw)));
+}
+HWY_API Vec128<uint64_t, 1> SumsOfAbsDiff(const Vec128<uint8_t, 8> a,
+                                          const Vec128<uint8_t, 8> b) {
+  return SumsOf8(Vec128<uint8_t, 8>(vabd_u8(a.raw, b.raw)));
+}
+
+// ------------------------------ SumsOf2
+
+#ifdef HWY_NATIVE_SUMS_OF_2
+#undef HWY_NATIVE_SUMS_OF_2
+#else
+#define HWY_NATIVE_SUMS_OF_2
+#endif
+
+HWY_API Vec128<uint16_t> SumsOf2(const Vec128<uint8_t> v) {
+  return Vec128<uint16_t>(vpaddlq_u8(v.raw));
+}
+HWY_API Vec128<int16_t> SumsOf2(const Vec128<int8_t> v) {
+  return Vec128<int16_t>(vpaddlq_s8(v.raw));
+}
+HWY_API Vec128<uint32_t> SumsOf2(const Vec128<uint16_t> v) {
+  return Vec128<uint32_t>(vpaddlq_u16(v.raw));
+}
+HWY_API Vec128<int32_t> SumsOf2(const Vec128<int16_t> v) {
+  return Vec128<int32_t>(vpaddlq_s16(v.raw));
+}
+
+template <size_t N, HWY_IF_LE64(uint8_t, N)>
+HWY_API Vec128<uint16_t, N / 2> SumsOf2(const Vec128<uint8_t, N> v) {
+  return Vec128<uint16_t, N / 2>(vpaddl_u8(v.raw));
+}
+template <size_t N, HWY_IF_LE64(int8_t, N)>
+HWY_API Vec128<int16_t, N / 2> SumsOf2(const Vec128<int8_t, N> v) {
+  return Vec128<int16_t, N / 2>(vpaddl_s8(v.raw));
+}
+template <size_t N, HWY_IF_LE64(uint16_t, N)>
+HWY_API Vec128<uint32_t, N / 2> SumsOf2(const Vec128<uint16_t, N> v) {
+  return Vec128<uint32_t, N / 2>(vpaddl_u16(v.raw));
+}
+template <size_t N, HWY_IF_LE64(int16_t, N)>
+HWY_API Vec128<int32_t, N / 2> SumsOf2(const Vec128<int16_t, N> v) {
+  return Vec128<int32_t, N / 2>(vpaddl_s16(v.raw));
+}
+
+#ifdef HWY_NATIVE_SUMS_OF_2_32
+#undef HWY_NATIVE_SUMS_OF_2_32
+#else
+#define HWY_NATIVE_SUMS_OF_2_32
+#endif
+
+HWY_API Vec128<uint64_t> SumsOf2(const Vec128<uint32_t> v) {
+  return Vec128<uint64_t>(vpaddlq_u32(v.raw));
+}
+HWY_API Vec128<int64_t> SumsOf2(const Vec128<int32_t> v) {
+  return Vec128<int64_t>(vpaddlq_s32(v.raw));
+}
+HWY_API Vec128<uint64_t, 1> SumsOf2(const Vec128<uint32_t, 2> v) {
+  return Vec128<uint64_t, 1>(vpaddl_u32(v.raw));
+}
+HWY_API Vec128<int64_t, 1> SumsOf2(const Vec128<int32_t, 2> v) {
+  return Vec128<int64_t, 1>(vpaddl_s32(v.raw));
+}
+
+#if HWY_ARCH_ARM_A64
+HWY_API Vec128<double> SumsOf2(const Vec128<float> v) {
+  const float64x2_t lo = vcvt_f64_f32(vget_low_f32(v.raw));
+  const float64x2_t hi = vcvt_high_f64_f32(v.raw);
+  return Vec128<double>(vpaddq_f64(lo, hi));
+}
+HWY_API Vec128<double, 1> SumsOf2(const Vec128<float, 2> v) {
+  const float64x2_t wide = vcvt_f64_f32(v.raw);
+  return Vec128<double, 1>(vdup_n_f64(vpaddd_f64(wide)));
+}
+#endif
+
 // ------------------------------ Floating-point multiply-add variants
 
 // Returns add + mul * x
@@ -1532,6 +1763,110 @@ HWY_API Vec128<T, N> PopulationCount(Vec128<T, N> v) {
   return detail::PopulationCount(hwy::SizeTag<sizeof(T)>(), v);
 }
 
+// ------------------------------ ReverseBits
+
+// RBIT is only available on A64; armv7 uses the generic version.
+#if HWY_ARCH_ARM_A64
+
+#ifdef HWY_NATIVE_REVERSE_BITS
+#undef HWY_NATIVE_REVERSE_BITS
+#else
+#define HWY_NATIVE_REVERSE_BITS
+#endif
+
+HWY_NEON_DEF_FUNCTION_UINT_8(ReverseBits, vrbit, _, 1)
+HWY_NEON_DEF_FUNCTION_INT_8(ReverseBits, vrbit, _, 1)
+
+namespace detail {
+
+// Reverses the order of the bytes within each lane.
+template <typename T>
+HWY_INLINE Vec128<T> ReverseLaneBytes(hwy::SizeTag<2> /* tag */, Vec128<T> v) {
+  const Full128<uint8_t> d8;
+  return BitCast(Full128<T>(),
+                 Vec128<uint8_t>(vrev16q_u8(BitCast(d8, v).raw)));
+}
+template <typename T, size_t N, HWY_IF_LE64(T, N)>
+HWY_INLINE Vec128<T, N> ReverseLaneBytes(hwy::SizeTag<2> /* tag */,
+                                         Vec128<T, N> v) {
+  const Repartition<uint8_t, Simd<T, N>> d8;
+  return BitCast(Simd<T, N>(),
+                 Vec128<uint8_t, N * 2>(vrev16_u8(BitCast(d8, v).raw)));
+}
+
+template <typename T>
+HWY_INLINE Vec128<T> ReverseLaneBytes(hwy::SizeTag<4> /* tag */, Vec128<T> v) {
+  const Full128<uint8_t> d8;
+  return BitCast(Full128<T>(),
+                 Vec128<uint8_t>(vrev32q_u8(BitCast(d8, v).raw)));
+}
+template <typename T, size_t N, HWY_IF_LE64(T, N)>
+HWY_INLINE Vec128<T, N> ReverseLaneBytes(hwy::SizeTag<4> /* tag */,
+                                         Vec128<T, N> v) {
+  const Repartition<uint8_t, Simd<T, N>> d8;
+  return BitCast(Simd<T, N>(),
+                 Vec128<uint8_t, N * 4>(vrev32_u8(BitCast(d8, v).raw)));
+}
+
+template <typename T>
+HWY_INLINE Vec128<T> ReverseLaneBytes(hwy::SizeTag<8> /* tag */, Vec128<T> v) {
+  const Full128<uint8_t> d8;
+  return BitCast(Full128<T>(),
+                 Vec128<uint8_t>(vrev64q_u8(BitCast(d8, v).raw)));
+}
+template <typename T, size_t N, HWY_IF_LE64(T, N)>
+HWY_INLINE Vec128<T, N> ReverseLaneBytes(hwy::SizeTag<8> /* tag */,
+                                         Vec128<T, N> v) {
+  const Repartition<uint8_t, Simd<T, N>> d8;
+  return BitCast(Simd<T, N>(),
+                 Vec128<uint8_t, N * 8>(vrev64_u8(BitCast(d8, v).raw)));
+}
+
+}  // namespace detail
+
+// Reverse the bits within each byte, then the bytes within each lane.
+template <typename T, size_t N, hwy::EnableIf<(sizeof(T) > 1)>* = nullptr>
+HWY_API Vec128<T, N> ReverseBits(const Vec128<T, N> v) {
+  const Simd<T, N> d;
+  const Repartition<uint8_t, decltype(d)> d8;
+  const auto bits_in_bytes = BitCast(d, ReverseBits(BitCast(d8, v)));
+  return detail::ReverseLaneBytes(hwy::SizeTag<sizeof(T)>(), bits_in_bytes);
+}
+
+#endif  // HWY_ARCH_ARM_A64
+
+// ------------------------------ LeadingZeroCount
+
+#ifdef HWY_NATIVE_LEADING_ZERO_COUNT
+#undef HWY_NATIVE_LEADING_ZERO_COUNT
+#else
+#define HWY_NATIVE_LEADING_ZERO_COUNT
+#endif
+
+HWY_NEON_DEF_FUNCTION_UINT_8_16_32(LeadingZeroCount, vclz, _, 1)
+HWY_NEON_DEF_FUNCTION_INT_8_16_32(LeadingZeroCount, vclz, _, 1)
+
+// There is no 64-bit CLZ: combine the counts of both 32-bit halves.
+template <typename T, size_t N, HWY_IF_LANE_SIZE(T, 8)>
+HWY_API Vec128<T, N> LeadingZeroCount(const Vec128<T, N> v) {
+  const Simd<uint64_t, N> du;
+  const Repartition<uint32_t, decltype(du)> du32;
+  const auto lz32 = BitCast(du, LeadingZeroCount(BitCast(du32, v)));
+  const auto upper = ShiftRight<32>(lz32);
+  const auto lower = And(lz32, Set(du, 0xFFFFFFFFu));
+  // All-ones if the upper half is zero (count = 32), in which case the lower
+  // half's count also applies.
+  const auto upper_zero = Zero(du) - ShiftRight<5>(upper);
+  return BitCast(Simd<T, N>(), upper + And(lower, upper_zero));
+}
+
+// ------------------------------ TrailingZeroCount (ReverseBits)
+
+template <typename T, size_t N, HWY_IF_NOT_FLOAT(T)>
+HWY_API Vec128<T, N> TrailingZeroCount(const Vec128<T, N> v) {
+  return LeadingZeroCount(ReverseBits(v));
+}
+
 // ================================================== SIGN
 
 // ------------------------------ Abs
@@ -1869,6 +2204,19 @@ HWY_API Vec128<int64_t, 1> Abs(const Vec128<int64_t, 1> v) {
 #endif
 }
 
+// ------------------------------ MulHigh i64 (BroadcastSignBit)
+
+// The signed upper half differs from the unsigned one by subtracting the other
+// operand wherever an input is negative (its sign bit has weight -2^64).
+template <size_t N>
+HWY_API Vec128<int64_t, N> MulHigh(const Vec128<int64_t, N> a,
+                                   const Vec128<int64_t, N> b) {
+  const Simd<int64_t, N> di;
+  const Simd<uint64_t, N> du;
+  const auto hi = BitCast(di, MulHigh(BitCast(du, a), BitCast(du, b)));
+  return hi - (BroadcastSignBit(a) & b) - (BroadcastSignBit(b) & a);
+}
+
 // ------------------------------ Min (IfThenElse, BroadcastSignBit)
 
 #if HWY_ARCH_ARM_A64
@@ -3368,6 +3716,125 @@ HWY_API Vec128<T> Shuffle0123(const Vec128<T> v) {
   return Shuffle2301(Shuffle1032(v));
 }
 
+// ------------------------------ Reverse (Shuffle0123, Shuffle2301, Shuffle01)
+
+namespace detail {
+
+// Reverse the lanes within each 16/32/64-bit group.
+HWY_NEON_DEF_FUNCTION_UINT_8(ReverseWithin16, vrev16, _, 1)
+HWY_NEON_DEF_FUNCTION_INT_8(ReverseWithin16, vrev16, _, 1)
+HWY_NEON_DEF_FUNCTION_UINT_8(ReverseWithin32, vrev32, _, 1)
+HWY_NEON_DEF_FUNCTION_INT_8(ReverseWithin32, vrev32, _, 1)
+HWY_NEON_DEF_FUNCTION_UINT_16(ReverseWithin32, vrev32, _, 1)
+HWY_NEON_DEF_FUNCTION_INT_16(ReverseWithin32, vrev32, _, 1)
+HWY_NEON_DEF_FUNCTION_UINT_8_16_32(ReverseWithin64, vrev64, _, 1)
+HWY_NEON_DEF_FUNCTION_INT_8_16_32(ReverseWithin64, vrev64, _, 1)
+
+template <typename T, size_t N>
+HWY_INLINE Vec128<T, N> ReverseWithin(hwy::SizeTag<2> /* tag */,
+                                      const Vec128<T, N> v) {
+  return ReverseWithin16(v);
+}
+template <typename T, size_t N>
+HWY_INLINE Vec128<T, N> ReverseWithin(hwy::SizeTag<4> /* tag */,
+                                      const Vec128<T, N> v) {
+  return ReverseWithin32(v);
+}
+template <typename T, size_t N>
+HWY_INLINE Vec128<T, N> ReverseWithin(hwy::SizeTag<8> /* tag */,
+                                      const Vec128<T, N> v) {
+  return ReverseWithin64(v);
+}
+
+}  // namespace detail
+
+// Single lane: no change
+template <typename T>
+HWY_API Vec128<T, 1> Reverse(Simd<T, 1> /* tag */, const Vec128<T, 1> v) {
+  return v;
+}
+
+// Two 32-bit lanes: swap
+template <typename T, HWY_IF_LANE_SIZE(T, 4)>
+HWY_API Vec128<T, 2> Reverse(Simd<T, 2> /* tag */, const Vec128<T, 2> v) {
+  return Shuffle2301(v);
+}
+
+template <typename T, HWY_IF_LANE_SIZE(T, 8)>
+HWY_API Vec128<T> Reverse(Full128<T> /* tag */, const Vec128<T> v) {
+  return Shuffle01(v);
+}
+
+template <typename T, HWY_IF_LANE_SIZE(T, 4)>
+HWY_API Vec128<T> Reverse(Full128<T> /* tag */, const Vec128<T> v) {
+  return Shuffle0123(v);
+}
+
+// 8/16-bit: reverse within 64-bit halves, then swap them.
+template <typename T, hwy::EnableIf<sizeof(T) <= 2>* = nullptr>
+HWY_API Vec128<T> Reverse(Full128<T> d, const Vec128<T> v) {
+  const Repartition<uint64_t, decltype(d)> du64;
+  return BitCast(d, Shuffle01(BitCast(du64, detail::ReverseWithin64(v))));
+}
+
+// 8/16-bit partial vectors: all lanes are within one 16/32/64-bit group.
+template <typename T, size_t N,
+          hwy::EnableIf<(N > 1 && sizeof(T) <= 2 && N * sizeof(T) <= 8)>* =
+              nullptr>
+HWY_API Vec128<T, N> Reverse(Simd<T, N> /* tag */, const Vec128<T, N> v) {
+  return detail::ReverseWithin(hwy::SizeTag<N * sizeof(T)>(), v);
+}
+
+// ------------------------------ Reverse2
+
+template <typename T, size_t N, hwy::EnableIf<sizeof(T) <= 2>* = nullptr>
+HWY_API Vec128<T, N> Reverse2(Simd<T, N> /* tag */, const Vec128<T, N> v) {
+  return detail::ReverseWithin(hwy::SizeTag<sizeof(T) * 2>(), v);
+}
+
+template <typename T, size_t N, HWY_IF_LANE_SIZE(T, 4)>
+HWY_API Vec128<T, N> Reverse2(Simd<T, N> /* tag */, const Vec128<T, N> v) {
+  return Shuffle2301(v);
+}
+
+template <typename T, HWY_IF_LANE_SIZE(T, 8)>
+HWY_API Vec128<T> Reverse2(Full128<T> /* tag */, const Vec128<T> v) {
+  return Shuffle01(v);
+}
+
+// ------------------------------ Reverse4
+
+template <typename T, size_t N, hwy::EnableIf<sizeof(T) <= 2>* = nullptr>
+HWY_API Vec128<T, N> Reverse4(Simd<T, N> /* tag */, const Vec128<T, N> v) {
+  return detail::ReverseWithin(hwy::SizeTag<sizeof(T) * 4>(), v);
+}
+
+template <typename T, HWY_IF_LANE_SIZE(T, 4)>
+HWY_API Vec128<T> Reverse4(Full128<T> /* tag */, const Vec128<T> v) {
+  return Shuffle0123(v);
+}
+
+// ------------------------------ Reverse8
+
+template <typename T, size_t N, HWY_IF_LANE_SIZE(T, 1)>
+HWY_API Vec128<T, N> Reverse8(Simd<T, N> /* tag */, const Vec128<T, N> v) {
+  return detail::ReverseWithin64(v);
+}
+
+// Eight 16-bit lanes: same as Reverse.
+template <typename T, HWY_IF_LANE_SIZE(T, 2)>
+HWY_API Vec128<T> Reverse8(Full128<T> d, const Vec128<T> v) {
+  return Reverse(d, v);
+}
+
+// ------------------------------ ReverseBlocks
+
+// Single block: no change
+template <typename T, size_t N>
+HWY_API Vec128<T, N> ReverseBlocks(Simd<T, N> /* tag */, const Vec128<T, N> v) {
+  return v;
+}
+
 // ------------------------------ InterleaveLower
 
 // Interleaves lanes from halves of the 128-bit blocks of "a" (which provides
@@ -3715,6 +4182,62 @@ HWY_API Vec128<T, N> OddEven(const Vec128<T, N> a, const Vec128<T, N> b) {
   return IfThenElse(MaskFromVec(vec), b, a);
 }
 
+// ------------------------------ ReorderDemote2To (Combine)
+
+// For 128-bit vectors, the lane order is already preserved.
+HWY_API Vec128<int16_t> ReorderDemote2To(Full128<int16_t> /* tag */,
+                                         Vec128<int32_t> a, Vec128<int32_t> b) {
+#if HWY_ARCH_ARM_A64
+  return Vec128<int16_t>(vqmovn_high_s32(vqmovn_s32(a.raw), b.raw));
+#else
+  return Vec128<int16_t>(vcombine_s16(vqmovn_s32(a.raw), vqmovn_s32(b.raw)));
+#endif
+}
+
+HWY_API Vec128<uint16_t> ReorderDemote2To(Full128<uint16_t> /* tag */,
+                                          Vec128<int32_t> a,
+                                          Vec128<int32_t> b) {
+#if HWY_ARCH_ARM_A64
+  return Vec128<uint16_t>(vqmovun_high_s32(vqmovun_s32(a.raw), b.raw));
+#else
+  return Vec128<uint16_t>(
+      vcombine_u16(vqmovun_s32(a.raw), vqmovun_s32(b.raw)));
+#endif
+}
+
+HWY_API Vec128<uint8_t> ReorderDemote2To(Full128<uint8_t> /* tag */,
+                                         Vec128<int16_t> a, Vec128<int16_t> b) {
+#if HWY_ARCH_ARM_A64
+  return Vec128<uint8_t>(vqmovun_high_s16(vqmovun_s16(a.raw), b.raw));
+#else
+  return Vec128<uint8_t>(vcombine_u8(vqmovun_s16(a.raw), vqmovun_s16(b.raw)));
+#endif
+}
+
+HWY_API Vec128<int8_t> ReorderDemote2To(Full128<int8_t> /* tag */,
+                                        Vec128<int16_t> a, Vec128<int16_t> b) {
+#if HWY_ARCH_ARM_A64
+  return Vec128<int8_t>(vqmovn_high_s16(vqmovn_s16(a.raw), b.raw));
+#else
+  return Vec128<int8_t>(vcombine_s8(vqmovn_s16(a.raw), vqmovn_s16(b.raw)));
+#endif
+}
+
+// Partial: first concatenate the inputs into one vector, then demote that.
+template <typename TN, size_t N, typename TW, HWY_IF_LE64(TN, N)>
+HWY_API Vec128<TN, N> ReorderDemote2To(Simd<TN, N> dn, Vec128<TW, N / 2> a,
+                                       Vec128<TW, N / 2> b) {
+  return DemoteTo(dn, Combine(Simd<TW, N>(), b, a));
+}
+
+// ------------------------------ OrderedDemote2To
+
+template <typename TN, size_t N, typename TW>
+HWY_API Vec128<TN, N> OrderedDemote2To(Simd<TN, N> dn, Vec128<TW, N / 2> a,
+                                       Vec128<TW, N / 2> b) {
+  return ReorderDemote2To(dn, a, b);
+}
+
 // ================================================== CRYPTO
 
 #if defined(__ARM_FEATURE_AES)
@@ -3812,6 +4335,78 @@ HWY_API VI TableLookupBytesOr0(const V bytes, const VI from) {
   return TableLookupBytes(bytes, from);
 }
 
+// ------------------------------ TableLookupBytes64, TableLookupBytes128
+
+// vqtbl4 (and vqtbx4) are only available on A64.
+#if HWY_ARCH_ARM_A64
+
+#ifdef HWY_NATIVE_TABLE_LOOKUP_BYTES64
+#undef HWY_NATIVE_TABLE_LOOKUP_BYTES64
+#else
+#define HWY_NATIVE_TABLE_LOOKUP_BYTES64
+#endif
+
+namespace detail {
+
+template <typename T>
+HWY_INLINE uint8x16x4_t LoadTable64(const T* HWY_RESTRICT table) {
+  const Full128<T> d;
+  const Full128<uint8_t> d8;
+  uint8x16x4_t tbl;
+  tbl.val[0] = BitCast(d8, LoadU(d, table + 0)).raw;
+  tbl.val[1] = BitCast(d8, LoadU(d, table + 16)).raw;
+  tbl.val[2] = BitCast(d8, LoadU(d, table + 32)).raw;
+  tbl.val[3] = BitCast(d8, LoadU(d, table + 48)).raw;
+  return tbl;
+}
+
+}  // namespace detail
+
+template <typename T, HWY_IF_LANE_SIZE(T, 1)>
+HWY_API Vec128<T> TableLookupBytes64(Full128<T> d, const T* HWY_RESTRICT table,
+                                     const Vec128<T> idx) {
+  const Full128<uint8_t> d8;
+  const uint8x16x4_t tbl = detail::LoadTable64(table);
+  return BitCast(d, Vec128<uint8_t>(vqtbl4q_u8(tbl, BitCast(d8, idx).raw)));
+}
+
+template <typename T, size_t N, HWY_IF_LANE_SIZE(T, 1), HWY_IF_LE64(T, N)>
+HWY_API Vec128<T, N> TableLookupBytes64(Simd<T, N> d,
+                                        const T* HWY_RESTRICT table,
+                                        const Vec128<T, N> idx) {
+  const Simd<uint8_t, N> d8;
+  const uint8x16x4_t tbl = detail::LoadTable64(table);
+  return BitCast(d, Vec128<uint8_t, N>(vqtbl4_u8(tbl, BitCast(d8, idx).raw)));
+}
+
+// vqtbx4 leaves lanes unchanged if idx - 64 is out of range, i.e. idx < 64.
+template <typename T, HWY_IF_LANE_SIZE(T, 1)>
+HWY_API Vec128<T> TableLookupBytes128(Full128<T> d,
+                                      const T* HWY_RESTRICT table,
+                                      const Vec128<T> idx) {
+  const Full128<uint8_t> d8;
+  const uint8x16_t idx8 = BitCast(d8, idx).raw;
+  const uint8x16_t lower = vqtbl4q_u8(detail::LoadTable64(table), idx8);
+  const uint8x16x4_t tbl_upper = detail::LoadTable64(table + 64);
+  const uint8x16_t idx_upper = vsubq_u8(idx8, vdupq_n_u8(64));
+  return BitCast(d, Vec128<uint8_t>(vqtbx4q_u8(lower, tbl_upper, idx_upper)));
+}
+
+template <typename T, size_t N, HWY_IF_LANE_SIZE(T, 1), HWY_IF_LE64(T, N)>
+HWY_API Vec128<T, N> TableLookupBytes128(Simd<T, N> d,
+                                         const T* HWY_RESTRICT table,
+                                         const Vec128<T, N> idx) {
+  const Simd<uint8_t, N> d8;
+  const uint8x8_t idx8 = BitCast(d8, idx).raw;
+  const uint8x8_t lower = vqtbl4_u8(detail::LoadTable64(table), idx8);
+  const uint8x16x4_t tbl_upper = detail::LoadTable64(table + 64);
+  const uint8x8_t idx_upper = vsub_u8(idx8, vdup_n_u8(64));
+  return BitCast(d,
+                 Vec128<uint8_t, N>(vqtbx4_u8(lower, tbl_upper, idx_upper)));
+}
+
+#endif  // HWY_ARCH_ARM_A64
+
 // ------------------------------ Scatter (Store)
 
 template <typename T, size_t N, typename Offset, HWY_IF_LE128(T, N)>
@@ -3827,7 +4422,8 @@ HWY_API void ScatterOffset(Vec128<T, N> v, Simd<T, N> d, T* HWY_RESTRICT base,
 
   uint8_t* base_bytes = reinterpret_cast<uint8_t*>(base);
   for (size_t i = 0; i < N; ++i) {
-    CopyBytes<sizeof(T)>(&lanes[i], base_bytes + offset_lanes[i]);
+    CopyBytes<sizeof(T)>(
+        &lanes[i], base_bytes + detail::ScatterGatherIndex(offset_lanes[i]));
   }
 }
 
@@ -3843,7 +4439,7 @@ HWY_API void ScatterIndex(Vec128<T, N> v, Simd<T, N> d, T* HWY_RESTRICT base,
   Store(index, Simd<Index, N>(), index_lanes);
 
   for (size_t i = 0; i < N; ++i) {
-    base[index_lanes[i]] = lanes[i];
+    base[detail::ScatterGatherIndex(index_lanes[i])] = lanes[i];
   }
 }
 
@@ -3861,7 +4457,8 @@ HWY_API Vec128<T, N> GatherOffset(const Simd<T, N> d,
   alignas(16) T lanes[N];
   const uint8_t* base_bytes = reinterpret_cast<const uint8_t*>(base);
   for (size_t i = 0; i < N; ++i) {
-    CopyBytes<sizeof(T)>(base_bytes + offset_lanes[i], &lanes[i]);
+    CopyBytes<sizeof(T)>(
+        base_bytes + detail::ScatterGatherIndex(offset_lanes[i]), &lanes[i]);
   }
   return Load(d, lanes);
 }
@@ -3876,7 +4473,7 @@ HWY_API Vec128<T, N> GatherIndex(const Simd<T, N> d, const T* HWY_RESTRICT base,
 
   alignas(16) T lanes[N];
   for (size_t i = 0; i < N; ++i) {
-    lanes[i] = base[index_lanes[i]];
+    lanes[i] = base[detail::ScatterGatherIndex(index_lanes[i])];
   }
   return Load(d, lanes);
 }
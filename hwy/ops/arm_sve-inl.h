@@ -436,8 +436,35 @@ HWY_API V AndNot(const V a, const V b) {
                    sv##OP##_##CHAR##BITS##_x(HWY_SVE_PTRUE(BITS), v)); \
   }
 HWY_SVE_FOREACH_UI(HWY_SVE_POPCNT, PopulationCount, cnt)
+
+// ------------------------------ LeadingZeroCount
+
+#ifdef HWY_NATIVE_LEADING_ZERO_COUNT
+#undef HWY_NATIVE_LEADING_ZERO_COUNT
+#else
+#define HWY_NATIVE_LEADING_ZERO_COUNT
+#endif
+
+HWY_SVE_FOREACH_UI(HWY_SVE_POPCNT, LeadingZeroCount, clz)
 #undef HWY_SVE_POPCNT
 
+// ------------------------------ ReverseBits
+
+#ifdef HWY_NATIVE_REVERSE_BITS
+#undef HWY_NATIVE_REVERSE_BITS
+#else
+#define HWY_NATIVE_REVERSE_BITS
+#endif
+
+HWY_SVE_FOREACH_UI(HWY_SVE_RETV_ARGPV, ReverseBits, rbit)
+
+// ------------------------------ TrailingZeroCount (ReverseBits)
+
+template <class V>
+HWY_API V TrailingZeroCount(const V v) {
+  return LeadingZeroCount(ReverseBits(v));
+}
+
 // ================================================== SIGN
 
 // ------------------------------ Neg
@@ -555,10 +582,19 @@ HWY_SVE_FOREACH_UIF3264(HWY_SVE_RETV_ARGPVV, Mul, mul)
 
 // ------------------------------ MulHigh
 HWY_SVE_FOREACH_UI16(HWY_SVE_RETV_ARGPVV, MulHigh, mulh)
-namespace detail {
 HWY_SVE_FOREACH_UI32(HWY_SVE_RETV_ARGPVV, MulHigh, mulh)
-HWY_SVE_FOREACH_U64(HWY_SVE_RETV_ARGPVV, MulHigh, mulh)
-}  // namespace detail
+HWY_SVE_FOREACH_UI64(HWY_SVE_RETV_ARGPVV, MulHigh, mulh)
+
+// ------------------------------ MulFixedPoint15
+#if HWY_TARGET == HWY_SVE2
+#ifdef HWY_NATIVE_MUL_FIXED_POINT15
+#undef HWY_NATIVE_MUL_FIXED_POINT15
+#else
+#define HWY_NATIVE_MUL_FIXED_POINT15
+#endif
+
+HWY_SVE_FOREACH_I16(HWY_SVE_RETV_ARGVV, MulFixedPoint15, qrdmulh)
+#endif  // HWY_TARGET == HWY_SVE2
 
 // ------------------------------ Div
 HWY_SVE_FOREACH_F(HWY_SVE_RETV_ARGPVV, Div, div)
@@ -764,6 +800,12 @@ HWY_API VFromD<D> VecFromMask(const D d, svbool_t mask) {
 
 // ------------------------------ Load/MaskedLoad/LoadDup128/Store/Stream
 
+#ifdef HWY_NATIVE_BLENDED_STORE
+#undef HWY_NATIVE_BLENDED_STORE
+#else
+#define HWY_NATIVE_BLENDED_STORE
+#endif
+
 #define HWY_SVE_LOAD(BASE, CHAR, BITS, NAME, OP)           \
   template <size_t N>                                      \
   HWY_API HWY_SVE_V(BASE, BITS)                            \
@@ -796,16 +838,27 @@ HWY_API VFromD<D> VecFromMask(const D d, svbool_t mask) {
     sv##OP##_##CHAR##BITS(detail::Mask(d), p, v);                        \
   }
 
+// Only lanes that are active in both m and d are written.
+#define HWY_SVE_BLENDED_STORE(BASE, CHAR, BITS, NAME, OP)               \
+  template <size_t N>                                                   \
+  HWY_API void NAME(HWY_SVE_V(BASE, BITS) v, svbool_t m,                \
+                    HWY_SVE_D(BASE, BITS, N) d,                         \
+                    HWY_SVE_T(BASE, BITS) * HWY_RESTRICT p) {           \
+    sv##OP##_##CHAR##BITS(svand_b_z(detail::Mask(d), m, m), p, v);      \
+  }
+
 HWY_SVE_FOREACH(HWY_SVE_LOAD, Load, ld1)
 HWY_SVE_FOREACH(HWY_SVE_MASKED_LOAD, MaskedLoad, ld1)
 HWY_SVE_FOREACH(HWY_SVE_LOAD_DUP128, LoadDup128, ld1rq)
 HWY_SVE_FOREACH(HWY_SVE_STORE, Store, st1)
 HWY_SVE_FOREACH(HWY_SVE_STORE, Stream, stnt1)
+HWY_SVE_FOREACH(HWY_SVE_BLENDED_STORE, BlendedStore, st1)
 
 #undef HWY_SVE_LOAD
 #undef HWY_SVE_MASKED_LOAD
 #undef HWY_SVE_LOAD_DUP128
 #undef HWY_SVE_STORE
+#undef HWY_SVE_BLENDED_STORE
 
 // ------------------------------ Load/StoreU
 
@@ -869,6 +922,111 @@ HWY_SVE_FOREACH_UIF3264(HWY_SVE_GATHER_INDEX, GatherIndex, ld1_gather)
 #undef HWY_SVE_GATHER_OFFSET
 #undef HWY_SVE_GATHER_INDEX
 
+// SVE only has 32/64-bit scatter/gather; copy 8/16-bit lanes one at a time.
+
+template <class D, hwy::EnableIf<(sizeof(TFromD<D>) <= 2)>* = nullptr>
+HWY_API void ScatterOffset(VFromD<D> v, D d, TFromD<D>* HWY_RESTRICT base,
+                           VFromD<RebindToSigned<D>> offset) {
+  using T = TFromD<D>;
+  const RebindToSigned<decltype(d)> di;
+  HWY_ALIGN T lanes[MaxLanes(d)];
+  Store(v, d, lanes);
+  HWY_ALIGN TFromD<decltype(di)> offset_lanes[MaxLanes(d)];
+  Store(offset, di, offset_lanes);
+
+  uint8_t* base_bytes = reinterpret_cast<uint8_t*>(base);
+  for (size_t i = 0; i < Lanes(d); ++i) {
+    CopyBytes<sizeof(T)>(
+        &lanes[i], base_bytes + detail::ScatterGatherIndex(offset_lanes[i]));
+  }
+}
+
+template <class D, hwy::EnableIf<(sizeof(TFromD<D>) <= 2)>* = nullptr>
+HWY_API void ScatterIndex(VFromD<D> v, D d, TFromD<D>* HWY_RESTRICT base,
+                          VFromD<RebindToSigned<D>> index) {
+  const RebindToSigned<decltype(d)> di;
+  HWY_ALIGN TFromD<D> lanes[MaxLanes(d)];
+  Store(v, d, lanes);
+  HWY_ALIGN TFromD<decltype(di)> index_lanes[MaxLanes(d)];
+  Store(index, di, index_lanes);
+
+  for (size_t i = 0; i < Lanes(d); ++i) {
+    base[detail::ScatterGatherIndex(index_lanes[i])] = lanes[i];
+  }
+}
+
+template <class D, hwy::EnableIf<(sizeof(TFromD<D>) <= 2)>* = nullptr>
+HWY_API VFromD<D> GatherOffset(D d, const TFromD<D>* HWY_RESTRICT base,
+                               VFromD<RebindToSigned<D>> offset) {
+  using T = TFromD<D>;
+  const RebindToSigned<decltype(d)> di;
+  HWY_ALIGN TFromD<decltype(di)> offset_lanes[MaxLanes(d)];
+  Store(offset, di, offset_lanes);
+
+  HWY_ALIGN T lanes[MaxLanes(d)];
+  const uint8_t* base_bytes = reinterpret_cast<const uint8_t*>(base);
+  for (size_t i = 0; i < Lanes(d); ++i) {
+    CopyBytes<sizeof(T)>(
+        base_bytes + detail::ScatterGatherIndex(offset_lanes[i]), &lanes[i]);
+  }
+  return Load(d, lanes);
+}
+
+template <class D, hwy::EnableIf<(sizeof(TFromD<D>) <= 2)>* = nullptr>
+HWY_API VFromD<D> GatherIndex(D d, const TFromD<D>* HWY_RESTRICT base,
+                              VFromD<RebindToSigned<D>> index) {
+  const RebindToSigned<decltype(d)> di;
+  HWY_ALIGN TFromD<decltype(di)> index_lanes[MaxLanes(d)];
+  Store(index, di, index_lanes);
+
+  HWY_ALIGN TFromD<D> lanes[MaxLanes(d)];
+  for (size_t i = 0; i < Lanes(d); ++i) {
+    lanes[i] = base[detail::ScatterGatherIndex(index_lanes[i])];
+  }
+  return Load(d, lanes);
+}
+
+// ------------------------------ MaskedGatherIndex
+
+#ifdef HWY_NATIVE_MASKED_GATHER
+#undef HWY_NATIVE_MASKED_GATHER
+#else
+#define HWY_NATIVE_MASKED_GATHER
+#endif
+
+#define HWY_SVE_MASKED_GATHER_INDEX(BASE, CHAR, BITS, NAME, OP)            \
+  template <size_t N>                                                      \
+  HWY_API HWY_SVE_V(BASE, BITS)                                            \
+      NAME(svbool_t m, HWY_SVE_D(BASE, BITS, N) d,                         \
+           const HWY_SVE_T(BASE, BITS) * HWY_RESTRICT base,                \
+           HWY_SVE_V(int, BITS) index) {                                   \
+    return sv##OP##_s##BITS##index_##CHAR##BITS(                           \
+        svand_b_z(detail::Mask(d), m, m), base, index);                    \
+  }
+
+HWY_SVE_FOREACH_UIF3264(HWY_SVE_MASKED_GATHER_INDEX, MaskedGatherIndex,
+                        ld1_gather)
+#undef HWY_SVE_MASKED_GATHER_INDEX
+
+template <class D, hwy::EnableIf<(sizeof(TFromD<D>) <= 2)>* = nullptr>
+HWY_API VFromD<D> MaskedGatherIndex(svbool_t m, D d,
+                                    const TFromD<D>* HWY_RESTRICT base,
+                                    VFromD<RebindToSigned<D>> index) {
+  using T = TFromD<D>;
+  const RebindToSigned<decltype(d)> di;
+  HWY_ALIGN TFromD<decltype(di)> index_lanes[MaxLanes(d)];
+  HWY_ALIGN TFromD<decltype(di)> mask_lanes[MaxLanes(d)];
+  Store(index, di, index_lanes);
+  Store(BitCast(di, VecFromMask(d, m)), di, mask_lanes);
+
+  HWY_ALIGN T lanes[MaxLanes(d)];
+  for (size_t i = 0; i < Lanes(d); ++i) {
+    lanes[i] = mask_lanes[i] ? base[detail::ScatterGatherIndex(index_lanes[i])]
+                             : T(0);
+  }
+  return Load(d, lanes);
+}
+
 // ------------------------------ StoreInterleaved3
 
 #define HWY_SVE_STORE3(BASE, CHAR, BITS, NAME, OP)                            \
@@ -969,6 +1127,17 @@ HWY_API svfloat64_t PromoteTo(Simd<float64_t, N> /* d */, const svint32_t v) {
   return svcvt_f64_s32_x(detail::PTrue(Simd<int32_t, N>()), v);
 }
 
+// ------------------------------ SumsOf2 F
+
+// cvt reads the even (lower) f32 of each 64-bit lane.
+HWY_API svfloat64_t SumsOf2(const svfloat32_t v) {
+  const DFromV<decltype(v)> df32;
+  const Repartition<uint64_t, decltype(df32)> du64;
+  const svbool_t pg = detail::PTrue(df32);
+  const svfloat32_t odd = BitCast(df32, ShiftRight<32>(BitCast(du64, v)));
+  return Add(svcvt_f64_f32_x(pg, v), svcvt_f64_f32_x(pg, odd));
+}
+
 // For 16-bit Compress
 namespace detail {
 HWY_SVE_FOREACH_UI32(HWY_SVE_PROMOTE_TO, PromoteUpperTo, unpkhi)
@@ -1222,6 +1391,82 @@ HWY_API VFromD<D> Combine(const D d, const V2 hi, const V2 lo) {
   return ConcatLowerLower(d, hi, lo);
 }
 
+// ------------------------------ ReorderDemote2To
+
+// Demoted lanes of a are in the even lanes, those of b in the odd lanes.
+
+template <size_t N>
+HWY_API svuint16_t ReorderDemote2To(Simd<uint16_t, N> dn, svint32_t a,
+                                    svint32_t b) {
+#if HWY_TARGET == HWY_SVE2
+  (void)dn;
+  return svqxtunt_s32(svqxtunb_s32(a), b);
+#else
+  const DFromV<decltype(a)> di;
+  const RebindToUnsigned<decltype(di)> du;
+  using TN = TFromD<decltype(dn)>;
+  const svuint32_t clamped_a = BitCast(du, Max(Zero(di), a));
+  const svuint32_t clamped_b = BitCast(du, Max(Zero(di), b));
+  const svuint16_t an = BitCast(dn, detail::SaturateU<TN>(clamped_a));
+  const svuint16_t bn = BitCast(dn, detail::SaturateU<TN>(clamped_b));
+  return svtrn1_u16(an, bn);
+#endif
+}
+
+template <size_t N>
+HWY_API svint16_t ReorderDemote2To(Simd<int16_t, N> dn, svint32_t a,
+                                   svint32_t b) {
+#if HWY_TARGET == HWY_SVE2
+  (void)dn;
+  return svqxtnt_s32(svqxtnb_s32(a), b);
+#else
+  using TN = TFromD<decltype(dn)>;
+  const svint16_t an = BitCast(dn, detail::SaturateI<TN>(a));
+  const svint16_t bn = BitCast(dn, detail::SaturateI<TN>(b));
+  return svtrn1_s16(an, bn);
+#endif
+}
+
+template <size_t N>
+HWY_API svuint8_t ReorderDemote2To(Simd<uint8_t, N> dn, svint16_t a,
+                                   svint16_t b) {
+#if HWY_TARGET == HWY_SVE2
+  (void)dn;
+  return svqxtunt_s16(svqxtunb_s16(a), b);
+#else
+  const DFromV<decltype(a)> di;
+  const RebindToUnsigned<decltype(di)> du;
+  using TN = TFromD<decltype(dn)>;
+  const svuint16_t clamped_a = BitCast(du, Max(Zero(di), a));
+  const svuint16_t clamped_b = BitCast(du, Max(Zero(di), b));
+  const svuint8_t an = BitCast(dn, detail::SaturateU<TN>(clamped_a));
+  const svuint8_t bn = BitCast(dn, detail::SaturateU<TN>(clamped_b));
+  return svtrn1_u8(an, bn);
+#endif
+}
+
+template <size_t N>
+HWY_API svint8_t ReorderDemote2To(Simd<int8_t, N> dn, svint16_t a,
+                                  svint16_t b) {
+#if HWY_TARGET == HWY_SVE2
+  (void)dn;
+  return svqxtnt_s16(svqxtnb_s16(a), b);
+#else
+  using TN = TFromD<decltype(dn)>;
+  const svint8_t an = BitCast(dn, detail::SaturateI<TN>(a));
+  const svint8_t bn = BitCast(dn, detail::SaturateI<TN>(b));
+  return svtrn1_s8(an, bn);
+#endif
+}
+
+// ------------------------------ OrderedDemote2To (Combine)
+
+template <class DN, class V>
+HWY_API VFromD<DN> OrderedDemote2To(DN dn, V a, V b) {
+  const Half<decltype(dn)> dnh;
+  return Combine(dn, DemoteTo(dnh, b), DemoteTo(dnh, a));
+}
+
 // ------------------------------ ZeroExtendVector
 
 template <class D, class V>
@@ -1272,6 +1517,24 @@ HWY_API V OddEven(const V odd, const V even) {
   return detail::InterleaveOdd(even_in_odd, odd);
 }
 
+// ------------------------------ DupEven/DupOdd
+
+#ifdef HWY_NATIVE_DUP_EVEN_ODD
+#undef HWY_NATIVE_DUP_EVEN_ODD
+#else
+#define HWY_NATIVE_DUP_EVEN_ODD
+#endif
+
+template <class V>
+HWY_API V DupEven(const V v) {
+  return detail::InterleaveEven(v, v);
+}
+
+template <class V>
+HWY_API V DupOdd(const V v) {
+  return detail::InterleaveOdd(v, v);
+}
+
 // ------------------------------ TableLookupLanes
 
 template <class D, class DI = RebindToSigned<D>>
@@ -1472,6 +1735,63 @@ HWY_API V Shuffle0123(const V v) {
   return Shuffle2301(Shuffle1032(v));
 }
 
+// ------------------------------ Reverse (TableLookupLanes)
+
+// svrev would reverse the entire hardware vector, which differs from Lanes(d)
+// for capped or fractional D, hence compute indices instead.
+template <class D, class V = VFromD<D>>
+HWY_API V Reverse(D d, V v) {
+  const RebindToUnsigned<D> du;
+  const RebindToSigned<D> di;
+  using TU = TFromD<decltype(du)>;
+  const auto idx = Sub(Set(du, static_cast<TU>(Lanes(d) - 1)), Iota(du, 0));
+  return TableLookupLanes(v, BitCast(di, idx));
+}
+
+// ------------------------------ Reverse2/4/8 (TableLookupLanes)
+
+namespace detail {
+
+template <size_t kGroup, class D, class V>
+HWY_INLINE V ReverseGroups(D d, V v) {
+  const RebindToUnsigned<D> du;
+  const RebindToSigned<D> di;
+  using TU = TFromD<decltype(du)>;
+  const auto idx = XorN(Iota(du, 0), static_cast<TU>(kGroup - 1));
+  return TableLookupLanes(v, BitCast(di, idx));
+}
+
+}  // namespace detail
+
+template <class D, class V = VFromD<D>>
+HWY_API V Reverse2(D d, V v) {
+  return detail::ReverseGroups<2>(d, v);
+}
+
+template <class D, class V = VFromD<D>>
+HWY_API V Reverse4(D d, V v) {
+  return detail::ReverseGroups<4>(d, v);
+}
+
+template <class D, class V = VFromD<D>>
+HWY_API V Reverse8(D d, V v) {
+  return detail::ReverseGroups<8>(d, v);
+}
+
+// ------------------------------ ReverseBlocks (TableLookupLanes)
+
+template <class D, class V = VFromD<D>>
+HWY_API V ReverseBlocks(D d, V v) {
+  const Repartition<uint64_t, D> du64;
+  const Repartition<int64_t, D> di64;
+  const size_t N = Lanes(du64);
+  if (N < 2) return v;  // Single (partial) block
+  // Reverse the u64 lanes, then swap each pair back into its original order.
+  const auto rev = Sub(Set(du64, N - 1), Iota(du64, 0));
+  const auto idx = detail::XorN(rev, 1);
+  return BitCast(d, TableLookupLanes(BitCast(du64, v), BitCast(di64, idx)));
+}
+
 // ------------------------------ TableLookupBytes
 
 template <class V, class VI>
@@ -1853,20 +2173,29 @@ HWY_API VFromD<DW> MulEven(const V a, const V b) {
   return BitCast(DW(), detail::MulEven(a, b));
 #else
   const auto lo = Mul(a, b);
-  const auto hi = detail::MulHigh(a, b);
+  const auto hi = MulHigh(a, b);
   return BitCast(DW(), detail::InterleaveEven(lo, hi));
 #endif
 }
 
 HWY_API svuint64_t MulEven(const svuint64_t a, const svuint64_t b) {
   const auto lo = Mul(a, b);
-  const auto hi = detail::MulHigh(a, b);
+  const auto hi = MulHigh(a, b);
   return detail::InterleaveEven(lo, hi);
 }
 
+// ------------------------------ MulOdd (InterleaveOdd)
+
+template <class V, class DW = RepartitionToWide<DFromV<V>>>
+HWY_API VFromD<DW> MulOdd(const V a, const V b) {
+  const auto lo = Mul(a, b);
+  const auto hi = MulHigh(a, b);
+  return BitCast(DW(), detail::InterleaveOdd(lo, hi));
+}
+
 HWY_API svuint64_t MulOdd(const svuint64_t a, const svuint64_t b) {
   const auto lo = Mul(a, b);
-  const auto hi = detail::MulHigh(a, b);
+  const auto hi = MulHigh(a, b);
   return detail::InterleaveOdd(lo, hi);
 }
 
@@ -78,6 +78,175 @@ HWY_API Vec<D> NaN(D d) {
   return BitCast(d, Set(di, LimitsMax<TFromD<decltype(di)>>()));
 }
 
+// ------------------------------ Masked arithmetic
+
+// "Include guard": skip if native masked arithmetic is available.
+#if (defined(HWY_NATIVE_MASKED_ARITH) == defined(HWY_TARGET_TOGGLE))
+#ifdef HWY_NATIVE_MASKED_ARITH
+#undef HWY_NATIVE_MASKED_ARITH
+#else
+#define HWY_NATIVE_MASKED_ARITH
+#endif
+
+template <class V, class M>
+HWY_API V MaskedAddOr(V no, M m, V a, V b) {
+  return IfThenElse(m, Add(a, b), no);
+}
+
+template <class V, class M>
+HWY_API V MaskedSubOr(V no, M m, V a, V b) {
+  return IfThenElse(m, Sub(a, b), no);
+}
+
+template <class V, class M>
+HWY_API V MaskedMulOr(V no, M m, V a, V b) {
+  return IfThenElse(m, Mul(a, b), no);
+}
+
+template <class V, class M>
+HWY_API V MaskedDivOr(V no, M m, V a, V b) {
+  return IfThenElse(m, Div(a, b), no);
+}
+
+template <class V, class M>
+HWY_API V MaskedMinOr(V no, M m, V a, V b) {
+  return IfThenElse(m, Min(a, b), no);
+}
+
+template <class V, class M>
+HWY_API V MaskedMaxOr(V no, M m, V a, V b) {
+  return IfThenElse(m, Max(a, b), no);
+}
+
+#endif  // HWY_NATIVE_MASKED_ARITH
+
+// Zeroing variants. Compilers fold the zero into AVX-512 zero-masking.
+template <class V, class M>
+HWY_API V MaskedAdd(M m, V a, V b) {
+  return MaskedAddOr(Zero(DFromV<V>()), m, a, b);
+}
+
+template <class V, class M>
+HWY_API V MaskedSub(M m, V a, V b) {
+  return MaskedSubOr(Zero(DFromV<V>()), m, a, b);
+}
+
+template <class V, class M>
+HWY_API V MaskedMul(M m, V a, V b) {
+  return MaskedMulOr(Zero(DFromV<V>()), m, a, b);
+}
+
+template <class V, class M>
+HWY_API V MaskedDiv(M m, V a, V b) {
+  return MaskedDivOr(Zero(DFromV<V>()), m, a, b);
+}
+
+template <class V, class M>
+HWY_API V MaskedMin(M m, V a, V b) {
+  return MaskedMinOr(Zero(DFromV<V>()), m, a, b);
+}
+
+template <class V, class M>
+HWY_API V MaskedMax(M m, V a, V b) {
+  return MaskedMaxOr(Zero(DFromV<V>()), m, a, b);
+}
+
+// ------------------------------ MulFixedPoint15
+
+#if (defined(HWY_NATIVE_MUL_FIXED_POINT15) == defined(HWY_TARGET_TOGGLE))
+#ifdef HWY_NATIVE_MUL_FIXED_POINT15
+#undef HWY_NATIVE_MUL_FIXED_POINT15
+#else
+#define HWY_NATIVE_MUL_FIXED_POINT15
+#endif
+
+template <class V>
+HWY_API V MulFixedPoint15(V a, V b) {
+  const DFromV<V> d;
+  static_assert(IsSame<TFromD<decltype(d)>, int16_t>(), "Only for i16");
+  const RebindToUnsigned<decltype(d)> du;
+  // The product is hi * 2^16 + lo, and we want (product + 2^14) >> 15. This is
+  // 2 * hi plus the rounded upper two bits of lo, which avoids 32-bit lanes.
+  const V hi = MulHigh(a, b);
+  const auto lo = BitCast(du, Mul(a, b));
+  const auto rounded = ShiftRight<1>(Add(ShiftRight<14>(lo), Set(du, 1)));
+  return Add(Add(hi, hi), BitCast(d, rounded));
+}
+
+#endif  // HWY_NATIVE_MUL_FIXED_POINT15
+
+// ------------------------------ MulHighRound
+
+// Returns (a * b + 2^(bits - 1)) >> bits, i.e. MulHigh rounded to nearest.
+// Adding 2^(bits - 1) increments the upper half iff the MSB of the lower half
+// is set. This cannot overflow because the upper half is never the maximum.
+template <class V>
+HWY_API V MulHighRound(V a, V b) {
+  const DFromV<V> d;
+  const RebindToUnsigned<decltype(d)> du;
+  constexpr int kMsb = static_cast<int>(sizeof(TFromD<decltype(d)>) * 8 - 1);
+  const auto lo = BitCast(du, Mul(a, b));
+  return Add(MulHigh(a, b), BitCast(d, ShiftRight<kMsb>(lo)));
+}
+
+// ------------------------------ BlendedStore
+
+// "Include guard": skip if native masked stores are available.
+#if (defined(HWY_NATIVE_BLENDED_STORE) == defined(HWY_TARGET_TOGGLE))
+#ifdef HWY_NATIVE_BLENDED_STORE
+#undef HWY_NATIVE_BLENDED_STORE
+#else
+#define HWY_NATIVE_BLENDED_STORE
+#endif
+
+// Writes lane by lane so that lanes whose mask is false are not touched; p may
+// therefore point to the last few elements of an array.
+template <class D>
+HWY_API void BlendedStore(VFromD<D> v, Mask<D> m, D d,
+                          TFromD<D>* HWY_RESTRICT p) {
+  const RebindToSigned<decltype(d)> di;
+  HWY_ALIGN TFromD<D> lanes[MaxLanes(d)];
+  HWY_ALIGN TFromD<decltype(di)> mask_lanes[MaxLanes(d)];
+  Store(v, d, lanes);
+  Store(BitCast(di, VecFromMask(d, m)), di, mask_lanes);
+  for (size_t i = 0; i < MaxLanes(d); ++i) {
+    if (mask_lanes[i] != 0) p[i] = lanes[i];
+  }
+}
+
+#endif  // HWY_NATIVE_BLENDED_STORE
+
+// ------------------------------ MaskedGatherIndex
+
+#if (defined(HWY_NATIVE_MASKED_GATHER) == defined(HWY_TARGET_TOGGLE))
+#ifdef HWY_NATIVE_MASKED_GATHER
+#undef HWY_NATIVE_MASKED_GATHER
+#else
+#define HWY_NATIVE_MASKED_GATHER
+#endif
+
+// Lanes whose mask is false are zero and their indices are not accessed.
+template <class D>
+HWY_API Vec<D> MaskedGatherIndex(Mask<D> m, D d,
+                                 const TFromD<D>* HWY_RESTRICT base,
+                                 Vec<RebindToSigned<D>> index) {
+  using T = TFromD<D>;
+  const RebindToSigned<decltype(d)> di;
+  HWY_ALIGN TFromD<decltype(di)> index_lanes[MaxLanes(d)];
+  HWY_ALIGN TFromD<decltype(di)> mask_lanes[MaxLanes(d)];
+  Store(index, di, index_lanes);
+  Store(BitCast(di, VecFromMask(d, m)), di, mask_lanes);
+
+  HWY_ALIGN T lanes[MaxLanes(d)];
+  for (size_t i = 0; i < MaxLanes(d); ++i) {
+    lanes[i] = mask_lanes[i] ? base[detail::ScatterGatherIndex(index_lanes[i])]
+                             : T(0);
+  }
+  return Load(d, lanes);
+}
+
+#endif  // HWY_NATIVE_MASKED_GATHER
+
 // ------------------------------ AESRound
 
 // Cannot implement on scalar: need at least 16 bytes for TableLookupBytes.
@@ -270,6 +439,185 @@ HWY_API V CLMulUpper(V a, V b) {
 #endif  // HWY_NATIVE_AES
 #endif  // HWY_TARGET != HWY_SCALAR
 
+// ------------------------------ TableLookupBytes64, TableLookupBytes128
+
+// "Include guard": skip if native large-table lookups are available.
+#if (defined(HWY_NATIVE_TABLE_LOOKUP_BYTES64) == defined(HWY_TARGET_TOGGLE))
+#ifdef HWY_NATIVE_TABLE_LOOKUP_BYTES64
+#undef HWY_NATIVE_TABLE_LOOKUP_BYTES64
+#else
+#define HWY_NATIVE_TABLE_LOOKUP_BYTES64
+#endif
+
+// Four 16-byte lookups (one per quarter of the table, broadcast to all
+// blocks) selected by bits 4 and 5 of the index.
+template <class D, typename T = TFromD<D>, HWY_IF_LANE_SIZE(T, 1)>
+HWY_API Vec<D> TableLookupBytes64(D d, const T* HWY_RESTRICT table,
+                                  const Vec<D> idx) {
+  const Simd<T, HWY_MAX(16, MaxLanes(d))> d_table;
+  const auto lo = And(idx, Set(d, T{15}));
+  const auto t0 = TableLookupBytes(LoadDup128(d_table, table + 0), lo);
+  const auto t1 = TableLookupBytes(LoadDup128(d_table, table + 16), lo);
+  const auto t2 = TableLookupBytes(LoadDup128(d_table, table + 32), lo);
+  const auto t3 = TableLookupBytes(LoadDup128(d_table, table + 48), lo);
+  const auto bit4 = TestBit(idx, Set(d, T{16}));
+  const auto t01 = IfThenElse(bit4, t1, t0);
+  const auto t23 = IfThenElse(bit4, t3, t2);
+  return IfThenElse(TestBit(idx, Set(d, T{32})), t23, t01);
+}
+
+template <class D, typename T = TFromD<D>, HWY_IF_LANE_SIZE(T, 1)>
+HWY_API Vec<D> TableLookupBytes128(D d, const T* HWY_RESTRICT table,
+                                   const Vec<D> idx) {
+  const auto lower = TableLookupBytes64(d, table, idx);
+  const auto upper = TableLookupBytes64(d, table + 64, idx);
+  return IfThenElse(TestBit(idx, Set(d, T{64})), upper, lower);
+}
+
+#endif  // HWY_NATIVE_TABLE_LOOKUP_BYTES64
+
+// ------------------------------ SumsOf8, SumsOfAbsDiff
+
+#if (defined(HWY_NATIVE_SUMS_OF_8) == defined(HWY_TARGET_TOGGLE))
+#ifdef HWY_NATIVE_SUMS_OF_8
+#undef HWY_NATIVE_SUMS_OF_8
+#else
+#define HWY_NATIVE_SUMS_OF_8
+#endif
+
+// Sums of each group of 8 consecutive u8, via successive widening pairwise
+// additions.
+template <class V, HWY_IF_LANES_ARE(uint8_t, V)>
+HWY_API Vec<Repartition<uint64_t, DFromV<V>>> SumsOf8(V v) {
+  const DFromV<V> d8;
+  const Repartition<uint16_t, decltype(d8)> d16;
+  const Repartition<uint32_t, decltype(d8)> d32;
+  const Repartition<uint64_t, decltype(d8)> d64;
+  const auto v16 = BitCast(d16, v);
+  const auto sum16 = Add(And(v16, Set(d16, 0xFF)), ShiftRight<8>(v16));
+  const auto v32 = BitCast(d32, sum16);
+  const auto sum32 = Add(And(v32, Set(d32, 0xFFFF)), ShiftRight<16>(v32));
+  const auto v64 = BitCast(d64, sum32);
+  return Add(And(v64, Set(d64, 0xFFFFFFFFu)), ShiftRight<32>(v64));
+}
+
+template <class V, HWY_IF_LANES_ARE(uint8_t, V)>
+HWY_API Vec<Repartition<uint64_t, DFromV<V>>> SumsOfAbsDiff(V a, V b) {
+  return SumsOf8(Or(SaturatedSub(a, b), SaturatedSub(b, a)));
+}
+
+#endif  // HWY_NATIVE_SUMS_OF_8
+
+// ------------------------------ PairwiseAdd
+
+// Even lanes: sums of adjacent pairs of a; odd lanes: likewise for b. Native
+// pairwise adds (NEON vpadd, x86 hadd) instead concatenate the sums of a and b,
+// which would require an additional shuffle, hence no native versions.
+template <class D, class V>
+HWY_API V PairwiseAdd(D d, V a, V b) {
+  return OddEven(Add(b, Reverse2(d, b)), Add(a, Reverse2(d, a)));
+}
+
+// ------------------------------ DupEven/DupOdd
+
+#if (defined(HWY_NATIVE_DUP_EVEN_ODD) == defined(HWY_TARGET_TOGGLE))
+#ifdef HWY_NATIVE_DUP_EVEN_ODD
+#undef HWY_NATIVE_DUP_EVEN_ODD
+#else
+#define HWY_NATIVE_DUP_EVEN_ODD
+#endif
+
+// Copies each even lane into the next (odd) lane.
+template <class V, hwy::EnableIf<(sizeof(TFromD<DFromV<V>>) >= 4)>* = nullptr>
+HWY_API V DupEven(const V v) {
+  return OddEven(ShiftLeftLanes<1>(DFromV<V>(), v), v);
+}
+
+// Copies each odd lane into the previous (even) lane.
+template <class V, hwy::EnableIf<(sizeof(TFromD<DFromV<V>>) >= 4)>* = nullptr>
+HWY_API V DupOdd(const V v) {
+  return OddEven(v, ShiftRightLanes<1>(DFromV<V>(), v));
+}
+
+#endif  // HWY_NATIVE_DUP_EVEN_ODD
+
+// ------------------------------ AddSub
+
+#if (defined(HWY_NATIVE_ADDSUB) == defined(HWY_TARGET_TOGGLE))
+#ifdef HWY_NATIVE_ADDSUB
+#undef HWY_NATIVE_ADDSUB
+#else
+#define HWY_NATIVE_ADDSUB
+#endif
+
+// Even lanes: a - b; odd lanes: a + b.
+template <class V, HWY_IF_FLOAT_D(DFromV<V>)>
+HWY_API V AddSub(const V a, const V b) {
+  return OddEven(Add(a, b), Sub(a, b));
+}
+
+#endif  // HWY_NATIVE_ADDSUB
+
+// ------------------------------ SumsOf2
+
+namespace detail {
+
+// Sums of adjacent pairs of integer lanes, each pair viewed as a wide lane.
+template <class V, HWY_IF_UNSIGNED_D(DFromV<V>)>
+HWY_INLINE Vec<RepartitionToWide<DFromV<V>>> SumsOf2ViaShift(V v) {
+  using T = TFromD<DFromV<V>>;
+  const RepartitionToWide<DFromV<V>> dw;
+  using TW = TFromD<decltype(dw)>;
+  constexpr int kBits = static_cast<int>(sizeof(T) * 8);
+  const auto wide = BitCast(dw, v);
+  const auto lower = And(wide, Set(dw, static_cast<TW>(LimitsMax<T>())));
+  return Add(lower, ShiftRight<kBits>(wide));
+}
+
+template <class V, HWY_IF_SIGNED_D(DFromV<V>)>
+HWY_INLINE Vec<RepartitionToWide<DFromV<V>>> SumsOf2ViaShift(V v) {
+  using T = TFromD<DFromV<V>>;
+  const RepartitionToWide<DFromV<V>> dw;
+  constexpr int kBits = static_cast<int>(sizeof(T) * 8);
+  const auto wide = BitCast(dw, v);
+  // Arithmetic shifts sign-extend the lower and upper halves.
+  return Add(ShiftRight<kBits>(ShiftLeft<kBits>(wide)),
+             ShiftRight<kBits>(wide));
+}
+
+}  // namespace detail
+
+#if (defined(HWY_NATIVE_SUMS_OF_2) == defined(HWY_TARGET_TOGGLE))
+#ifdef HWY_NATIVE_SUMS_OF_2
+#undef HWY_NATIVE_SUMS_OF_2
+#else
+#define HWY_NATIVE_SUMS_OF_2
+#endif
+
+template <class V, HWY_IF_NOT_FLOAT_D(DFromV<V>),
+          hwy::EnableIf<(sizeof(TFromD<DFromV<V>>) <= 2)>* = nullptr>
+HWY_API Vec<RepartitionToWide<DFromV<V>>> SumsOf2(V v) {
+  return detail::SumsOf2ViaShift(v);
+}
+
+#endif  // HWY_NATIVE_SUMS_OF_2
+
+// Separate from the above because x86 only has native 8/16-bit versions.
+#if (defined(HWY_NATIVE_SUMS_OF_2_32) == defined(HWY_TARGET_TOGGLE))
+#ifdef HWY_NATIVE_SUMS_OF_2_32
+#undef HWY_NATIVE_SUMS_OF_2_32
+#else
+#define HWY_NATIVE_SUMS_OF_2_32
+#endif
+
+template <class V, HWY_IF_NOT_FLOAT_D(DFromV<V>),
+          HWY_IF_LANE_SIZE_D(DFromV<V>, 4)>
+HWY_API Vec<RepartitionToWide<DFromV<V>>> SumsOf2(V v) {
+  return detail::SumsOf2ViaShift(v);
+}
+
+#endif  // HWY_NATIVE_SUMS_OF_2_32
+
 // "Include guard": skip if native POPCNT-related instructions are available.
 #if (defined(HWY_NATIVE_POPCNT) == defined(HWY_TARGET_TOGGLE))
 #ifdef HWY_NATIVE_POPCNT
@@ -310,14 +658,267 @@ HWY_API V PopulationCount(V v) {
 template <typename V, HWY_IF_LANES_ARE(uint64_t, V)>
 HWY_API V PopulationCount(V v) {
   const DFromV<V> d;
-  Repartition<uint32_t, decltype(d)> d32;
-  auto vals = BitCast(d, PopulationCount(BitCast(d32, v)));
-  return Add(ShiftRight<32>(vals), And(vals, Set(d, 0xFF)));
+  Repartition<uint8_t, decltype(d)> d8;
+  return SumsOf8(PopulationCount(BitCast(d8, v)));
 }
 #endif
 
 #endif  // HWY_NATIVE_POPCNT
 
+// "Include guard": skip if native LeadingZeroCount/TrailingZeroCount exist.
+#if (defined(HWY_NATIVE_LEADING_ZERO_COUNT) == defined(HWY_TARGET_TOGGLE))
+#ifdef HWY_NATIVE_LEADING_ZERO_COUNT
+#undef HWY_NATIVE_LEADING_ZERO_COUNT
+#else
+#define HWY_NATIVE_LEADING_ZERO_COUNT
+#endif
+
+template <class V>
+HWY_API V LeadingZeroCount(V v) {
+  const DFromV<V> d;
+  const RebindToUnsigned<decltype(d)> du;
+  constexpr int kBits = static_cast<int>(sizeof(TFromD<decltype(d)>) * 8);
+  // Smear the most-significant 1-bit into all lower bits, then count them.
+  auto smeared = BitCast(du, v);
+  for (int shift = 1; shift < kBits; shift *= 2) {
+    smeared = Or(smeared, ShiftRightSame(smeared, shift));
+  }
+  return BitCast(d, Sub(Set(du, kBits), PopulationCount(smeared)));
+}
+
+template <class V>
+HWY_API V TrailingZeroCount(V v) {
+  const DFromV<V> d;
+  const RebindToUnsigned<decltype(d)> du;
+  const auto vu = BitCast(du, v);
+  // All bits below the least-significant 1-bit (all bits if v is zero).
+  const auto below = AndNot(vu, Sub(vu, Set(du, 1)));
+  return BitCast(d, PopulationCount(below));
+}
+
+#endif  // HWY_NATIVE_LEADING_ZERO_COUNT
+
+// "Include guard": skip if native ReverseBits exists.
+#if (defined(HWY_NATIVE_REVERSE_BITS) == defined(HWY_TARGET_TOGGLE))
+#ifdef HWY_NATIVE_REVERSE_BITS
+#undef HWY_NATIVE_REVERSE_BITS
+#else
+#define HWY_NATIVE_REVERSE_BITS
+#endif
+
+template <class V>
+HWY_API V ReverseBits(V v) {
+  const DFromV<V> d;
+  const RebindToUnsigned<decltype(d)> du;
+  using TU = TFromD<decltype(du)>;
+  constexpr int kBits = static_cast<int>(sizeof(TU) * 8);
+  auto vu = BitCast(du, v);
+  // Swap adjacent groups of 1, 2, 4 .. kBits/2 bits. The masks select the
+  // lower group of each pair: 0x55.., 0x33.., 0x0F.., 0x00FF.. etc.
+  for (int shift = 1; shift < kBits; shift *= 2) {
+    const TU divisor = static_cast<TU>((TU{1} << shift) + 1);
+    const auto mask = Set(du, static_cast<TU>(LimitsMax<TU>() / divisor));
+    vu = Or(And(ShiftRightSame(vu, shift), mask),
+            ShiftLeftSame(And(vu, mask), shift));
+  }
+  return BitCast(d, vu);
+}
+
+#endif  // HWY_NATIVE_REVERSE_BITS
+
+// "Include guard": skip if native RotateRight exists.
+#if (defined(HWY_NATIVE_ROTATE) == defined(HWY_TARGET_TOGGLE))
+#ifdef HWY_NATIVE_ROTATE
+#undef HWY_NATIVE_ROTATE
+#else
+#define HWY_NATIVE_ROTATE
+#endif
+
+template <int kBits, class V>
+HWY_API V RotateRight(const V v) {
+  const DFromV<V> d;
+  const RebindToUnsigned<decltype(d)> du;
+  constexpr int kSizeInBits = static_cast<int>(sizeof(TFromD<decltype(d)>) * 8);
+  static_assert(0 <= kBits && kBits < kSizeInBits, "Invalid shift count");
+  const auto vu = BitCast(du, v);
+  // For kBits = 0, both shifts are zero and Or returns v.
+  constexpr int kLeft = (kSizeInBits - kBits) & (kSizeInBits - 1);
+  return BitCast(d, Or(ShiftRight<kBits>(vu), ShiftLeft<kLeft>(vu)));
+}
+
+#endif  // HWY_NATIVE_ROTATE
+
+template <int kBits, class V>
+HWY_API V RotateLeft(const V v) {
+  constexpr int kSizeInBits = static_cast<int>(sizeof(TFromD<DFromV<V>>) * 8);
+  static_assert(0 <= kBits && kBits < kSizeInBits, "Invalid shift count");
+  return RotateRight<(kSizeInBits - kBits) & (kSizeInBits - 1)>(v);
+}
+
+// ------------------------------ IsNaN, IsInf, IsFinite, GetExponent, LdExp
+
+// "Include guard": skip if native classification/scaling instructions exist.
+#if (defined(HWY_NATIVE_FLOAT_CLASSIFY) == defined(HWY_TARGET_TOGGLE))
+#ifdef HWY_NATIVE_FLOAT_CLASSIFY
+#undef HWY_NATIVE_FLOAT_CLASSIFY
+#else
+#define HWY_NATIVE_FLOAT_CLASSIFY
+#endif
+
+template <class V, HWY_IF_FLOAT_D(DFromV<V>)>
+HWY_API Mask<DFromV<V>> IsNaN(const V v) {
+  // Not Ne: x86 uses the ordered predicate, which is false for NaN.
+  return Not(Eq(v, v));
+}
+
+template <class V, HWY_IF_FLOAT_D(DFromV<V>)>
+HWY_API Mask<DFromV<V>> IsInf(const V v) {
+  const DFromV<V> d;
+  const RebindToSigned<decltype(d)> di;
+  using TU = MakeUnsigned<TFromD<decltype(d)>>;
+  const auto vi = BitCast(di, v);
+  // Shifting out the sign bit leaves only the exponent (all ones) at the top.
+  const auto inf2 = BitCast(di, Set(RebindToUnsigned<decltype(d)>(),
+                                    static_cast<TU>(ExponentMask<TU>() << 1)));
+  return RebindMask(d, Eq(Add(vi, vi), inf2));
+}
+
+template <class V, HWY_IF_FLOAT_D(DFromV<V>)>
+HWY_API Mask<DFromV<V>> IsFinite(const V v) {
+  const DFromV<V> d;
+  const RebindToUnsigned<decltype(d)> du;
+  const RebindToSigned<decltype(d)> di;
+  using TU = MakeUnsigned<TFromD<decltype(d)>>;
+  const auto exp_mask = Set(du, ExponentMask<TU>());
+  // Infinity and NaN have all exponent bits set.
+  const auto exp = BitCast(di, And(BitCast(du, v), exp_mask));
+  return RebindMask(d, Lt(exp, BitCast(di, exp_mask)));
+}
+
+// Returns floor(log2(|v|)) for finite nonzero v, including subnormals.
+template <class V, HWY_IF_FLOAT_D(DFromV<V>)>
+HWY_API V GetExponent(const V v) {
+  const DFromV<V> d;
+  using T = TFromD<decltype(d)>;
+  const RebindToUnsigned<decltype(d)> du;
+  const RebindToSigned<decltype(d)> di;
+  using TI = MakeSigned<T>;
+  constexpr int kMantissaBits = sizeof(T) == 4 ? 23 : 52;
+  constexpr TI kBias = sizeof(T) == 4 ? 127 : 1023;
+
+  // Scale subnormals into the normal range and compensate below.
+  const V abs = Abs(v);
+  const auto is_subnormal =
+      Lt(abs, Set(d, static_cast<T>(sizeof(T) == 4 ? FLT_MIN : DBL_MIN)));
+  const V normal = IfThenElse(is_subnormal, Mul(abs, Set(d, MantissaEnd<T>())),
+                              abs);
+  const auto biased =
+      BitCast(di, ShiftRight<kMantissaBits>(BitCast(du, normal)));
+  const auto bias = IfThenElse(RebindMask(di, is_subnormal),
+                               Set(di, static_cast<TI>(kBias + kMantissaBits)),
+                               Set(di, kBias));
+  return ConvertTo(d, Sub(biased, bias));
+}
+
+namespace detail {
+
+// Returns 2^k for integer k within the normal exponent range.
+template <class D, class VI>
+HWY_INLINE Vec<D> Pow2I(D d, VI k) {
+  using T = TFromD<D>;
+  const RebindToSigned<D> di;
+  constexpr int kMantissaBits = sizeof(T) == 4 ? 23 : 52;
+  constexpr MakeSigned<T> kBias = sizeof(T) == 4 ? 127 : 1023;
+  return BitCast(d, ShiftLeft<kMantissaBits>(Add(k, Set(di, kBias))));
+}
+
+}  // namespace detail
+
+// Returns v * 2^e. Subnormal results may differ from a single rounding.
+template <class V, HWY_IF_FLOAT_D(DFromV<V>)>
+HWY_API V LdExp(const V v, const Vec<RebindToSigned<DFromV<V>>> e) {
+  const DFromV<V> d;
+  using T = TFromD<decltype(d)>;
+  const RebindToSigned<decltype(d)> di;
+  using TI = MakeSigned<T>;
+  // 2^k is a normal number for |k| <= kMaxStep. Three such steps suffice to
+  // overflow the smallest subnormal or underflow the largest finite value.
+  constexpr TI kMaxStep = sizeof(T) == 4 ? 126 : 1022;
+  const auto max_step = Set(di, kMaxStep);
+  const auto min_step = Set(di, static_cast<TI>(-kMaxStep));
+
+  auto rest = Clamp(e, Set(di, static_cast<TI>(-3 * kMaxStep)),
+                    Set(di, static_cast<TI>(3 * kMaxStep)));
+  const auto step0 = Clamp(rest, min_step, max_step);
+  rest = Sub(rest, step0);
+  const auto step1 = Clamp(rest, min_step, max_step);
+  rest = Sub(rest, step1);
+  const V scaled = Mul(Mul(v, detail::Pow2I(d, step0)), detail::Pow2I(d, step1));
+  return Mul(scaled, detail::Pow2I(d, rest));
+}
+
+#endif  // HWY_NATIVE_FLOAT_CLASSIFY
+
+// Returns the mantissa m of v with |m| in [0.5, 1) and sets *exp such that
+// v = m * 2^*exponent. Zero, infinity and NaN are returned unchanged and set
+// *exponent to zero.
+template <class V, HWY_IF_FLOAT_D(DFromV<V>)>
+HWY_API V Frexp(const V v,
+                Vec<RebindToSigned<DFromV<V>>>* HWY_RESTRICT exponent) {
+  const DFromV<V> d;
+  const RebindToSigned<decltype(d)> di;
+  const auto is_regular = And(IsFinite(v), Ne(v, Zero(d)));
+  // GetExponent is exact, so the conversion does not round.
+  const auto e = Add(ConvertTo(di, IfThenElseZero(is_regular, GetExponent(v))),
+                     IfThenElseZero(RebindMask(di, is_regular), Set(di, 1)));
+  *exponent = e;
+  return LdExp(v, Neg(e));
+}
+
+// ------------------------------ Lt128, Eq128, Min128, Max128
+
+// Each pair of u64 lanes is one 128-bit key whose upper half is in the odd
+// lane. Requires at least 128-bit vectors.
+#if HWY_TARGET != HWY_SCALAR && HWY_CAP_INTEGER64
+
+// Returns a mask with both lanes of each pair set if a < b (unsigned).
+template <class D, class V = VFromD<D>>
+HWY_API Mask<D> Lt128(D d, const V a, const V b) {
+  static_assert(IsSame<TFromD<D>, uint64_t>(), "Only for u64 lanes");
+  // There is no portable unsigned 64-bit comparison; flip the sign bits.
+  const RebindToSigned<decltype(d)> di;
+  const auto msb = BitCast(di, SignBit(d));
+  const auto ai = Xor(BitCast(di, a), msb);
+  const auto bi = Xor(BitCast(di, b), msb);
+  const V lt = BitCast(d, VecFromMask(di, Lt(ai, bi)));
+  const V eq = BitCast(d, VecFromMask(di, Eq(ai, bi)));
+  // The upper lane decides unless equal; then move the lower lane's result
+  // into the upper lane and broadcast the upper lane to both.
+  const V lt_lower = ShiftLeftLanes<1>(d, lt);
+  const V lt_upper = IfThenElse(MaskFromVec(eq), lt_lower, lt);
+  return MaskFromVec(InterleaveUpper(d, lt_upper, lt_upper));
+}
+
+// Returns a mask with both lanes of each pair set if a == b.
+template <class D, class V = VFromD<D>>
+HWY_API Mask<D> Eq128(D d, const V a, const V b) {
+  static_assert(IsSame<TFromD<D>, uint64_t>(), "Only for u64 lanes");
+  const V eq = VecFromMask(d, Eq(a, b));
+  return MaskFromVec(And(eq, Reverse2(d, eq)));
+}
+
+template <class D, class V = VFromD<D>>
+HWY_API V Min128(D d, const V a, const V b) {
+  return IfThenElse(Lt128(d, a, b), a, b);
+}
+
+template <class D, class V = VFromD<D>>
+HWY_API V Max128(D d, const V a, const V b) {
+  return IfThenElse(Lt128(d, b, a), a, b);
+}
+
+#endif  // HWY_TARGET != HWY_SCALAR && HWY_CAP_INTEGER64
+
 // NOLINTNEXTLINE(google-readability-namespace-comments)
 }  // namespace HWY_NAMESPACE
 }  // namespace hwy
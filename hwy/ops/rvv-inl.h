@@ -549,28 +549,20 @@ HWY_RVV_FOREACH_F(HWY_RVV_RETV_ARGVV, Max, fmax)
 
 // ------------------------------ Mul
 
-// Only for internal use (Highway only promises Mul for 16/32-bit inputs).
-// Used by MulLower.
-namespace detail {
-HWY_RVV_FOREACH_U64(HWY_RVV_RETV_ARGVV, Mul, mul)
-}  // namespace detail
-
 HWY_RVV_FOREACH_UI16(HWY_RVV_RETV_ARGVV, Mul, mul)
 HWY_RVV_FOREACH_UI32(HWY_RVV_RETV_ARGVV, Mul, mul)
+HWY_RVV_FOREACH_UI64(HWY_RVV_RETV_ARGVV, Mul, mul)
 HWY_RVV_FOREACH_F(HWY_RVV_RETV_ARGVV, Mul, fmul)
 
 // ------------------------------ MulHigh
 
-// Only for internal use (Highway only promises MulHigh for 16-bit inputs).
-// Used by MulEven; vwmul does not work for m8.
-namespace detail {
-HWY_RVV_FOREACH_I32(HWY_RVV_RETV_ARGVV, MulHigh, mulh)
-HWY_RVV_FOREACH_U32(HWY_RVV_RETV_ARGVV, MulHigh, mulhu)
-HWY_RVV_FOREACH_U64(HWY_RVV_RETV_ARGVV, MulHigh, mulhu)
-}  // namespace detail
-
+// Also used by MulEven; vwmul does not work for m8.
 HWY_RVV_FOREACH_U16(HWY_RVV_RETV_ARGVV, MulHigh, mulhu)
 HWY_RVV_FOREACH_I16(HWY_RVV_RETV_ARGVV, MulHigh, mulh)
+HWY_RVV_FOREACH_U32(HWY_RVV_RETV_ARGVV, MulHigh, mulhu)
+HWY_RVV_FOREACH_I32(HWY_RVV_RETV_ARGVV, MulHigh, mulh)
+HWY_RVV_FOREACH_U64(HWY_RVV_RETV_ARGVV, MulHigh, mulhu)
+HWY_RVV_FOREACH_I64(HWY_RVV_RETV_ARGVV, MulHigh, mulh)
 
 // ------------------------------ Div
 HWY_RVV_FOREACH_F(HWY_RVV_RETV_ARGVV, Div, fdiv)
@@ -906,6 +898,32 @@ HWY_API void Store(VFromD<Simd<T, N>> v, Simd<T, N> d, T* HWY_RESTRICT p) {
   return Store(v, Full<T>(), p);
 }
 
+// ------------------------------ BlendedStore
+
+#ifdef HWY_NATIVE_BLENDED_STORE
+#undef HWY_NATIVE_BLENDED_STORE
+#else
+#define HWY_NATIVE_BLENDED_STORE
+#endif
+
+#define HWY_RVV_BLENDED_STORE(BASE, CHAR, SEW, LMUL, SHIFT, MLEN, NAME, OP) \
+  HWY_API void NAME(HWY_RVV_V(BASE, SEW, LMUL) v, HWY_RVV_M(MLEN) m,       \
+                    HWY_RVV_D(CHAR, SEW, LMUL) d,                          \
+                    HWY_RVV_T(BASE, SEW) * HWY_RESTRICT p) {               \
+    (void)Lanes(d);                                                        \
+    return v##OP##SEW##_v_##CHAR##SEW##LMUL##_m(m, p, v);                  \
+  }
+HWY_RVV_FOREACH(HWY_RVV_BLENDED_STORE, BlendedStore, se)
+#undef HWY_RVV_BLENDED_STORE
+
+// Partial: as with Store, use the full vector but only the first N lanes.
+template <typename T, size_t N, class M, HWY_IF_LE128(T, N)>
+HWY_API void BlendedStore(VFromD<Simd<T, N>> v, M m, Simd<T, N> d,
+                          T* HWY_RESTRICT p) {
+  const Full<T> d_full;
+  BlendedStore(v, And(m, FirstN(d_full, N)), d_full, p);
+}
+
 // ------------------------------ StoreU
 
 // RVV only requires lane alignment, not natural alignment of the entire vector.
@@ -943,6 +961,18 @@ HWY_API void ScatterOffset(VFromD<Simd<T, N>> v, Simd<T, N> d,
 
 // ------------------------------ ScatterIndex
 
+template <class D, HWY_IF_LANE_SIZE_D(D, 1)>
+HWY_API void ScatterIndex(VFromD<D> v, D d, TFromD<D>* HWY_RESTRICT base,
+                          const VFromD<RebindToSigned<D>> index) {
+  return ScatterOffset(v, d, base, index);
+}
+
+template <class D, HWY_IF_LANE_SIZE_D(D, 2)>
+HWY_API void ScatterIndex(VFromD<D> v, D d, TFromD<D>* HWY_RESTRICT base,
+                          const VFromD<RebindToSigned<D>> index) {
+  return ScatterOffset(v, d, base, ShiftLeft<1>(index));
+}
+
 template <class D, HWY_IF_LANE_SIZE_D(D, 4)>
 HWY_API void ScatterIndex(VFromD<D> v, D d, TFromD<D>* HWY_RESTRICT base,
                           const VFromD<RebindToSigned<D>> index) {
@@ -978,6 +1008,18 @@ HWY_API VFromD<Simd<T, N>> GatherOffset(Simd<T, N> d,
 
 // ------------------------------ GatherIndex
 
+template <class D, HWY_IF_LANE_SIZE_D(D, 1)>
+HWY_API VFromD<D> GatherIndex(D d, const TFromD<D>* HWY_RESTRICT base,
+                              const VFromD<RebindToSigned<D>> index) {
+  return GatherOffset(d, base, index);
+}
+
+template <class D, HWY_IF_LANE_SIZE_D(D, 2)>
+HWY_API VFromD<D> GatherIndex(D d, const TFromD<D>* HWY_RESTRICT base,
+                              const VFromD<RebindToSigned<D>> index) {
+  return GatherOffset(d, base, ShiftLeft<1>(index));
+}
+
 template <class D, HWY_IF_LANE_SIZE_D(D, 4)>
 HWY_API VFromD<D> GatherIndex(D d, const TFromD<D>* HWY_RESTRICT base,
                               const VFromD<RebindToSigned<D>> index) {
@@ -990,6 +1032,51 @@ HWY_API VFromD<D> GatherIndex(D d, const TFromD<D>* HWY_RESTRICT base,
   return GatherOffset(d, base, ShiftLeft<3>(index));
 }
 
+// ------------------------------ MaskedGatherIndex
+
+#ifdef HWY_NATIVE_MASKED_GATHER
+#undef HWY_NATIVE_MASKED_GATHER
+#else
+#define HWY_NATIVE_MASKED_GATHER
+#endif
+
+namespace detail {
+
+#define HWY_RVV_MASKED_GATHER(BASE, CHAR, SEW, LMUL, SHIFT, MLEN, NAME, OP) \
+  HWY_API HWY_RVV_V(BASE, SEW, LMUL)                                        \
+      NAME(HWY_RVV_M(MLEN) m, HWY_RVV_D(CHAR, SEW, LMUL) d,                 \
+           const HWY_RVV_T(BASE, SEW) * HWY_RESTRICT base,                  \
+           HWY_RVV_V(int, SEW, LMUL) offset) {                              \
+    (void)Lanes(d);                                                         \
+    return v##OP##ei##SEW##_v_##CHAR##SEW##LMUL##_m(                        \
+        m, Zero(d), base, detail::BitCastToUnsigned(offset));               \
+  }
+HWY_RVV_FOREACH(HWY_RVV_MASKED_GATHER, MaskedGatherOffset, lx)
+#undef HWY_RVV_MASKED_GATHER
+
+// Partial: use the full vector but only the first N lanes.
+template <typename T, size_t N, class M, HWY_IF_LE128(T, N)>
+HWY_API VFromD<Simd<T, N>> MaskedGatherOffset(
+    M m, Simd<T, N> /* d */, const T* HWY_RESTRICT base,
+    VFromD<Simd<MakeSigned<T>, N>> offset) {
+  const Full<T> d_full;
+  return MaskedGatherOffset(And(m, FirstN(d_full, N)), d_full, base, offset);
+}
+
+}  // namespace detail
+
+// Lanes whose mask is false are zero and their indices are not accessed.
+template <class D, class M>
+HWY_API VFromD<D> MaskedGatherIndex(M m, D d,
+                                    const TFromD<D>* HWY_RESTRICT base,
+                                    const VFromD<RebindToSigned<D>> index) {
+  constexpr int kShift = sizeof(TFromD<D>) == 1   ? 0
+                         : sizeof(TFromD<D>) == 2 ? 1
+                         : sizeof(TFromD<D>) == 4 ? 2
+                                                  : 3;
+  return detail::MaskedGatherOffset(m, d, base, ShiftLeft<kShift>(index));
+}
+
 // ------------------------------ StoreInterleaved3
 
 #define HWY_RVV_STORE3(BASE, CHAR, SEW, LMUL, SHIFT, MLEN, NAME, OP)    \
@@ -1374,6 +1461,14 @@ HWY_RVV_FOREACH_UI16(HWY_RVV_COMPRESS, Compress, compress)
 HWY_RVV_FOREACH_UI32(HWY_RVV_COMPRESS, Compress, compress)
 HWY_RVV_FOREACH_UI64(HWY_RVV_COMPRESS, Compress, compress)
 HWY_RVV_FOREACH_F(HWY_RVV_COMPRESS, Compress, compress)
+
+namespace detail {
+// Also supports 8-bit lanes, which are not part of the Highway API. Used by
+// OrderedDemote2To.
+HWY_RVV_FOREACH_U08(HWY_RVV_COMPRESS, CompressNarrow, compress)
+HWY_RVV_FOREACH_U16(HWY_RVV_COMPRESS, CompressNarrow, compress)
+}  // namespace detail
+
 #undef HWY_RVV_COMPRESS
 
 // ------------------------------ CompressStore
@@ -1462,6 +1557,64 @@ HWY_API V Shuffle0123(const V v) {
   return Shuffle2301(Shuffle1032(v));
 }
 
+// ------------------------------ Reverse (TableLookupLanes)
+
+template <class D, class V = VFromD<D>>
+HWY_API V Reverse(D d, V v) {
+  const RebindToUnsigned<D> du;
+  using TU = TFromD<decltype(du)>;
+  const auto idx =
+      Sub(Set(du, static_cast<TU>(Lanes(d) - 1)), detail::Iota0(du));
+  return TableLookupLanes(v, idx);
+}
+
+// ------------------------------ Reverse2/4/8 (TableLookupLanes)
+
+namespace detail {
+
+template <size_t kGroup, class D, class V>
+HWY_INLINE V ReverseGroups(D d, V v) {
+  const RebindToUnsigned<D> du;
+  using TU = TFromD<decltype(du)>;
+  const auto idx = XorS(Iota0(du), static_cast<TU>(kGroup - 1));
+  return TableLookupLanes(v, idx);
+}
+
+}  // namespace detail
+
+template <class D, class V = VFromD<D>>
+HWY_API V Reverse2(D d, V v) {
+  return detail::ReverseGroups<2>(d, v);
+}
+
+template <class D, class V = VFromD<D>>
+HWY_API V Reverse4(D d, V v) {
+  return detail::ReverseGroups<4>(d, v);
+}
+
+template <class D, class V = VFromD<D>>
+HWY_API V Reverse8(D d, V v) {
+  return detail::ReverseGroups<8>(d, v);
+}
+
+// ------------------------------ ReverseBlocks (TableLookupLanes)
+
+template <class D, class V = VFromD<D>>
+HWY_API V ReverseBlocks(D d, V v) {
+  const Repartition<uint64_t, D> du64;
+  const size_t N = Lanes(du64);
+  if (N < 2) {  // Single (partial) block
+    Lanes(d);
+    return v;
+  }
+  // Reverse the u64 lanes, then swap each pair back into its original order.
+  const auto rev = Sub(Set(du64, N - 1), detail::Iota0(du64));
+  const auto idx = detail::XorS(rev, 1);
+  const auto out = BitCast(d, TableLookupLanes(BitCast(du64, v), idx));
+  Lanes(d);
+  return out;
+}
+
 // ------------------------------ TableLookupBytes
 
 template <class V, class VI>
@@ -1863,28 +2016,81 @@ HWY_API VFromD<RepartitionToWide<DFromV<V>>> MulEven(const V a, const V b) {
   const DFromV<V> d;
   Lanes(d);
   const auto lo = Mul(a, b);
-  const auto hi = detail::MulHigh(a, b);
+  const auto hi = MulHigh(a, b);
   const RepartitionToWide<DFromV<V>> dw;
   const auto wide = BitCast(dw, OddEven(detail::Slide1Up(hi), lo));
   Lanes(dw);
   return wide;
 }
 
+template <class V, HWY_IF_LANE_SIZE_V(V, 4)>
+HWY_API VFromD<RepartitionToWide<DFromV<V>>> MulOdd(const V a, const V b) {
+  const DFromV<V> d;
+  Lanes(d);
+  const auto lo = Mul(a, b);
+  const auto hi = MulHigh(a, b);
+  const RepartitionToWide<DFromV<V>> dw;
+  const auto wide = BitCast(dw, OddEven(hi, detail::Slide1Down(lo)));
+  Lanes(dw);
+  return wide;
+}
+
 // There is no 64x64 vwmul.
 template <class V, HWY_IF_LANE_SIZE_V(V, 8)>
 HWY_INLINE V MulEven(const V a, const V b) {
-  const auto lo = detail::Mul(a, b);
-  const auto hi = detail::MulHigh(a, b);
+  const auto lo = Mul(a, b);
+  const auto hi = MulHigh(a, b);
   return OddEven(detail::Slide1Up(hi), lo);
 }
 
 template <class V, HWY_IF_LANE_SIZE_V(V, 8)>
 HWY_INLINE V MulOdd(const V a, const V b) {
-  const auto lo = detail::Mul(a, b);
-  const auto hi = detail::MulHigh(a, b);
+  const auto lo = Mul(a, b);
+  const auto hi = MulHigh(a, b);
   return OddEven(hi, detail::Slide1Down(lo));
 }
 
+// ------------------------------ ReorderDemote2To (Min, Max, ShiftLeft)
+
+namespace detail {
+
+// Saturates a and b to the range of TN and returns wide lanes whose lower half
+// holds the result for a and whose upper half holds the result for b.
+template <typename TN, class VI>
+HWY_INLINE VFromD<RebindToUnsigned<DFromV<VI>>> SaturateAndPair(VI a, VI b) {
+  using TI = TFromV<VI>;
+  const DFromV<VI> di;
+  const RebindToUnsigned<decltype(di)> du;
+  using TU = TFromD<decltype(du)>;
+  const VI min = Set(di, static_cast<TI>(LimitsMin<TN>()));
+  const VI max = Set(di, static_cast<TI>(LimitsMax<TN>()));
+  const auto sat_a = BitCast(du, Min(Max(a, min), max));
+  const auto sat_b = BitCast(du, Min(Max(b, min), max));
+  constexpr int kBits = static_cast<int>(sizeof(TN) * 8);
+  const auto lower = Set(du, static_cast<TU>((1u << kBits) - 1));
+  return Or(And(sat_a, lower), ShiftLeft<kBits>(sat_b));
+}
+
+}  // namespace detail
+
+// Demoted lanes of a are in the even lanes, those of b in the odd lanes.
+template <class DN, class VI>
+HWY_API VFromD<DN> ReorderDemote2To(DN dn, VI a, VI b) {
+  return BitCast(dn, detail::SaturateAndPair<TFromD<DN>>(a, b));
+}
+
+// ------------------------------ OrderedDemote2To (Compress)
+
+template <class DN, class VI>
+HWY_API VFromD<DN> OrderedDemote2To(DN dn, VI a, VI b) {
+  const RebindToUnsigned<DN> du;
+  const auto pairs = BitCast(du, ReorderDemote2To(dn, a, b));
+  const auto is_even = Eq(detail::AndS(detail::Iota0(du), 1), Zero(du));
+  const auto from_a = detail::CompressNarrow(pairs, is_even);
+  const auto from_b = detail::CompressNarrow(pairs, Not(is_even));
+  return BitCast(dn, ConcatLowerLower(from_b, from_a));
+}
+
 // ================================================== END MACROS
 namespace detail {  // for code folding
 #undef HWY_IF_FLOAT_V
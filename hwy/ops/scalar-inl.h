@@ -70,7 +70,7 @@ class Mask1 {
  public:
   static HWY_INLINE Mask1<T> FromBool(bool b) {
     Mask1<T> mask;
-    mask.bits = b ? ~Raw(0) : 0;
+    mask.bits = b ? static_cast<Raw>(~Raw(0)) : 0;
     return mask;
   }
 
@@ -315,7 +315,8 @@ HWY_API Mask1<T> Xor(const Mask1<T> a, Mask1<T> b) {
 template <int kBits, typename T>
 HWY_API Vec1<T> ShiftLeft(const Vec1<T> v) {
   static_assert(0 <= kBits && kBits < sizeof(T) * 8, "Invalid shift");
-  return Vec1<T>(static_cast<hwy::MakeUnsigned<T>>(v.raw) << kBits);
+  return Vec1<T>(
+      static_cast<T>(static_cast<hwy::MakeUnsigned<T>>(v.raw) << kBits));
 }
 
 template <int kBits, typename T>
@@ -362,7 +363,7 @@ HWY_API Vec1<T> ShiftRightSame(const Vec1<T> v, int bits) {
     const Sisd<TU> du;
     const TU shifted = BitCast(du, v).raw >> bits;
     const TU sign = BitCast(du, BroadcastSignBit(v)).raw;
-    const TU upper = sign << (sizeof(TU) * 8 - 1 - bits);
+    const TU upper = sign << (static_cast<int>(sizeof(TU) * 8) - 1 - bits);
     return BitCast(Sisd<T>(), Vec1<TU>(shifted | upper));
   } else {
     return Vec1<T>(v.raw >> bits);  // unsigned, logical shift
@@ -537,7 +538,9 @@ HWY_API Vec1<T> operator*(const Vec1<T> a, const Vec1<T> b) {
   if (hwy::IsFloat<T>()) {
     return Vec1<T>(static_cast<T>(double(a.raw) * b.raw));
   } else if (hwy::IsSigned<T>()) {
-    return Vec1<T>(static_cast<T>(int64_t(a.raw) * b.raw));
+    // Unsigned multiplication avoids undefined behavior on i64 overflow; the
+    // lower bits are the same.
+    return Vec1<T>(static_cast<T>(uint64_t(a.raw) * uint64_t(b.raw)));
   } else {
     return Vec1<T>(static_cast<T>(uint64_t(a.raw) * b.raw));
   }
@@ -560,6 +563,32 @@ HWY_API Vec1<uint16_t> MulHigh(const Vec1<uint16_t> a, const Vec1<uint16_t> b) {
       (static_cast<uint32_t>(a.raw) * static_cast<uint32_t>(b.raw)) >> 16));
 }
 
+// Returns the upper 32 bits of a * b.
+HWY_API Vec1<int32_t> MulHigh(const Vec1<int32_t> a, const Vec1<int32_t> b) {
+  return Vec1<int32_t>(static_cast<int32_t>((int64_t(a.raw) * b.raw) >> 32));
+}
+HWY_API Vec1<uint32_t> MulHigh(const Vec1<uint32_t> a, const Vec1<uint32_t> b) {
+  return Vec1<uint32_t>(static_cast<uint32_t>((uint64_t(a.raw) * b.raw) >> 32));
+}
+
+// Returns the upper 64 bits of a * b.
+HWY_API Vec1<uint64_t> MulHigh(const Vec1<uint64_t> a, const Vec1<uint64_t> b) {
+  uint64_t hi;
+  Mul128(a.raw, b.raw, &hi);
+  return Vec1<uint64_t>(hi);
+}
+HWY_API Vec1<int64_t> MulHigh(const Vec1<int64_t> a, const Vec1<int64_t> b) {
+  const uint64_t a64 = static_cast<uint64_t>(a.raw);
+  const uint64_t b64 = static_cast<uint64_t>(b.raw);
+  uint64_t hi;
+  Mul128(a64, b64, &hi);
+  // The sign bit has weight -2^64 rather than 2^64, so subtract the other
+  // operand for each negative input.
+  if (a.raw < 0) hi -= b64;
+  if (b.raw < 0) hi -= a64;
+  return Vec1<int64_t>(static_cast<int64_t>(hi));
+}
+
 // Multiplies even lanes (0, 2 ..) and returns the double-wide result.
 HWY_API Vec1<int64_t> MulEven(const Vec1<int32_t> a, const Vec1<int32_t> b) {
   const int64_t a64 = a.raw;
@@ -842,6 +871,21 @@ HWY_API void StoreU(const Vec1<T> v, Sisd<T> d, T* HWY_RESTRICT p) {
   return Store(v, d, p);
 }
 
+// ------------------------------ BlendedStore
+
+#ifdef HWY_NATIVE_BLENDED_STORE
+#undef HWY_NATIVE_BLENDED_STORE
+#else
+#define HWY_NATIVE_BLENDED_STORE
+#endif
+
+template <typename T>
+HWY_API void BlendedStore(const Vec1<T> v, Mask1<T> m, Sisd<T> d,
+                          T* HWY_RESTRICT p) {
+  if (!m.bits) return;
+  StoreU(v, d, p);
+}
+
 // ------------------------------ StoreInterleaved3
 
 HWY_API void StoreInterleaved3(const Vec1<uint8_t> v0, const Vec1<uint8_t> v1,
@@ -875,7 +919,8 @@ template <typename T, typename Offset>
 HWY_API void ScatterOffset(Vec1<T> v, Sisd<T> d, T* base,
                            const Vec1<Offset> offset) {
   static_assert(sizeof(T) == sizeof(Offset), "Must match for portability");
-  uint8_t* const base8 = reinterpret_cast<uint8_t*>(base) + offset.raw;
+  uint8_t* const base8 =
+      reinterpret_cast<uint8_t*>(base) + detail::ScatterGatherIndex(offset.raw);
   return Store(v, d, reinterpret_cast<T*>(base8));
 }
 
@@ -883,7 +928,7 @@ template <typename T, typename Index>
 HWY_API void ScatterIndex(Vec1<T> v, Sisd<T> d, T* HWY_RESTRICT base,
                           const Vec1<Index> index) {
   static_assert(sizeof(T) == sizeof(Index), "Must match for portability");
-  return Store(v, d, base + index.raw);
+  return Store(v, d, base + detail::ScatterGatherIndex(index.raw));
 }
 
 // ------------------------------ Gather
@@ -892,15 +937,16 @@ template <typename T, typename Offset>
 HWY_API Vec1<T> GatherOffset(Sisd<T> d, const T* base,
                              const Vec1<Offset> offset) {
   static_assert(sizeof(T) == sizeof(Offset), "Must match for portability");
-  const uintptr_t addr = reinterpret_cast<uintptr_t>(base) + offset.raw;
-  return Load(d, reinterpret_cast<const T*>(addr));
+  const uint8_t* const base8 = reinterpret_cast<const uint8_t*>(base) +
+                               detail::ScatterGatherIndex(offset.raw);
+  return Load(d, reinterpret_cast<const T*>(base8));
 }
 
 template <typename T, typename Index>
 HWY_API Vec1<T> GatherIndex(Sisd<T> d, const T* HWY_RESTRICT base,
                             const Vec1<Index> index) {
   static_assert(sizeof(T) == sizeof(Index), "Must match for portability");
-  return Load(d, base + index.raw);
+  return Load(d, base + detail::ScatterGatherIndex(index.raw));
 }
 
 // ================================================== CONVERT
@@ -1055,6 +1101,20 @@ HWY_API Vec1<T> LowerHalf(Sisd<T> /* tag */, Vec1<T> v) {
 // ================================================== SWIZZLE
 // OddEven is unsupported.
 
+// ------------------------------ DupEven/DupOdd
+
+#ifdef HWY_NATIVE_DUP_EVEN_ODD
+#undef HWY_NATIVE_DUP_EVEN_ODD
+#else
+#define HWY_NATIVE_DUP_EVEN_ODD
+#endif
+
+// The only lane is even; DupOdd is unsupported.
+template <typename T>
+HWY_API Vec1<T> DupEven(const Vec1<T> v) {
+  return v;
+}
+
 template <typename T>
 HWY_API T GetLane(const Vec1<T> v) {
   return v.raw;
@@ -1079,6 +1139,20 @@ HWY_API Vec1<T> TableLookupLanes(const Vec1<T> v, const Indices1<T> /* idx */) {
   return v;
 }
 
+// ------------------------------ Reverse
+
+template <typename T>
+HWY_API Vec1<T> Reverse(Sisd<T> /* tag */, const Vec1<T> v) {
+  return v;
+}
+
+// ------------------------------ ReverseBlocks
+
+template <typename T>
+HWY_API Vec1<T> ReverseBlocks(Sisd<T> /* tag */, const Vec1<T> v) {
+  return v;
+}
+
 // ================================================== BLOCKWISE
 // Shift*Bytes, CombineShiftRightBytes, Interleave*, Shuffle* are unsupported.
 
@@ -1124,6 +1198,28 @@ HWY_API Vec1<T> TableLookupBytesOr0(const Vec1<T> in, const Vec1<T> from) {
   return Vec1<T>{out};
 }
 
+// ------------------------------ TableLookupBytes64, TableLookupBytes128
+
+#ifdef HWY_NATIVE_TABLE_LOOKUP_BYTES64
+#undef HWY_NATIVE_TABLE_LOOKUP_BYTES64
+#else
+#define HWY_NATIVE_TABLE_LOOKUP_BYTES64
+#endif
+
+template <typename T, HWY_IF_LANE_SIZE(T, 1)>
+HWY_API Vec1<T> TableLookupBytes64(Sisd<T> /* tag */,
+                                   const T* HWY_RESTRICT table,
+                                   const Vec1<T> idx) {
+  return Vec1<T>{table[static_cast<uint8_t>(idx.raw) & 63]};
+}
+
+template <typename T, HWY_IF_LANE_SIZE(T, 1)>
+HWY_API Vec1<T> TableLookupBytes128(Sisd<T> /* tag */,
+                                    const T* HWY_RESTRICT table,
+                                    const Vec1<T> idx) {
+  return Vec1<T>{table[static_cast<uint8_t>(idx.raw) & 127]};
+}
+
 // ------------------------------ ZipLower
 
 HWY_API Vec1<uint16_t> ZipLower(const Vec1<uint8_t> a, const Vec1<uint8_t> b) {
@@ -65,7 +65,7 @@
 #define HWY_TARGET_STR_AVX2 \
   HWY_TARGET_STR_SSE4 ",avx,avx2" HWY_TARGET_STR_BMI2_FMA HWY_TARGET_STR_F16C
 #define HWY_TARGET_STR_AVX3 \
-  HWY_TARGET_STR_AVX2 ",avx512f,avx512vl,avx512dq,avx512bw"
+  HWY_TARGET_STR_AVX2 ",avx512f,avx512vl,avx512dq,avx512bw,avx512cd"
 
 // Before include guard so we redefine HWY_TARGET_STR on each include,
 // governed by the current HWY_TARGET.
@@ -140,7 +140,8 @@
 #define HWY_NAMESPACE N_AVX3_DL
 #define HWY_TARGET_STR \
   HWY_TARGET_STR_AVX3  \
-      ",vpclmulqdq,avx512vbmi2,vaes,avxvnni,avx512bitalg,avx512vpopcntdq"
+      ",vpclmulqdq,avx512vbmi,avx512vbmi2,vaes,avxvnni,avx512bitalg," \
+      "avx512vpopcntdq"
 
 #else
 #error "Logic error"
@@ -109,6 +109,22 @@ using Twice = typename D::Twice;
 #define HWY_IF_LANES_ARE(T, V) \
   EnableIf<IsSameT<T, TFromD<DFromV<V>>>::value>* = nullptr
 
+namespace detail {
+
+// Scatter/Gather interpret 8 and 16-bit offsets/indices as unsigned, as do the
+// RVV indexed loads/stores, so that all entries of a 256-entry byte table are
+// reachable on every target.
+template <typename TI, hwy::EnableIf<(sizeof(TI) <= 2)>* = nullptr>
+HWY_INLINE HWY_MAYBE_UNUSED size_t ScatterGatherIndex(TI i) {
+  return static_cast<MakeUnsigned<TI>>(i);
+}
+template <typename TI, hwy::EnableIf<(sizeof(TI) > 2)>* = nullptr>
+HWY_INLINE HWY_MAYBE_UNUSED TI ScatterGatherIndex(TI i) {
+  return i;
+}
+
+}  // namespace detail
+
 // Compile-time-constant, (typically but not guaranteed) an upper bound on the
 // number of lanes.
 // Prefer instead using Lanes() and dynamic allocation, or Rebind, or
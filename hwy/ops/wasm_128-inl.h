@@ -324,6 +324,37 @@ HWY_API Vec128<float, N> operator-(const Vec128<float, N> a,
   return Vec128<float, N>{wasm_f32x4_sub(a.raw, b.raw)};
 }
 
+// ------------------------------ SumsOf8
+
+#ifdef HWY_NATIVE_SUMS_OF_8
+#undef HWY_NATIVE_SUMS_OF_8
+#else
+#define HWY_NATIVE_SUMS_OF_8
+#endif
+
+template <size_t N, HWY_IF_GE64(uint8_t, N)>
+HWY_API Vec128<uint64_t, N / 8> SumsOf8(const Vec128<uint8_t, N> v) {
+  const Simd<uint16_t, N / 2> d16;
+  const Simd<uint32_t, N / 4> d32;
+  const auto v16 = BitCast(d16, v);
+  const auto sum16 = And(v16, Set(d16, 0xFF)) + ShiftRight<8>(v16);
+  const auto v32 = BitCast(d32, sum16);
+  const auto sum32 = And(v32, Set(d32, 0xFFFF)) + ShiftRight<16>(v32);
+  // 64-bit lanes are not fully supported, hence use intrinsics.
+  const v128_t lo = wasm_v128_and(sum32.raw, wasm_i64x2_splat(0xFFFFFFFF));
+  const v128_t hi = wasm_u64x2_shr(sum32.raw, 32);
+  return Vec128<uint64_t, N / 8>{wasm_i64x2_add(lo, hi)};
+}
+
+// ------------------------------ SumsOfAbsDiff
+template <size_t N, HWY_IF_GE64(uint8_t, N)>
+HWY_API Vec128<uint64_t, N / 8> SumsOfAbsDiff(const Vec128<uint8_t, N> a,
+                                              const Vec128<uint8_t, N> b) {
+  const v128_t abs_diff = wasm_v128_or(wasm_u8x16_sub_sat(a.raw, b.raw),
+                                       wasm_u8x16_sub_sat(b.raw, a.raw));
+  return SumsOf8(Vec128<uint8_t, N>{abs_diff});
+}
+
 // ------------------------------ Saturating addition
 
 // Returns a + b clamped to the destination range.
@@ -745,6 +776,30 @@ HWY_API Vec128<int16_t, N> MulHigh(const Vec128<int16_t, N> a,
       wasm_i16x8_shuffle(l, h, 1, 3, 5, 7, 9, 11, 13, 15)};
 }
 
+// Returns the upper 32 bits of a * b in each lane.
+template <size_t N>
+HWY_API Vec128<uint32_t, N> MulHigh(const Vec128<uint32_t, N> a,
+                                    const Vec128<uint32_t, N> b) {
+  const auto al = wasm_u64x2_extend_low_u32x4(a.raw);
+  const auto ah = wasm_u64x2_extend_high_u32x4(a.raw);
+  const auto bl = wasm_u64x2_extend_low_u32x4(b.raw);
+  const auto bh = wasm_u64x2_extend_high_u32x4(b.raw);
+  const auto l = wasm_i64x2_mul(al, bl);
+  const auto h = wasm_i64x2_mul(ah, bh);
+  return Vec128<uint32_t, N>{wasm_i32x4_shuffle(l, h, 1, 3, 5, 7)};
+}
+template <size_t N>
+HWY_API Vec128<int32_t, N> MulHigh(const Vec128<int32_t, N> a,
+                                   const Vec128<int32_t, N> b) {
+  const auto al = wasm_i64x2_extend_low_i32x4(a.raw);
+  const auto ah = wasm_i64x2_extend_high_i32x4(a.raw);
+  const auto bl = wasm_i64x2_extend_low_i32x4(b.raw);
+  const auto bh = wasm_i64x2_extend_high_i32x4(b.raw);
+  const auto l = wasm_i64x2_mul(al, bl);
+  const auto h = wasm_i64x2_mul(ah, bh);
+  return Vec128<int32_t, N>{wasm_i32x4_shuffle(l, h, 1, 3, 5, 7)};
+}
+
 // Multiplies even lanes (0, 2 ..) and returns the double-width result.
 template <size_t N>
 HWY_API Vec128<int64_t, (N + 1) / 2> MulEven(const Vec128<int32_t, N> a,
@@ -765,6 +820,49 @@ HWY_API Vec128<uint64_t, (N + 1) / 2> MulEven(const Vec128<uint32_t, N> a,
   return Vec128<uint64_t, (N + 1) / 2>{wasm_i64x2_mul(ae, be)};
 }
 
+// Multiplies odd lanes (1, 3 ..) and returns the double-width result.
+template <size_t N>
+HWY_API Vec128<int64_t, (N + 1) / 2> MulOdd(const Vec128<int32_t, N> a,
+                                            const Vec128<int32_t, N> b) {
+  // Arithmetic shift sign-extends the odd lanes.
+  const auto ao = wasm_i64x2_shr(a.raw, 32);
+  const auto bo = wasm_i64x2_shr(b.raw, 32);
+  return Vec128<int64_t, (N + 1) / 2>{wasm_i64x2_mul(ao, bo)};
+}
+template <size_t N>
+HWY_API Vec128<uint64_t, (N + 1) / 2> MulOdd(const Vec128<uint32_t, N> a,
+                                             const Vec128<uint32_t, N> b) {
+  const auto ao = wasm_u64x2_shr(a.raw, 32);
+  const auto bo = wasm_u64x2_shr(b.raw, 32);
+  return Vec128<uint64_t, (N + 1) / 2>{wasm_i64x2_mul(ao, bo)};
+}
+
+// 64-bit
+template <size_t N>
+HWY_API Vec128<uint64_t, N> operator*(const Vec128<uint64_t, N> a,
+                                      const Vec128<uint64_t, N> b) {
+  return Vec128<uint64_t, N>{wasm_i64x2_mul(a.raw, b.raw)};
+}
+template <size_t N>
+HWY_API Vec128<int64_t, N> operator*(const Vec128<int64_t, N> a,
+                                     const Vec128<int64_t, N> b) {
+  return Vec128<int64_t, N>{wasm_i64x2_mul(a.raw, b.raw)};
+}
+
+// Returns the upper 64 bits of a * b in each lane.
+template <size_t N>
+HWY_API Vec128<uint64_t, N> MulHigh(const Vec128<uint64_t, N> a,
+                                    const Vec128<uint64_t, N> b) {
+  // TODO(eustas): replace, when implemented in WASM.
+  uint64_t hi0, hi1;
+  Mul128(wasm_u64x2_extract_lane(a.raw, 0), wasm_u64x2_extract_lane(b.raw, 0),
+         &hi0);
+  Mul128(wasm_u64x2_extract_lane(a.raw, 1), wasm_u64x2_extract_lane(b.raw, 1),
+         &hi1);
+  return Vec128<uint64_t, N>{wasm_u64x2_make(hi0, hi1)};
+}
+// i64 is implemented after BroadcastSignBit.
+
 // ------------------------------ Negate
 
 template <typename T, size_t N, HWY_IF_FLOAT(T)>
@@ -1153,6 +1251,22 @@ HWY_API Vec128<int8_t, N> BroadcastSignBit(const Vec128<int8_t, N> v) {
   return VecFromMask(Simd<int8_t, N>(), v < Zero(Simd<int8_t, N>()));
 }
 
+// ------------------------------ MulHigh i64
+
+// The signed upper half differs from the unsigned one by subtracting the other
+// operand wherever an input is negative (its sign bit has weight -2^64).
+template <size_t N>
+HWY_API Vec128<int64_t, N> MulHigh(const Vec128<int64_t, N> a,
+                                   const Vec128<int64_t, N> b) {
+  const Simd<int64_t, N> di;
+  const Simd<uint64_t, N> du;
+  const auto hi = BitCast(di, MulHigh(BitCast(du, a), BitCast(du, b)));
+  const auto a_neg_b = wasm_v128_and(wasm_i64x2_shr(a.raw, 63), b.raw);
+  const auto b_neg_a = wasm_v128_and(wasm_i64x2_shr(b.raw, 63), a.raw);
+  return Vec128<int64_t, N>{
+      wasm_i64x2_sub(wasm_i64x2_sub(hi.raw, a_neg_b), b_neg_a)};
+}
+
 // ------------------------------ Mask
 
 // Mask and Vec are the same (true = FF..FF).
@@ -1433,7 +1547,8 @@ HWY_API void ScatterOffset(Vec128<T, N> v, Simd<T, N> d, T* HWY_RESTRICT base,
 
   uint8_t* base_bytes = reinterpret_cast<uint8_t*>(base);
   for (size_t i = 0; i < N; ++i) {
-    CopyBytes<sizeof(T)>(&lanes[i], base_bytes + offset_lanes[i]);
+    CopyBytes<sizeof(T)>(
+        &lanes[i], base_bytes + detail::ScatterGatherIndex(offset_lanes[i]));
   }
 }
 
@@ -1449,7 +1564,7 @@ HWY_API void ScatterIndex(Vec128<T, N> v, Simd<T, N> d, T* HWY_RESTRICT base,
   Store(index, Simd<Index, N>(), index_lanes);
 
   for (size_t i = 0; i < N; ++i) {
-    base[index_lanes[i]] = lanes[i];
+    base[detail::ScatterGatherIndex(index_lanes[i])] = lanes[i];
   }
 }
 
@@ -1467,7 +1582,8 @@ HWY_API Vec128<T, N> GatherOffset(const Simd<T, N> d,
   alignas(16) T lanes[N];
   const uint8_t* base_bytes = reinterpret_cast<const uint8_t*>(base);
   for (size_t i = 0; i < N; ++i) {
-    CopyBytes<sizeof(T)>(base_bytes + offset_lanes[i], &lanes[i]);
+    CopyBytes<sizeof(T)>(
+        base_bytes + detail::ScatterGatherIndex(offset_lanes[i]), &lanes[i]);
   }
   return Load(d, lanes);
 }
@@ -1482,7 +1598,7 @@ HWY_API Vec128<T, N> GatherIndex(const Simd<T, N> d, const T* HWY_RESTRICT base,
 
   alignas(16) T lanes[N];
   for (size_t i = 0; i < N; ++i) {
-    lanes[i] = base[index_lanes[i]];
+    lanes[i] = base[detail::ScatterGatherIndex(index_lanes[i])];
   }
   return Load(d, lanes);
 }
@@ -2032,6 +2148,110 @@ HWY_API Vec128<float, N> TableLookupLanes(const Vec128<float, N> v,
                  TableLookupBytes(BitCast(di, v), Vec128<int32_t, N>{idx.raw}));
 }
 
+// ------------------------------ Reverse (Shuffle0123, Shuffle2301)
+
+namespace detail {
+
+// Source byte of output byte i when reversing groups of "group" lanes.
+constexpr int ReverseIndex(size_t lane_bytes, size_t group, size_t i) {
+  return static_cast<int>(
+      ((i / lane_bytes) - (i / lane_bytes) % group + group - 1 -
+       (i / lane_bytes) % group) *
+          lane_bytes +
+      i % lane_bytes);
+}
+
+// Reverses groups of kGroup lanes via constant byte shuffle.
+template <size_t kGroup, typename T, size_t N>
+HWY_INLINE Vec128<T, N> ReverseGroupsViaBytes(const Vec128<T, N> v) {
+  static_assert(sizeof(T) * kGroup <= 16, "Group must not cross blocks");
+  constexpr size_t kB = sizeof(T);
+  return Vec128<T, N>{wasm_i8x16_shuffle(
+      v.raw, v.raw, ReverseIndex(kB, kGroup, 0), ReverseIndex(kB, kGroup, 1),
+      ReverseIndex(kB, kGroup, 2), ReverseIndex(kB, kGroup, 3),
+      ReverseIndex(kB, kGroup, 4), ReverseIndex(kB, kGroup, 5),
+      ReverseIndex(kB, kGroup, 6), ReverseIndex(kB, kGroup, 7),
+      ReverseIndex(kB, kGroup, 8), ReverseIndex(kB, kGroup, 9),
+      ReverseIndex(kB, kGroup, 10), ReverseIndex(kB, kGroup, 11),
+      ReverseIndex(kB, kGroup, 12), ReverseIndex(kB, kGroup, 13),
+      ReverseIndex(kB, kGroup, 14), ReverseIndex(kB, kGroup, 15))};
+}
+
+}  // namespace detail
+
+// Single lane: no change
+template <typename T>
+HWY_API Vec128<T, 1> Reverse(Simd<T, 1> /* tag */, const Vec128<T, 1> v) {
+  return v;
+}
+
+// Two 32-bit lanes: swap
+template <typename T, HWY_IF_LANE_SIZE(T, 4)>
+HWY_API Vec128<T, 2> Reverse(Simd<T, 2> /* tag */, const Vec128<T, 2> v) {
+  return Vec128<T, 2>{Shuffle2301(Vec128<T>{v.raw}).raw};
+}
+
+template <typename T, HWY_IF_LANE_SIZE(T, 8)>
+HWY_API Vec128<T> Reverse(Full128<T> /* tag */, const Vec128<T> v) {
+  return detail::ReverseGroupsViaBytes<2>(v);
+}
+
+template <typename T, HWY_IF_LANE_SIZE(T, 4)>
+HWY_API Vec128<T> Reverse(Full128<T> /* tag */, const Vec128<T> v) {
+  return Shuffle0123(v);
+}
+
+// 8/16-bit lanes: byte shuffle. Partial vectors reverse a group of N lanes.
+template <typename T, size_t N,
+          hwy::EnableIf<(N > 1 && sizeof(T) <= 2)>* = nullptr>
+HWY_API Vec128<T, N> Reverse(Simd<T, N> /* tag */, const Vec128<T, N> v) {
+  return detail::ReverseGroupsViaBytes<N>(v);
+}
+
+// ------------------------------ Reverse2
+
+template <typename T, size_t N, hwy::EnableIf<sizeof(T) <= 2>* = nullptr>
+HWY_API Vec128<T, N> Reverse2(Simd<T, N> /* tag */, const Vec128<T, N> v) {
+  return detail::ReverseGroupsViaBytes<2>(v);
+}
+
+template <typename T, size_t N, HWY_IF_LANE_SIZE(T, 4)>
+HWY_API Vec128<T, N> Reverse2(Simd<T, N> /* tag */, const Vec128<T, N> v) {
+  return Vec128<T, N>{Shuffle2301(Vec128<T>{v.raw}).raw};
+}
+
+template <typename T, HWY_IF_LANE_SIZE(T, 8)>
+HWY_API Vec128<T> Reverse2(Full128<T> /* tag */, const Vec128<T> v) {
+  return detail::ReverseGroupsViaBytes<2>(v);
+}
+
+// ------------------------------ Reverse4
+
+template <typename T, size_t N, hwy::EnableIf<sizeof(T) <= 2>* = nullptr>
+HWY_API Vec128<T, N> Reverse4(Simd<T, N> /* tag */, const Vec128<T, N> v) {
+  return detail::ReverseGroupsViaBytes<4>(v);
+}
+
+template <typename T, HWY_IF_LANE_SIZE(T, 4)>
+HWY_API Vec128<T> Reverse4(Full128<T> /* tag */, const Vec128<T> v) {
+  return Shuffle0123(v);
+}
+
+// ------------------------------ Reverse8
+
+template <typename T, size_t N, hwy::EnableIf<sizeof(T) <= 2>* = nullptr>
+HWY_API Vec128<T, N> Reverse8(Simd<T, N> /* tag */, const Vec128<T, N> v) {
+  return detail::ReverseGroupsViaBytes<8>(v);
+}
+
+// ------------------------------ ReverseBlocks
+
+// Single block: no change
+template <typename T, size_t N>
+HWY_API Vec128<T, N> ReverseBlocks(Simd<T, N> /* tag */, const Vec128<T, N> v) {
+  return v;
+}
+
 // ------------------------------ InterleaveLower
 
 template <size_t N>
@@ -2471,6 +2691,45 @@ HWY_API Vec128<uint8_t, N> U8FromU32(const Vec128<uint32_t, N> v) {
       wasm_u8x16_narrow_i16x8(intermediate, intermediate)};
 }
 
+// ------------------------------ ReorderDemote2To
+
+// For 128-bit vectors, the lane order is already preserved.
+HWY_API Vec128<int16_t> ReorderDemote2To(Full128<int16_t> /* tag */,
+                                         Vec128<int32_t> a, Vec128<int32_t> b) {
+  return Vec128<int16_t>{wasm_i16x8_narrow_i32x4(a.raw, b.raw)};
+}
+
+HWY_API Vec128<uint16_t> ReorderDemote2To(Full128<uint16_t> /* tag */,
+                                          Vec128<int32_t> a,
+                                          Vec128<int32_t> b) {
+  return Vec128<uint16_t>{wasm_u16x8_narrow_i32x4(a.raw, b.raw)};
+}
+
+HWY_API Vec128<uint8_t> ReorderDemote2To(Full128<uint8_t> /* tag */,
+                                         Vec128<int16_t> a, Vec128<int16_t> b) {
+  return Vec128<uint8_t>{wasm_u8x16_narrow_i16x8(a.raw, b.raw)};
+}
+
+HWY_API Vec128<int8_t> ReorderDemote2To(Full128<int8_t> /* tag */,
+                                        Vec128<int16_t> a, Vec128<int16_t> b) {
+  return Vec128<int8_t>{wasm_i8x16_narrow_i16x8(a.raw, b.raw)};
+}
+
+// Partial: first concatenate the inputs into one vector, then demote that.
+template <typename TN, size_t N, typename TW, HWY_IF_LE64(TN, N)>
+HWY_API Vec128<TN, N> ReorderDemote2To(Simd<TN, N> dn, Vec128<TW, N / 2> a,
+                                       Vec128<TW, N / 2> b) {
+  return DemoteTo(dn, Combine(Simd<TW, N>(), b, a));
+}
+
+// ------------------------------ OrderedDemote2To
+
+template <typename TN, size_t N, typename TW>
+HWY_API Vec128<TN, N> OrderedDemote2To(Simd<TN, N> dn, Vec128<TW, N / 2> a,
+                                       Vec128<TW, N / 2> b) {
+  return ReorderDemote2To(dn, a, b);
+}
+
 // ------------------------------ Convert i32 <=> f32 (Round)
 
 template <size_t N>
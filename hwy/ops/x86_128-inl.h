@@ -1470,8 +1470,12 @@ template <size_t N>
 HWY_API Mask128<int64_t, N> operator>(const Vec128<int64_t, N> a,
                                       const Vec128<int64_t, N> b) {
 #if HWY_TARGET == HWY_SSSE3
-  // If the upper half is less than or greater, this is the answer.
-  const __m128i m_gt = _mm_cmpgt_epi32(a.raw, b.raw);
+  // If the upper half is less than or greater, this is the answer. Lower
+  // halves are unsigned, so flip their sign bits before the signed compare.
+  const __m128i flip_lo = _mm_set_epi32(0, LimitsMin<int32_t>(), 0,
+                                        LimitsMin<int32_t>());
+  const __m128i m_gt = _mm_cmpgt_epi32(_mm_xor_si128(a.raw, flip_lo),
+                                       _mm_xor_si128(b.raw, flip_lo));
 
   // Otherwise, the lower half decides.
   const __m128i m_eq = _mm_cmpeq_epi32(a.raw, b.raw);
@@ -1771,6 +1775,65 @@ HWY_API void StoreU(const Vec128<T, N> v, Simd<T, N> d, T* HWY_RESTRICT p) {
   Store(v, d, p);
 }
 
+// ------------------------------ BlendedStore
+
+namespace detail {
+
+// Partial vectors may have garbage in their upper lanes, so also clear the
+// corresponding mask bits to avoid accessing memory past the end of the vector.
+template <typename T, size_t N>
+HWY_INLINE Mask128<T, N> OnlyValidLanes(Simd<T, N> d, Mask128<T, N> m) {
+  return (N * sizeof(T) == 16) ? m : And(m, FirstN(d, N));
+}
+
+}  // namespace detail
+
+#if HWY_TARGET <= HWY_AVX3
+
+#ifdef HWY_NATIVE_BLENDED_STORE
+#undef HWY_NATIVE_BLENDED_STORE
+#else
+#define HWY_NATIVE_BLENDED_STORE
+#endif
+
+template <typename T, size_t N, HWY_IF_LANE_SIZE(T, 1)>
+HWY_API void BlendedStore(Vec128<T, N> v, Mask128<T, N> m, Simd<T, N> d,
+                          T* HWY_RESTRICT p) {
+  _mm_mask_storeu_epi8(p, detail::OnlyValidLanes(d, m).raw, v.raw);
+}
+
+template <typename T, size_t N, HWY_IF_LANE_SIZE(T, 2)>
+HWY_API void BlendedStore(Vec128<T, N> v, Mask128<T, N> m, Simd<T, N> d,
+                          T* HWY_RESTRICT p) {
+  _mm_mask_storeu_epi16(p, detail::OnlyValidLanes(d, m).raw, v.raw);
+}
+
+template <typename T, size_t N, HWY_IF_LANE_SIZE(T, 4)>
+HWY_API void BlendedStore(Vec128<T, N> v, Mask128<T, N> m, Simd<T, N> d,
+                          T* HWY_RESTRICT p) {
+  _mm_mask_storeu_epi32(p, detail::OnlyValidLanes(d, m).raw, v.raw);
+}
+
+template <typename T, size_t N, HWY_IF_LANE_SIZE(T, 8)>
+HWY_API void BlendedStore(Vec128<T, N> v, Mask128<T, N> m, Simd<T, N> d,
+                          T* HWY_RESTRICT p) {
+  _mm_mask_storeu_epi64(p, detail::OnlyValidLanes(d, m).raw, v.raw);
+}
+
+template <size_t N>
+HWY_API void BlendedStore(Vec128<float, N> v, Mask128<float, N> m,
+                          Simd<float, N> d, float* HWY_RESTRICT p) {
+  _mm_mask_storeu_ps(p, detail::OnlyValidLanes(d, m).raw, v.raw);
+}
+
+template <size_t N>
+HWY_API void BlendedStore(Vec128<double, N> v, Mask128<double, N> m,
+                          Simd<double, N> d, double* HWY_RESTRICT p) {
+  _mm_mask_storeu_pd(p, detail::OnlyValidLanes(d, m).raw, v.raw);
+}
+
+#endif  // HWY_TARGET <= HWY_AVX3
+
 // ================================================== ARITHMETIC
 
 // ------------------------------ Addition
@@ -1889,6 +1952,66 @@ HWY_API Vec128<double, N> operator-(const Vec128<double, N> a,
   return Vec128<double, N>{_mm_sub_pd(a.raw, b.raw)};
 }
 
+// ------------------------------ SumsOf8
+
+#ifdef HWY_NATIVE_SUMS_OF_8
+#undef HWY_NATIVE_SUMS_OF_8
+#else
+#define HWY_NATIVE_SUMS_OF_8
+#endif
+
+template <size_t N, HWY_IF_GE64(uint8_t, N)>
+HWY_API Vec128<uint64_t, N / 8> SumsOf8(const Vec128<uint8_t, N> v) {
+  return Vec128<uint64_t, N / 8>{_mm_sad_epu8(v.raw, _mm_setzero_si128())};
+}
+
+// ------------------------------ SumsOfAbsDiff
+template <size_t N, HWY_IF_GE64(uint8_t, N)>
+HWY_API Vec128<uint64_t, N / 8> SumsOfAbsDiff(const Vec128<uint8_t, N> a,
+                                              const Vec128<uint8_t, N> b) {
+  return Vec128<uint64_t, N / 8>{_mm_sad_epu8(a.raw, b.raw)};
+}
+
+// ------------------------------ SumsOf2
+
+#ifdef HWY_NATIVE_SUMS_OF_2
+#undef HWY_NATIVE_SUMS_OF_2
+#else
+#define HWY_NATIVE_SUMS_OF_2
+#endif
+
+template <size_t N>
+HWY_API Vec128<uint16_t, N / 2> SumsOf2(const Vec128<uint8_t, N> v) {
+  return Vec128<uint16_t, N / 2>{_mm_maddubs_epi16(v.raw, _mm_set1_epi8(1))};
+}
+
+template <size_t N>
+HWY_API Vec128<int16_t, N / 2> SumsOf2(const Vec128<int8_t, N> v) {
+  // maddubs treats its first argument as unsigned and the second as signed.
+  return Vec128<int16_t, N / 2>{_mm_maddubs_epi16(_mm_set1_epi8(1), v.raw)};
+}
+
+template <size_t N>
+HWY_API Vec128<uint32_t, N / 2> SumsOf2(const Vec128<uint16_t, N> v) {
+  // madd is signed: bias the inputs by -0x8000 and the sum by 2 * 0x8000.
+  const __m128i biased = _mm_xor_si128(v.raw, _mm_set1_epi16(-0x8000));
+  const __m128i sums = _mm_madd_epi16(biased, _mm_set1_epi16(1));
+  return Vec128<uint32_t, N / 2>{_mm_add_epi32(sums, _mm_set1_epi32(0x10000))};
+}
+
+template <size_t N>
+HWY_API Vec128<int32_t, N / 2> SumsOf2(const Vec128<int16_t, N> v) {
+  return Vec128<int32_t, N / 2>{_mm_madd_epi16(v.raw, _mm_set1_epi16(1))};
+}
+
+template <size_t N>
+HWY_API Vec128<double, N / 2> SumsOf2(const Vec128<float, N> v) {
+  const __m128 even = _mm_shuffle_ps(v.raw, v.raw, _MM_SHUFFLE(2, 0, 2, 0));
+  const __m128 odd = _mm_shuffle_ps(v.raw, v.raw, _MM_SHUFFLE(3, 1, 3, 1));
+  return Vec128<double, N / 2>{
+      _mm_add_pd(_mm_cvtps_pd(even), _mm_cvtps_pd(odd))};
+}
+
 // ------------------------------ Saturating addition
 
 // Returns a + b clamped to the destination range.
@@ -1986,6 +2109,20 @@ HWY_API Vec128<int16_t, N> MulHigh(const Vec128<int16_t, N> a,
   return Vec128<int16_t, N>{_mm_mulhi_epi16(a.raw, b.raw)};
 }
 
+// ------------------------------ MulFixedPoint15
+
+#ifdef HWY_NATIVE_MUL_FIXED_POINT15
+#undef HWY_NATIVE_MUL_FIXED_POINT15
+#else
+#define HWY_NATIVE_MUL_FIXED_POINT15
+#endif
+
+template <size_t N>
+HWY_API Vec128<int16_t, N> MulFixedPoint15(const Vec128<int16_t, N> a,
+                                           const Vec128<int16_t, N> b) {
+  return Vec128<int16_t, N>{_mm_mulhrs_epi16(a.raw, b.raw)};
+}
+
 // Multiplies even lanes (0, 2 ..) and places the double-wide result into
 // even and the upper half into its odd neighbor lane.
 template <size_t N>
@@ -2317,6 +2454,128 @@ HWY_API Vec128<int8_t, N> ShiftRightSame(Vec128<int8_t, N> v, const int bits) {
   return (shifted ^ shifted_sign) - shifted_sign;
 }
 
+#if HWY_TARGET <= HWY_AVX3
+
+// ------------------------------ RotateRight (ShiftRight, ShiftLeft)
+
+#ifdef HWY_NATIVE_ROTATE
+#undef HWY_NATIVE_ROTATE
+#else
+#define HWY_NATIVE_ROTATE
+#endif
+
+namespace detail {
+
+// There are no 8/16-bit rotate instructions. Also used by x86_256/512.
+template <int kBits, class V>
+HWY_INLINE V RotateRightViaShifts(const V v) {
+  const DFromV<V> d;
+  const RebindToUnsigned<decltype(d)> du;
+  constexpr int kSizeInBits = static_cast<int>(sizeof(TFromD<decltype(d)>) * 8);
+  static_assert(0 <= kBits && kBits < kSizeInBits, "Invalid shift count");
+  constexpr int kLeft = (kSizeInBits - kBits) & (kSizeInBits - 1);
+  const auto vu = BitCast(du, v);
+  return BitCast(d, ShiftRight<kBits>(vu) | ShiftLeft<kLeft>(vu));
+}
+
+}  // namespace detail
+
+template <int kBits, typename T, size_t N,
+          hwy::EnableIf<sizeof(T) <= 2>* = nullptr>
+HWY_API Vec128<T, N> RotateRight(const Vec128<T, N> v) {
+  return detail::RotateRightViaShifts<kBits>(v);
+}
+
+template <int kBits, size_t N>
+HWY_API Vec128<uint32_t, N> RotateRight(const Vec128<uint32_t, N> v) {
+  static_assert(0 <= kBits && kBits < 32, "Invalid shift count");
+  return Vec128<uint32_t, N>{_mm_ror_epi32(v.raw, kBits)};
+}
+template <int kBits, size_t N>
+HWY_API Vec128<int32_t, N> RotateRight(const Vec128<int32_t, N> v) {
+  static_assert(0 <= kBits && kBits < 32, "Invalid shift count");
+  return Vec128<int32_t, N>{_mm_ror_epi32(v.raw, kBits)};
+}
+template <int kBits, size_t N>
+HWY_API Vec128<uint64_t, N> RotateRight(const Vec128<uint64_t, N> v) {
+  static_assert(0 <= kBits && kBits < 64, "Invalid shift count");
+  return Vec128<uint64_t, N>{_mm_ror_epi64(v.raw, kBits)};
+}
+template <int kBits, size_t N>
+HWY_API Vec128<int64_t, N> RotateRight(const Vec128<int64_t, N> v) {
+  static_assert(0 <= kBits && kBits < 64, "Invalid shift count");
+  return Vec128<int64_t, N>{_mm_ror_epi64(v.raw, kBits)};
+}
+
+// ------------------------------ LeadingZeroCount (ShiftLeft, Min)
+
+#ifdef HWY_NATIVE_LEADING_ZERO_COUNT
+#undef HWY_NATIVE_LEADING_ZERO_COUNT
+#else
+#define HWY_NATIVE_LEADING_ZERO_COUNT
+#endif
+
+template <size_t N>
+HWY_API Vec128<uint32_t, N> LeadingZeroCount(const Vec128<uint32_t, N> v) {
+  return Vec128<uint32_t, N>{_mm_lzcnt_epi32(v.raw)};
+}
+template <size_t N>
+HWY_API Vec128<int32_t, N> LeadingZeroCount(const Vec128<int32_t, N> v) {
+  return Vec128<int32_t, N>{_mm_lzcnt_epi32(v.raw)};
+}
+template <size_t N>
+HWY_API Vec128<uint64_t, N> LeadingZeroCount(const Vec128<uint64_t, N> v) {
+  return Vec128<uint64_t, N>{_mm_lzcnt_epi64(v.raw)};
+}
+template <size_t N>
+HWY_API Vec128<int64_t, N> LeadingZeroCount(const Vec128<int64_t, N> v) {
+  return Vec128<int64_t, N>{_mm_lzcnt_epi64(v.raw)};
+}
+
+namespace detail {
+
+// VPLZCNT only supports 32/64-bit lanes. Counts both halves of each
+// double-width lane and caps them at the half size. Also used by x86_256/512.
+template <class V>  // u8 or u16
+HWY_INLINE V LeadingZeroCountViaWide(const V v) {
+  const DFromV<V> d;
+  const RepartitionToWide<decltype(d)> dw;
+  using TW = TFromD<decltype(dw)>;
+  constexpr int kBits = static_cast<int>(sizeof(TFromD<decltype(d)>) * 8);
+  const auto vw = BitCast(dw, v);
+  const auto max = Set(dw, static_cast<TW>(kBits));
+  const auto upper = Min(LeadingZeroCount(vw), max);
+  const auto lower = Min(LeadingZeroCount(ShiftLeft<kBits>(vw)), max);
+  return BitCast(d, ShiftLeft<kBits>(upper) | lower);
+}
+
+}  // namespace detail
+
+template <typename T, size_t N, hwy::EnableIf<sizeof(T) <= 2>* = nullptr>
+HWY_API Vec128<T, N> LeadingZeroCount(const Vec128<T, N> v) {
+  // Compute on the full vector because partial vectors cannot be repartitioned
+  // into wider lanes.
+  const Full128<MakeUnsigned<T>> du;
+  const Vec128<T> full{v.raw};
+  const auto lz = detail::LeadingZeroCountViaWide(BitCast(du, full));
+  return Vec128<T, N>{lz.raw};
+}
+
+// ------------------------------ TrailingZeroCount (LeadingZeroCount)
+
+// Also used for Vec256/Vec512.
+template <class V>
+HWY_API V TrailingZeroCount(const V v) {
+  const DFromV<V> d;
+  using T = TFromD<decltype(d)>;
+  const auto bits = Set(d, static_cast<T>(sizeof(T) * 8));
+  // All bits below the least-significant 1-bit (all bits if v is zero).
+  const auto below = AndNot(v, v - Set(d, 1));
+  return bits - LeadingZeroCount(below);
+}
+
+#endif  // HWY_TARGET <= HWY_AVX3
+
 // ------------------------------ Floating-point mul / div
 
 template <size_t N>
@@ -2680,6 +2939,289 @@ HWY_API Vec128<double, N> Max(const Vec128<double, N> a,
   return Vec128<double, N>{_mm_max_pd(a.raw, b.raw)};
 }
 
+// ------------------------------ Masked arithmetic
+
+// AVX3 has native merge-masking; other targets use the generic IfThenElse.
+#if HWY_TARGET <= HWY_AVX3
+
+#ifdef HWY_NATIVE_MASKED_ARITH
+#undef HWY_NATIVE_MASKED_ARITH
+#else
+#define HWY_NATIVE_MASKED_ARITH
+#endif
+
+namespace detail {
+
+template <typename T, size_t N>
+HWY_INLINE Vec128<T, N> MaskedAddOr(hwy::SizeTag<1> /* tag */, Vec128<T, N> no,
+                                    Mask128<T, N> m, Vec128<T, N> a,
+                                    Vec128<T, N> b) {
+  return Vec128<T, N>{_mm_mask_add_epi8(no.raw, m.raw, a.raw, b.raw)};
+}
+template <typename T, size_t N>
+HWY_INLINE Vec128<T, N> MaskedAddOr(hwy::SizeTag<2> /* tag */, Vec128<T, N> no,
+                                    Mask128<T, N> m, Vec128<T, N> a,
+                                    Vec128<T, N> b) {
+  return Vec128<T, N>{_mm_mask_add_epi16(no.raw, m.raw, a.raw, b.raw)};
+}
+template <typename T, size_t N>
+HWY_INLINE Vec128<T, N> MaskedAddOr(hwy::SizeTag<4> /* tag */, Vec128<T, N> no,
+                                    Mask128<T, N> m, Vec128<T, N> a,
+                                    Vec128<T, N> b) {
+  return Vec128<T, N>{_mm_mask_add_epi32(no.raw, m.raw, a.raw, b.raw)};
+}
+template <typename T, size_t N>
+HWY_INLINE Vec128<T, N> MaskedAddOr(hwy::SizeTag<8> /* tag */, Vec128<T, N> no,
+                                    Mask128<T, N> m, Vec128<T, N> a,
+                                    Vec128<T, N> b) {
+  return Vec128<T, N>{_mm_mask_add_epi64(no.raw, m.raw, a.raw, b.raw)};
+}
+
+template <typename T, size_t N>
+HWY_INLINE Vec128<T, N> MaskedSubOr(hwy::SizeTag<1> /* tag */, Vec128<T, N> no,
+                                    Mask128<T, N> m, Vec128<T, N> a,
+                                    Vec128<T, N> b) {
+  return Vec128<T, N>{_mm_mask_sub_epi8(no.raw, m.raw, a.raw, b.raw)};
+}
+template <typename T, size_t N>
+HWY_INLINE Vec128<T, N> MaskedSubOr(hwy::SizeTag<2> /* tag */, Vec128<T, N> no,
+                                    Mask128<T, N> m, Vec128<T, N> a,
+                                    Vec128<T, N> b) {
+  return Vec128<T, N>{_mm_mask_sub_epi16(no.raw, m.raw, a.raw, b.raw)};
+}
+template <typename T, size_t N>
+HWY_INLINE Vec128<T, N> MaskedSubOr(hwy::SizeTag<4> /* tag */, Vec128<T, N> no,
+                                    Mask128<T, N> m, Vec128<T, N> a,
+                                    Vec128<T, N> b) {
+  return Vec128<T, N>{_mm_mask_sub_epi32(no.raw, m.raw, a.raw, b.raw)};
+}
+template <typename T, size_t N>
+HWY_INLINE Vec128<T, N> MaskedSubOr(hwy::SizeTag<8> /* tag */, Vec128<T, N> no,
+                                    Mask128<T, N> m, Vec128<T, N> a,
+                                    Vec128<T, N> b) {
+  return Vec128<T, N>{_mm_mask_sub_epi64(no.raw, m.raw, a.raw, b.raw)};
+}
+
+template <typename T, size_t N>
+HWY_INLINE Vec128<T, N> MaskedMulOr(hwy::SizeTag<2> /* tag */, Vec128<T, N> no,
+                                    Mask128<T, N> m, Vec128<T, N> a,
+                                    Vec128<T, N> b) {
+  return Vec128<T, N>{_mm_mask_mullo_epi16(no.raw, m.raw, a.raw, b.raw)};
+}
+template <typename T, size_t N>
+HWY_INLINE Vec128<T, N> MaskedMulOr(hwy::SizeTag<4> /* tag */, Vec128<T, N> no,
+                                    Mask128<T, N> m, Vec128<T, N> a,
+                                    Vec128<T, N> b) {
+  return Vec128<T, N>{_mm_mask_mullo_epi32(no.raw, m.raw, a.raw, b.raw)};
+}
+template <typename T, size_t N>
+HWY_INLINE Vec128<T, N> MaskedMulOr(hwy::SizeTag<8> /* tag */, Vec128<T, N> no,
+                                    Mask128<T, N> m, Vec128<T, N> a,
+                                    Vec128<T, N> b) {
+  return Vec128<T, N>{_mm_mask_mullo_epi64(no.raw, m.raw, a.raw, b.raw)};
+}
+
+}  // namespace detail
+
+template <typename T, size_t N>
+HWY_API Vec128<T, N> MaskedAddOr(Vec128<T, N> no, Mask128<T, N> m,
+                                 Vec128<T, N> a, Vec128<T, N> b) {
+  return detail::MaskedAddOr(hwy::SizeTag<sizeof(T)>(), no, m, a, b);
+}
+template <size_t N>
+HWY_API Vec128<float, N> MaskedAddOr(Vec128<float, N> no, Mask128<float, N> m,
+                                     Vec128<float, N> a, Vec128<float, N> b) {
+  return Vec128<float, N>{_mm_mask_add_ps(no.raw, m.raw, a.raw, b.raw)};
+}
+template <size_t N>
+HWY_API Vec128<double, N> MaskedAddOr(Vec128<double, N> no,
+                                      Mask128<double, N> m, Vec128<double, N> a,
+                                      Vec128<double, N> b) {
+  return Vec128<double, N>{_mm_mask_add_pd(no.raw, m.raw, a.raw, b.raw)};
+}
+
+template <typename T, size_t N>
+HWY_API Vec128<T, N> MaskedSubOr(Vec128<T, N> no, Mask128<T, N> m,
+                                 Vec128<T, N> a, Vec128<T, N> b) {
+  return detail::MaskedSubOr(hwy::SizeTag<sizeof(T)>(), no, m, a, b);
+}
+template <size_t N>
+HWY_API Vec128<float, N> MaskedSubOr(Vec128<float, N> no, Mask128<float, N> m,
+                                     Vec128<float, N> a, Vec128<float, N> b) {
+  return Vec128<float, N>{_mm_mask_sub_ps(no.raw, m.raw, a.raw, b.raw)};
+}
+template <size_t N>
+HWY_API Vec128<double, N> MaskedSubOr(Vec128<double, N> no,
+                                      Mask128<double, N> m, Vec128<double, N> a,
+                                      Vec128<double, N> b) {
+  return Vec128<double, N>{_mm_mask_sub_pd(no.raw, m.raw, a.raw, b.raw)};
+}
+
+template <typename T, size_t N>
+HWY_API Vec128<T, N> MaskedMulOr(Vec128<T, N> no, Mask128<T, N> m,
+                                 Vec128<T, N> a, Vec128<T, N> b) {
+  return detail::MaskedMulOr(hwy::SizeTag<sizeof(T)>(), no, m, a, b);
+}
+template <size_t N>
+HWY_API Vec128<float, N> MaskedMulOr(Vec128<float, N> no, Mask128<float, N> m,
+                                     Vec128<float, N> a, Vec128<float, N> b) {
+  return Vec128<float, N>{_mm_mask_mul_ps(no.raw, m.raw, a.raw, b.raw)};
+}
+template <size_t N>
+HWY_API Vec128<double, N> MaskedMulOr(Vec128<double, N> no,
+                                      Mask128<double, N> m, Vec128<double, N> a,
+                                      Vec128<double, N> b) {
+  return Vec128<double, N>{_mm_mask_mul_pd(no.raw, m.raw, a.raw, b.raw)};
+}
+
+template <size_t N>
+HWY_API Vec128<float, N> MaskedDivOr(Vec128<float, N> no, Mask128<float, N> m,
+                                     Vec128<float, N> a, Vec128<float, N> b) {
+  return Vec128<float, N>{_mm_mask_div_ps(no.raw, m.raw, a.raw, b.raw)};
+}
+template <size_t N>
+HWY_API Vec128<double, N> MaskedDivOr(Vec128<double, N> no,
+                                      Mask128<double, N> m, Vec128<double, N> a,
+                                      Vec128<double, N> b) {
+  return Vec128<double, N>{_mm_mask_div_pd(no.raw, m.raw, a.raw, b.raw)};
+}
+
+template <size_t N>
+HWY_API Vec128<uint8_t, N> MaskedMinOr(Vec128<uint8_t, N> no,
+                                       Mask128<uint8_t, N> m,
+                                       Vec128<uint8_t, N> a,
+                                       Vec128<uint8_t, N> b) {
+  return Vec128<uint8_t, N>{_mm_mask_min_epu8(no.raw, m.raw, a.raw, b.raw)};
+}
+template <size_t N>
+HWY_API Vec128<int8_t, N> MaskedMinOr(Vec128<int8_t, N> no,
+                                      Mask128<int8_t, N> m, Vec128<int8_t, N> a,
+                                      Vec128<int8_t, N> b) {
+  return Vec128<int8_t, N>{_mm_mask_min_epi8(no.raw, m.raw, a.raw, b.raw)};
+}
+template <size_t N>
+HWY_API Vec128<uint16_t, N> MaskedMinOr(Vec128<uint16_t, N> no,
+                                        Mask128<uint16_t, N> m,
+                                        Vec128<uint16_t, N> a,
+                                        Vec128<uint16_t, N> b) {
+  return Vec128<uint16_t, N>{_mm_mask_min_epu16(no.raw, m.raw, a.raw, b.raw)};
+}
+template <size_t N>
+HWY_API Vec128<int16_t, N> MaskedMinOr(Vec128<int16_t, N> no,
+                                       Mask128<int16_t, N> m,
+                                       Vec128<int16_t, N> a,
+                                       Vec128<int16_t, N> b) {
+  return Vec128<int16_t, N>{_mm_mask_min_epi16(no.raw, m.raw, a.raw, b.raw)};
+}
+template <size_t N>
+HWY_API Vec128<uint32_t, N> MaskedMinOr(Vec128<uint32_t, N> no,
+                                        Mask128<uint32_t, N> m,
+                                        Vec128<uint32_t, N> a,
+                                        Vec128<uint32_t, N> b) {
+  return Vec128<uint32_t, N>{_mm_mask_min_epu32(no.raw, m.raw, a.raw, b.raw)};
+}
+template <size_t N>
+HWY_API Vec128<int32_t, N> MaskedMinOr(Vec128<int32_t, N> no,
+                                       Mask128<int32_t, N> m,
+                                       Vec128<int32_t, N> a,
+                                       Vec128<int32_t, N> b) {
+  return Vec128<int32_t, N>{_mm_mask_min_epi32(no.raw, m.raw, a.raw, b.raw)};
+}
+template <size_t N>
+HWY_API Vec128<uint64_t, N> MaskedMinOr(Vec128<uint64_t, N> no,
+                                        Mask128<uint64_t, N> m,
+                                        Vec128<uint64_t, N> a,
+                                        Vec128<uint64_t, N> b) {
+  return Vec128<uint64_t, N>{_mm_mask_min_epu64(no.raw, m.raw, a.raw, b.raw)};
+}
+template <size_t N>
+HWY_API Vec128<int64_t, N> MaskedMinOr(Vec128<int64_t, N> no,
+                                       Mask128<int64_t, N> m,
+                                       Vec128<int64_t, N> a,
+                                       Vec128<int64_t, N> b) {
+  return Vec128<int64_t, N>{_mm_mask_min_epi64(no.raw, m.raw, a.raw, b.raw)};
+}
+template <size_t N>
+HWY_API Vec128<float, N> MaskedMinOr(Vec128<float, N> no, Mask128<float, N> m,
+                                     Vec128<float, N> a, Vec128<float, N> b) {
+  return Vec128<float, N>{_mm_mask_min_ps(no.raw, m.raw, a.raw, b.raw)};
+}
+template <size_t N>
+HWY_API Vec128<double, N> MaskedMinOr(Vec128<double, N> no,
+                                      Mask128<double, N> m, Vec128<double, N> a,
+                                      Vec128<double, N> b) {
+  return Vec128<double, N>{_mm_mask_min_pd(no.raw, m.raw, a.raw, b.raw)};
+}
+
+template <size_t N>
+HWY_API Vec128<uint8_t, N> MaskedMaxOr(Vec128<uint8_t, N> no,
+                                       Mask128<uint8_t, N> m,
+                                       Vec128<uint8_t, N> a,
+                                       Vec128<uint8_t, N> b) {
+  return Vec128<uint8_t, N>{_mm_mask_max_epu8(no.raw, m.raw, a.raw, b.raw)};
+}
+template <size_t N>
+HWY_API Vec128<int8_t, N> MaskedMaxOr(Vec128<int8_t, N> no,
+                                      Mask128<int8_t, N> m, Vec128<int8_t, N> a,
+                                      Vec128<int8_t, N> b) {
+  return Vec128<int8_t, N>{_mm_mask_max_epi8(no.raw, m.raw, a.raw, b.raw)};
+}
+template <size_t N>
+HWY_API Vec128<uint16_t, N> MaskedMaxOr(Vec128<uint16_t, N> no,
+                                        Mask128<uint16_t, N> m,
+                                        Vec128<uint16_t, N> a,
+                                        Vec128<uint16_t, N> b) {
+  return Vec128<uint16_t, N>{_mm_mask_max_epu16(no.raw, m.raw, a.raw, b.raw)};
+}
+template <size_t N>
+HWY_API Vec128<int16_t, N> MaskedMaxOr(Vec128<int16_t, N> no,
+                                       Mask128<int16_t, N> m,
+                                       Vec128<int16_t, N> a,
+                                       Vec128<int16_t, N> b) {
+  return Vec128<int16_t, N>{_mm_mask_max_epi16(no.raw, m.raw, a.raw, b.raw)};
+}
+template <size_t N>
+HWY_API Vec128<uint32_t, N> MaskedMaxOr(Vec128<uint32_t, N> no,
+                                        Mask128<uint32_t, N> m,
+                                        Vec128<uint32_t, N> a,
+                                        Vec128<uint32_t, N> b) {
+  return Vec128<uint32_t, N>{_mm_mask_max_epu32(no.raw, m.raw, a.raw, b.raw)};
+}
+template <size_t N>
+HWY_API Vec128<int32_t, N> MaskedMaxOr(Vec128<int32_t, N> no,
+                                       Mask128<int32_t, N> m,
+                                       Vec128<int32_t, N> a,
+                                       Vec128<int32_t, N> b) {
+  return Vec128<int32_t, N>{_mm_mask_max_epi32(no.raw, m.raw, a.raw, b.raw)};
+}
+template <size_t N>
+HWY_API Vec128<uint64_t, N> MaskedMaxOr(Vec128<uint64_t, N> no,
+                                        Mask128<uint64_t, N> m,
+                                        Vec128<uint64_t, N> a,
+                                        Vec128<uint64_t, N> b) {
+  return Vec128<uint64_t, N>{_mm_mask_max_epu64(no.raw, m.raw, a.raw, b.raw)};
+}
+template <size_t N>
+HWY_API Vec128<int64_t, N> MaskedMaxOr(Vec128<int64_t, N> no,
+                                       Mask128<int64_t, N> m,
+                                       Vec128<int64_t, N> a,
+                                       Vec128<int64_t, N> b) {
+  return Vec128<int64_t, N>{_mm_mask_max_epi64(no.raw, m.raw, a.raw, b.raw)};
+}
+template <size_t N>
+HWY_API Vec128<float, N> MaskedMaxOr(Vec128<float, N> no, Mask128<float, N> m,
+                                     Vec128<float, N> a, Vec128<float, N> b) {
+  return Vec128<float, N>{_mm_mask_max_ps(no.raw, m.raw, a.raw, b.raw)};
+}
+template <size_t N>
+HWY_API Vec128<double, N> MaskedMaxOr(Vec128<double, N> no,
+                                      Mask128<double, N> m, Vec128<double, N> a,
+                                      Vec128<double, N> b) {
+  return Vec128<double, N>{_mm_mask_max_pd(no.raw, m.raw, a.raw, b.raw)};
+}
+
+#endif  // HWY_TARGET <= HWY_AVX3
+
 // ================================================== MEMORY (2)
 
 // ------------------------------ Non-temporal stores
@@ -2712,9 +3254,116 @@ HWY_DIAGNOSTICS_OFF(disable : 4245 4365, ignored "-Wsign-conversion")
 using GatherIndex64 = long long int;  // NOLINT(google-runtime-int)
 static_assert(sizeof(GatherIndex64) == 8, "Must be 64-bit type");
 
+namespace detail {
+
+// There are no 8/16-bit scatter/gather instructions. Widening the indices for
+// use with 32-bit gathers requires packing the results and may read past the
+// end of the array, so we instead copy one lane at a time.
+
+template <class D, class V, class VI>
+HWY_INLINE void ScatterOffsetEmu(V v, D d, TFromD<D>* HWY_RESTRICT base,
+                                 const VI offset) {
+  using T = TFromD<D>;
+  const Rebind<MakeSigned<T>, D> di;
+  alignas(64) T lanes[MaxLanes(d)];
+  Store(v, d, lanes);
+  alignas(64) MakeSigned<T> offset_lanes[MaxLanes(d)];
+  Store(offset, di, offset_lanes);
+
+  uint8_t* base_bytes = reinterpret_cast<uint8_t*>(base);
+  for (size_t i = 0; i < MaxLanes(d); ++i) {
+    CopyBytes<sizeof(T)>(
+        &lanes[i], base_bytes + detail::ScatterGatherIndex(offset_lanes[i]));
+  }
+}
+
+template <class D, class V, class VI>
+HWY_INLINE void ScatterIndexEmu(V v, D d, TFromD<D>* HWY_RESTRICT base,
+                                const VI index) {
+  using T = TFromD<D>;
+  const Rebind<MakeSigned<T>, D> di;
+  alignas(64) T lanes[MaxLanes(d)];
+  Store(v, d, lanes);
+  alignas(64) MakeSigned<T> index_lanes[MaxLanes(d)];
+  Store(index, di, index_lanes);
+
+  for (size_t i = 0; i < MaxLanes(d); ++i) {
+    base[detail::ScatterGatherIndex(index_lanes[i])] = lanes[i];
+  }
+}
+
+template <class D, class VI>
+HWY_INLINE decltype(Zero(D())) GatherOffsetEmu(
+    D d, const TFromD<D>* HWY_RESTRICT base, const VI offset) {
+  using T = TFromD<D>;
+  const Rebind<MakeSigned<T>, D> di;
+  alignas(64) MakeSigned<T> offset_lanes[MaxLanes(d)];
+  Store(offset, di, offset_lanes);
+
+  alignas(64) T lanes[MaxLanes(d)];
+  const uint8_t* base_bytes = reinterpret_cast<const uint8_t*>(base);
+  for (size_t i = 0; i < MaxLanes(d); ++i) {
+    CopyBytes<sizeof(T)>(
+        base_bytes + detail::ScatterGatherIndex(offset_lanes[i]), &lanes[i]);
+  }
+  return Load(d, lanes);
+}
+
+template <class D, class VI>
+HWY_INLINE decltype(Zero(D())) GatherIndexEmu(
+    D d, const TFromD<D>* HWY_RESTRICT base, const VI index) {
+  using T = TFromD<D>;
+  const Rebind<MakeSigned<T>, D> di;
+  alignas(64) MakeSigned<T> index_lanes[MaxLanes(d)];
+  Store(index, di, index_lanes);
+
+  alignas(64) T lanes[MaxLanes(d)];
+  for (size_t i = 0; i < MaxLanes(d); ++i) {
+    lanes[i] = base[detail::ScatterGatherIndex(index_lanes[i])];
+  }
+  return Load(d, lanes);
+}
+
+template <class D, class M, class VI>
+HWY_INLINE decltype(Zero(D())) MaskedGatherIndexEmu(
+    M m, D d, const TFromD<D>* HWY_RESTRICT base, const VI index) {
+  using T = TFromD<D>;
+  const Rebind<MakeSigned<T>, D> di;
+  alignas(64) MakeSigned<T> index_lanes[MaxLanes(d)];
+  Store(index, di, index_lanes);
+  alignas(64) MakeSigned<T> mask_lanes[MaxLanes(d)];
+  Store(BitCast(di, VecFromMask(d, m)), di, mask_lanes);
+
+  alignas(64) T lanes[MaxLanes(d)];
+  for (size_t i = 0; i < MaxLanes(d); ++i) {
+    lanes[i] = mask_lanes[i] ? base[detail::ScatterGatherIndex(index_lanes[i])]
+                             : T(0);
+  }
+  return Load(d, lanes);
+}
+
+}  // namespace detail
+
 #if HWY_TARGET <= HWY_AVX3
 namespace detail {
 
+template <typename T, size_t N, size_t kLaneSize, typename Offset,
+          hwy::EnableIf<kLaneSize <= 2>* = nullptr>
+HWY_INLINE void ScatterOffset(hwy::SizeTag<kLaneSize> /* tag */,
+                              Vec128<T, N> v, Simd<T, N> d,
+                              T* HWY_RESTRICT base,
+                              const Vec128<Offset, N> offset) {
+  ScatterOffsetEmu(v, d, base, offset);
+}
+template <typename T, size_t N, size_t kLaneSize, typename Index,
+          hwy::EnableIf<kLaneSize <= 2>* = nullptr>
+HWY_INLINE void ScatterIndex(hwy::SizeTag<kLaneSize> /* tag */,
+                             Vec128<T, N> v, Simd<T, N> d,
+                             T* HWY_RESTRICT base,
+                             const Vec128<Index, N> index) {
+  ScatterIndexEmu(v, d, base, index);
+}
+
 template <typename T, size_t N>
 HWY_INLINE void ScatterOffset(hwy::SizeTag<4> /* tag */, Vec128<T, N> v,
                               Simd<T, N> /* tag */, T* HWY_RESTRICT base,
@@ -2836,7 +3485,8 @@ HWY_API void ScatterOffset(Vec128<T, N> v, Simd<T, N> d, T* HWY_RESTRICT base,
 
   uint8_t* base_bytes = reinterpret_cast<uint8_t*>(base);
   for (size_t i = 0; i < N; ++i) {
-    CopyBytes<sizeof(T)>(&lanes[i], base_bytes + offset_lanes[i]);
+    CopyBytes<sizeof(T)>(
+        &lanes[i], base_bytes + detail::ScatterGatherIndex(offset_lanes[i]));
   }
 }
 
@@ -2852,7 +3502,7 @@ HWY_API void ScatterIndex(Vec128<T, N> v, Simd<T, N> d, T* HWY_RESTRICT base,
   Store(index, Simd<Index, N>(), index_lanes);
 
   for (size_t i = 0; i < N; ++i) {
-    base[index_lanes[i]] = lanes[i];
+    base[detail::ScatterGatherIndex(index_lanes[i])] = lanes[i];
   }
 }
 
@@ -2874,7 +3524,8 @@ HWY_API Vec128<T, N> GatherOffset(const Simd<T, N> d,
   alignas(16) T lanes[N];
   const uint8_t* base_bytes = reinterpret_cast<const uint8_t*>(base);
   for (size_t i = 0; i < N; ++i) {
-    CopyBytes<sizeof(T)>(base_bytes + offset_lanes[i], &lanes[i]);
+    CopyBytes<sizeof(T)>(
+        base_bytes + detail::ScatterGatherIndex(offset_lanes[i]), &lanes[i]);
   }
   return Load(d, lanes);
 }
@@ -2889,7 +3540,7 @@ HWY_API Vec128<T, N> GatherIndex(const Simd<T, N> d, const T* HWY_RESTRICT base,
 
   alignas(16) T lanes[N];
   for (size_t i = 0; i < N; ++i) {
-    lanes[i] = base[index_lanes[i]];
+    lanes[i] = base[detail::ScatterGatherIndex(index_lanes[i])];
   }
   return Load(d, lanes);
 }
@@ -2898,6 +3549,21 @@ HWY_API Vec128<T, N> GatherIndex(const Simd<T, N> d, const T* HWY_RESTRICT base,
 
 namespace detail {
 
+template <typename T, size_t N, size_t kLaneSize, typename Offset,
+          hwy::EnableIf<kLaneSize <= 2>* = nullptr>
+HWY_INLINE Vec128<T, N> GatherOffset(hwy::SizeTag<kLaneSize> /* tag */,
+                                     Simd<T, N> d, const T* HWY_RESTRICT base,
+                                     const Vec128<Offset, N> offset) {
+  return GatherOffsetEmu(d, base, offset);
+}
+template <typename T, size_t N, size_t kLaneSize, typename Index,
+          hwy::EnableIf<kLaneSize <= 2>* = nullptr>
+HWY_INLINE Vec128<T, N> GatherIndex(hwy::SizeTag<kLaneSize> /* tag */,
+                                    Simd<T, N> d, const T* HWY_RESTRICT base,
+                                    const Vec128<Index, N> index) {
+  return GatherIndexEmu(d, base, index);
+}
+
 template <typename T, size_t N>
 HWY_INLINE Vec128<T, N> GatherOffset(hwy::SizeTag<4> /* tag */,
                                      Simd<T, N> /* d */,
@@ -2971,6 +3637,98 @@ HWY_API Vec128<double, N> GatherIndex(Simd<double, N> /* tag */,
   return Vec128<double, N>{_mm_i64gather_pd(base, index.raw, 8)};
 }
 
+// ------------------------------ MaskedGatherIndex
+
+#ifdef HWY_NATIVE_MASKED_GATHER
+#undef HWY_NATIVE_MASKED_GATHER
+#else
+#define HWY_NATIVE_MASKED_GATHER
+#endif
+
+namespace detail {
+
+template <typename T, size_t N, size_t kLaneSize, typename Index,
+          hwy::EnableIf<kLaneSize <= 2>* = nullptr>
+HWY_INLINE Vec128<T, N> MaskedGatherIndex(hwy::SizeTag<kLaneSize> /* tag */,
+                                          Mask128<T, N> m, Simd<T, N> d,
+                                          const T* HWY_RESTRICT base,
+                                          const Vec128<Index, N> index) {
+  return MaskedGatherIndexEmu(m, d, base, index);
+}
+
+template <typename T, size_t N>
+HWY_INLINE Vec128<T, N> MaskedGatherIndex(hwy::SizeTag<4> /* tag */,
+                                          Mask128<T, N> m, Simd<T, N> d,
+                                          const T* HWY_RESTRICT base,
+                                          const Vec128<int32_t, N> index) {
+#if HWY_TARGET <= HWY_AVX3
+  return Vec128<T, N>{_mm_mmask_i32gather_epi32(Zero(d).raw, m.raw, index.raw,
+                                                base, 4)};
+#else
+  return Vec128<T, N>{
+      _mm_mask_i32gather_epi32(Zero(d).raw, reinterpret_cast<const int*>(base),
+                               index.raw, m.raw, 4)};
+#endif
+}
+
+template <typename T, size_t N>
+HWY_INLINE Vec128<T, N> MaskedGatherIndex(hwy::SizeTag<8> /* tag */,
+                                          Mask128<T, N> m, Simd<T, N> d,
+                                          const T* HWY_RESTRICT base,
+                                          const Vec128<int64_t, N> index) {
+#if HWY_TARGET <= HWY_AVX3
+  return Vec128<T, N>{_mm_mmask_i64gather_epi64(Zero(d).raw, m.raw, index.raw,
+                                                base, 8)};
+#else
+  return Vec128<T, N>{_mm_mask_i64gather_epi64(
+      Zero(d).raw, reinterpret_cast<const GatherIndex64*>(base), index.raw,
+      m.raw, 8)};
+#endif
+}
+
+}  // namespace detail
+
+// Lanes whose mask is false are zero and their indices are not accessed.
+template <typename T, size_t N, typename Index>
+HWY_API Vec128<T, N> MaskedGatherIndex(Mask128<T, N> m, Simd<T, N> d,
+                                       const T* HWY_RESTRICT base,
+                                       const Vec128<Index, N> index) {
+  static_assert(sizeof(T) == sizeof(Index), "Must match for portability");
+  return detail::MaskedGatherIndex(hwy::SizeTag<sizeof(T)>(),
+                                   detail::OnlyValidLanes(d, m), d, base,
+                                   index);
+}
+
+template <size_t N>
+HWY_API Vec128<float, N> MaskedGatherIndex(Mask128<float, N> m,
+                                           Simd<float, N> d,
+                                           const float* HWY_RESTRICT base,
+                                           const Vec128<int32_t, N> index) {
+  m = detail::OnlyValidLanes(d, m);
+#if HWY_TARGET <= HWY_AVX3
+  return Vec128<float, N>{
+      _mm_mmask_i32gather_ps(Zero(d).raw, m.raw, index.raw, base, 4)};
+#else
+  return Vec128<float, N>{
+      _mm_mask_i32gather_ps(Zero(d).raw, base, index.raw, m.raw, 4)};
+#endif
+}
+
+template <size_t N>
+HWY_API Vec128<double, N> MaskedGatherIndex(Mask128<double, N> m,
+                                            Simd<double, N> d,
+                                            const double* HWY_RESTRICT base,
+                                            const Vec128<int64_t, N> index) {
+  m = detail::OnlyValidLanes(d, m);
+#if HWY_TARGET <= HWY_AVX3
+  return Vec128<double, N>{
+      _mm_mmask_i64gather_pd(Zero(d).raw, m.raw, index.raw, base, 8)};
+#else
+  return Vec128<double, N>{
+      _mm_mask_i64gather_pd(Zero(d).raw, base, index.raw, m.raw, 8)};
+#endif
+}
+
 #endif  // HWY_TARGET == HWY_SSSE3 || HWY_TARGET == HWY_SSE4
 
 HWY_DIAGNOSTICS(pop)
@@ -3159,6 +3917,41 @@ HWY_API VI TableLookupBytesOr0(const V bytes, const VI from) {
   return TableLookupBytes(bytes, from);
 }
 
+// ------------------------------ TableLookupBytes64, TableLookupBytes128
+
+// vpermi2b requires VBMI; other targets use the generic pshufb+blend.
+#if HWY_TARGET == HWY_AVX3_DL
+
+#ifdef HWY_NATIVE_TABLE_LOOKUP_BYTES64
+#undef HWY_NATIVE_TABLE_LOOKUP_BYTES64
+#else
+#define HWY_NATIVE_TABLE_LOOKUP_BYTES64
+#endif
+
+// Each vpermi2b looks up a 32-byte table; bit 5 selects the upper half.
+template <typename T, size_t N, HWY_IF_LANE_SIZE(T, 1)>
+HWY_API Vec128<T, N> TableLookupBytes64(Simd<T, N> d,
+                                        const T* HWY_RESTRICT table,
+                                        const Vec128<T, N> idx) {
+  const Full128<T> d_full;
+  const Vec128<T, N> lower{_mm_permutex2var_epi8(
+      LoadU(d_full, table).raw, idx.raw, LoadU(d_full, table + 16).raw)};
+  const Vec128<T, N> upper{_mm_permutex2var_epi8(
+      LoadU(d_full, table + 32).raw, idx.raw, LoadU(d_full, table + 48).raw)};
+  return IfThenElse(TestBit(idx, Set(d, T{32})), upper, lower);
+}
+
+template <typename T, size_t N, HWY_IF_LANE_SIZE(T, 1)>
+HWY_API Vec128<T, N> TableLookupBytes128(Simd<T, N> d,
+                                         const T* HWY_RESTRICT table,
+                                         const Vec128<T, N> idx) {
+  const auto lower = TableLookupBytes64(d, table, idx);
+  const auto upper = TableLookupBytes64(d, table + 64, idx);
+  return IfThenElse(TestBit(idx, Set(d, T{64})), upper, lower);
+}
+
+#endif  // HWY_TARGET == HWY_AVX3_DL
+
 // ------------------------------ TableLookupLanes
 
 // Returned by SetTableIndices for use by TableLookupLanes.
@@ -3205,6 +3998,108 @@ HWY_API Vec128<float, N> TableLookupLanes(const Vec128<float, N> v,
                  TableLookupBytes(BitCast(di, v), Vec128<int32_t, N>{idx.raw}));
 }
 
+// ------------------------------ Reverse (Shuffle0123, Shuffle2301)
+
+namespace detail {
+
+// Returns TableLookupBytes indices that reverse each group of kGroup lanes of
+// kLaneBytes each, for every 128-bit block. Also used by x86_256/512. The loop
+// only involves constants and is folded into a vector constant.
+template <size_t kLaneBytes, size_t kGroup, class D8>
+HWY_INLINE VFromD<D8> ReverseIndices(D8 d8) {
+  static_assert(kLaneBytes * kGroup <= 16, "Group must not cross blocks");
+  alignas(16) uint8_t bytes[16];
+  for (size_t i = 0; i < 16; ++i) {
+    const size_t lane = i / kLaneBytes;
+    const size_t mirrored = lane - lane % kGroup + kGroup - 1 - lane % kGroup;
+    bytes[i] = static_cast<uint8_t>(mirrored * kLaneBytes + i % kLaneBytes);
+  }
+  return LoadDup128(d8, bytes);
+}
+
+// Reverses groups of kGroup lanes via byte shuffle.
+template <size_t kGroup, class D, class V>
+HWY_INLINE V ReverseGroupsViaBytes(D d, const V v) {
+  const Repartition<uint8_t, decltype(d)> d8;
+  const auto idx = ReverseIndices<sizeof(TFromD<D>), kGroup>(d8);
+  return BitCast(d, TableLookupBytes(BitCast(d8, v), idx));
+}
+
+}  // namespace detail
+
+// Single lane: no change
+template <typename T>
+HWY_API Vec128<T, 1> Reverse(Simd<T, 1> /* tag */, const Vec128<T, 1> v) {
+  return v;
+}
+
+// Two 32-bit lanes: swap
+template <typename T, HWY_IF_LANE_SIZE(T, 4)>
+HWY_API Vec128<T, 2> Reverse(Simd<T, 2> /* tag */, const Vec128<T, 2> v) {
+  return Vec128<T, 2>{Shuffle2301(Vec128<T>{v.raw}).raw};
+}
+
+template <typename T, HWY_IF_LANE_SIZE(T, 8)>
+HWY_API Vec128<T> Reverse(Full128<T> /* tag */, const Vec128<T> v) {
+  return Shuffle01(v);
+}
+
+template <typename T, HWY_IF_LANE_SIZE(T, 4)>
+HWY_API Vec128<T> Reverse(Full128<T> /* tag */, const Vec128<T> v) {
+  return Shuffle0123(v);
+}
+
+// 8/16-bit lanes: byte shuffle. Partial vectors reverse a group of N lanes.
+template <typename T, size_t N,
+          hwy::EnableIf<(N > 1 && sizeof(T) <= 2)>* = nullptr>
+HWY_API Vec128<T, N> Reverse(Simd<T, N> d, const Vec128<T, N> v) {
+  return detail::ReverseGroupsViaBytes<N>(d, v);
+}
+
+// ------------------------------ Reverse2
+
+template <typename T, size_t N, hwy::EnableIf<sizeof(T) <= 2>* = nullptr>
+HWY_API Vec128<T, N> Reverse2(Simd<T, N> d, const Vec128<T, N> v) {
+  return detail::ReverseGroupsViaBytes<2>(d, v);
+}
+
+template <typename T, size_t N, HWY_IF_LANE_SIZE(T, 4)>
+HWY_API Vec128<T, N> Reverse2(Simd<T, N> /* tag */, const Vec128<T, N> v) {
+  return Shuffle2301(v);
+}
+
+template <typename T, HWY_IF_LANE_SIZE(T, 8)>
+HWY_API Vec128<T> Reverse2(Full128<T> /* tag */, const Vec128<T> v) {
+  return Shuffle01(v);
+}
+
+// ------------------------------ Reverse4
+
+template <typename T, size_t N, hwy::EnableIf<sizeof(T) <= 2>* = nullptr>
+HWY_API Vec128<T, N> Reverse4(Simd<T, N> d, const Vec128<T, N> v) {
+  return detail::ReverseGroupsViaBytes<4>(d, v);
+}
+
+template <typename T, HWY_IF_LANE_SIZE(T, 4)>
+HWY_API Vec128<T> Reverse4(Full128<T> /* tag */, const Vec128<T> v) {
+  return Shuffle0123(v);
+}
+
+// ------------------------------ Reverse8
+
+template <typename T, size_t N, hwy::EnableIf<sizeof(T) <= 2>* = nullptr>
+HWY_API Vec128<T, N> Reverse8(Simd<T, N> d, const Vec128<T, N> v) {
+  return detail::ReverseGroupsViaBytes<8>(d, v);
+}
+
+// ------------------------------ ReverseBlocks
+
+// Single block: no change
+template <typename T, size_t N>
+HWY_API Vec128<T, N> ReverseBlocks(Simd<T, N> /* tag */, const Vec128<T, N> v) {
+  return v;
+}
+
 // ------------------------------ InterleaveLower
 
 // Interleaves lanes from halves of the 128-bit blocks of "a" (which provides
@@ -3540,6 +4435,68 @@ HWY_API Vec128<double, N> OddEven(const Vec128<double, N> a,
   return Vec128<double>{_mm_shuffle_pd(b.raw, a.raw, _MM_SHUFFLE2(1, 0))};
 }
 
+// ------------------------------ DupEven/DupOdd
+
+#ifdef HWY_NATIVE_DUP_EVEN_ODD
+#undef HWY_NATIVE_DUP_EVEN_ODD
+#else
+#define HWY_NATIVE_DUP_EVEN_ODD
+#endif
+
+template <typename T, size_t N, HWY_IF_LANE_SIZE(T, 4)>
+HWY_API Vec128<T, N> DupEven(const Vec128<T, N> v) {
+  return Vec128<T, N>{_mm_shuffle_epi32(v.raw, _MM_SHUFFLE(2, 2, 0, 0))};
+}
+template <size_t N>
+HWY_API Vec128<float, N> DupEven(const Vec128<float, N> v) {
+  return Vec128<float, N>{_mm_moveldup_ps(v.raw)};
+}
+template <typename T, size_t N, HWY_IF_LANE_SIZE(T, 8)>
+HWY_API Vec128<T, N> DupEven(const Vec128<T, N> v) {
+  return Vec128<T, N>{_mm_unpacklo_epi64(v.raw, v.raw)};
+}
+template <size_t N>
+HWY_API Vec128<double, N> DupEven(const Vec128<double, N> v) {
+  return Vec128<double, N>{_mm_movedup_pd(v.raw)};
+}
+
+template <typename T, size_t N, HWY_IF_LANE_SIZE(T, 4)>
+HWY_API Vec128<T, N> DupOdd(const Vec128<T, N> v) {
+  return Vec128<T, N>{_mm_shuffle_epi32(v.raw, _MM_SHUFFLE(3, 3, 1, 1))};
+}
+template <size_t N>
+HWY_API Vec128<float, N> DupOdd(const Vec128<float, N> v) {
+  return Vec128<float, N>{_mm_movehdup_ps(v.raw)};
+}
+template <typename T, size_t N, HWY_IF_LANE_SIZE(T, 8)>
+HWY_API Vec128<T, N> DupOdd(const Vec128<T, N> v) {
+  return Vec128<T, N>{_mm_unpackhi_epi64(v.raw, v.raw)};
+}
+template <size_t N>
+HWY_API Vec128<double, N> DupOdd(const Vec128<double, N> v) {
+  return Vec128<double, N>{_mm_unpackhi_pd(v.raw, v.raw)};
+}
+
+// ------------------------------ AddSub
+
+#ifdef HWY_NATIVE_ADDSUB
+#undef HWY_NATIVE_ADDSUB
+#else
+#define HWY_NATIVE_ADDSUB
+#endif
+
+// Even lanes: a - b; odd lanes: a + b.
+template <size_t N>
+HWY_API Vec128<float, N> AddSub(const Vec128<float, N> a,
+                                const Vec128<float, N> b) {
+  return Vec128<float, N>{_mm_addsub_ps(a.raw, b.raw)};
+}
+template <size_t N>
+HWY_API Vec128<double, N> AddSub(const Vec128<double, N> a,
+                                 const Vec128<double, N> b) {
+  return Vec128<double, N>{_mm_addsub_pd(a.raw, b.raw)};
+}
+
 // ------------------------------ Shl (ZipLower, Mul)
 
 // Use AVX2/3 variable shifts where available, otherwise multiply by powers of
@@ -3779,6 +4736,154 @@ HWY_INLINE Vec128<uint64_t> MulOdd(const Vec128<uint64_t> a,
   return Load(Full128<uint64_t>(), mul);
 }
 
+// ------------------------------ MulOdd 32x32 (MulEven)
+
+// Multiplies odd lanes (1, 3 ..) and places the double-wide result into even
+// and the upper half into its odd neighbor lane.
+template <size_t N>
+HWY_API Vec128<uint64_t, (N + 1) / 2> MulOdd(const Vec128<uint32_t, N> a,
+                                             const Vec128<uint32_t, N> b) {
+  const Vec128<uint32_t, N> a_x3x1{
+      _mm_shuffle_epi32(a.raw, _MM_SHUFFLE(3, 3, 1, 1))};
+  const Vec128<uint32_t, N> b_x3x1{
+      _mm_shuffle_epi32(b.raw, _MM_SHUFFLE(3, 3, 1, 1))};
+  return MulEven(a_x3x1, b_x3x1);
+}
+template <size_t N>
+HWY_API Vec128<int64_t, (N + 1) / 2> MulOdd(const Vec128<int32_t, N> a,
+                                            const Vec128<int32_t, N> b) {
+  const Vec128<int32_t, N> a_x3x1{
+      _mm_shuffle_epi32(a.raw, _MM_SHUFFLE(3, 3, 1, 1))};
+  const Vec128<int32_t, N> b_x3x1{
+      _mm_shuffle_epi32(b.raw, _MM_SHUFFLE(3, 3, 1, 1))};
+  return MulEven(a_x3x1, b_x3x1);
+}
+
+// ------------------------------ MulHigh 32-bit (MulEven, MulOdd, OddEven)
+
+namespace detail {
+
+// There is no 32-bit mulhi, so combine the upper halves of the even and odd
+// double-wide products. Also used by x86_256 and x86_512.
+template <class V>  // u32 or i32
+HWY_INLINE V MulHigh32(const V a, const V b) {
+  const DFromV<V> d;
+  const RepartitionToWide<RebindToUnsigned<decltype(d)>> dw;
+  const auto hi_even = ShiftRight<32>(BitCast(dw, MulEven(a, b)));
+  const auto odd = BitCast(d, MulOdd(a, b));
+  return OddEven(odd, BitCast(d, hi_even));
+}
+
+}  // namespace detail
+
+// Returns the upper 32 bits of a * b in each lane.
+template <size_t N>
+HWY_API Vec128<uint32_t, N> MulHigh(const Vec128<uint32_t, N> a,
+                                    const Vec128<uint32_t, N> b) {
+  // Also computes the unused upper lanes of partial vectors, whose MulEven
+  // would otherwise have fewer bytes.
+  const Vec128<uint32_t> hi =
+      detail::MulHigh32(Vec128<uint32_t>{a.raw}, Vec128<uint32_t>{b.raw});
+  return Vec128<uint32_t, N>{hi.raw};
+}
+template <size_t N>
+HWY_API Vec128<int32_t, N> MulHigh(const Vec128<int32_t, N> a,
+                                   const Vec128<int32_t, N> b) {
+  // Also computes the unused upper lanes of partial vectors, whose MulEven
+  // would otherwise have fewer bytes.
+  const Vec128<int32_t> hi =
+      detail::MulHigh32(Vec128<int32_t>{a.raw}, Vec128<int32_t>{b.raw});
+  return Vec128<int32_t, N>{hi.raw};
+}
+
+// ------------------------------ Mul/MulHigh 64-bit (MulEven)
+
+namespace detail {
+
+// Returns the lower 64 bits of a * b. Only the cross terms aH*bL and aL*bH
+// contribute to the upper 32 bits, so three 32x32=64 MulEven suffice.
+// Also used by x86_256.
+template <class V>  // u64
+HWY_INLINE V MulLower64(const V a, const V b) {
+  const DFromV<V> du64;
+  const RepartitionToNarrow<decltype(du64)> du32;
+  const auto a32 = BitCast(du32, a);
+  const auto b32 = BitCast(du32, b);
+  // Inputs for MulEven: we only need the lower 32 bits of each u64.
+  const auto aH = BitCast(du32, ShiftRight<32>(a));
+  const auto bH = BitCast(du32, ShiftRight<32>(b));
+  const auto aLbL = MulEven(a32, b32);
+  const auto cross = MulEven(aH, b32) + MulEven(a32, bH);
+  return aLbL + ShiftLeft<32>(cross);
+}
+
+// Returns the upper 64 bits of a * b via Knuth double-word multiplication, see
+// https://github.com/hcs0/Hackers-Delight/blob/master/muldwu.c.txt. Variable
+// names match that code, with 32-bit halves instead of 16-bit. Also used by
+// x86_256 and x86_512.
+template <class V>  // u64
+HWY_INLINE V MulHigh64(const V a, const V b) {
+  const DFromV<V> du64;
+  const RepartitionToNarrow<decltype(du64)> du32;
+  const auto maskL = Set(du64, 0xFFFFFFFFULL);
+  const auto a32 = BitCast(du32, a);
+  const auto b32 = BitCast(du32, b);
+  const auto aH = BitCast(du32, ShiftRight<32>(a));
+  const auto bH = BitCast(du32, ShiftRight<32>(b));
+
+  const auto w0 = MulEven(a32, b32);
+  const auto t = MulEven(aH, b32) + ShiftRight<32>(w0);
+  const auto w1 = t & maskL;
+  const auto w2 = ShiftRight<32>(t);
+  // The reference overwrites w1 with this sum.
+  const auto k = ShiftRight<32>(MulEven(a32, bH) + w1);
+  return MulEven(aH, bH) + w2 + k;
+}
+
+// The signed upper half differs from the unsigned one by subtracting the other
+// operand wherever an input is negative (its sign bit has weight -2^64).
+template <class V>  // i64
+HWY_INLINE V MulHighSigned64(const V a, const V b) {
+  const DFromV<V> di64;
+  const RebindToUnsigned<decltype(di64)> du64;
+  const auto hi = BitCast(di64, MulHigh64(BitCast(du64, a), BitCast(du64, b)));
+  const auto a_neg_b = And(BroadcastSignBit(a), b);
+  const auto b_neg_a = And(BroadcastSignBit(b), a);
+  return hi - a_neg_b - b_neg_a;
+}
+
+}  // namespace detail
+
+template <size_t N>
+HWY_API Vec128<uint64_t, N> operator*(const Vec128<uint64_t, N> a,
+                                      const Vec128<uint64_t, N> b) {
+#if HWY_TARGET <= HWY_AVX3
+  return Vec128<uint64_t, N>{_mm_mullo_epi64(a.raw, b.raw)};
+#else
+  return detail::MulLower64(a, b);
+#endif
+}
+
+template <size_t N>
+HWY_API Vec128<int64_t, N> operator*(const Vec128<int64_t, N> a,
+                                     const Vec128<int64_t, N> b) {
+  // Same as unsigned.
+  const Simd<uint64_t, N> du;
+  return BitCast(Simd<int64_t, N>(), BitCast(du, a) * BitCast(du, b));
+}
+
+// Returns the upper 64 bits of a * b in each lane.
+template <size_t N>
+HWY_API Vec128<uint64_t, N> MulHigh(const Vec128<uint64_t, N> a,
+                                    const Vec128<uint64_t, N> b) {
+  return detail::MulHigh64(a, b);
+}
+template <size_t N>
+HWY_API Vec128<int64_t, N> MulHigh(const Vec128<int64_t, N> a,
+                                   const Vec128<int64_t, N> b) {
+  return detail::MulHighSigned64(a, b);
+}
+
 // ================================================== CONVERT
 
 // ------------------------------ Promotions (part w/ narrow lanes -> full)
@@ -4021,6 +5126,51 @@ HWY_API Vec128<float, N> DemoteTo(Simd<float, N> /* tag */,
   return Vec128<float, N>{_mm_cvtpd_ps(v.raw)};
 }
 
+// ------------------------------ ReorderDemote2To
+
+// For 128-bit vectors, the lane order is already preserved.
+HWY_API Vec128<int16_t> ReorderDemote2To(Full128<int16_t> /* tag */,
+                                         Vec128<int32_t> a, Vec128<int32_t> b) {
+  return Vec128<int16_t>{_mm_packs_epi32(a.raw, b.raw)};
+}
+
+HWY_API Vec128<uint16_t> ReorderDemote2To(Full128<uint16_t> dn,
+                                          Vec128<int32_t> a,
+                                          Vec128<int32_t> b) {
+#if HWY_TARGET == HWY_SSSE3
+  const Half<decltype(dn)> dnh;
+  return Combine(dn, DemoteTo(dnh, b), DemoteTo(dnh, a));
+#else
+  (void)dn;
+  return Vec128<uint16_t>{_mm_packus_epi32(a.raw, b.raw)};
+#endif
+}
+
+HWY_API Vec128<uint8_t> ReorderDemote2To(Full128<uint8_t> /* tag */,
+                                         Vec128<int16_t> a, Vec128<int16_t> b) {
+  return Vec128<uint8_t>{_mm_packus_epi16(a.raw, b.raw)};
+}
+
+HWY_API Vec128<int8_t> ReorderDemote2To(Full128<int8_t> /* tag */,
+                                        Vec128<int16_t> a, Vec128<int16_t> b) {
+  return Vec128<int8_t>{_mm_packs_epi16(a.raw, b.raw)};
+}
+
+// Partial: first concatenate the inputs into one vector, then demote that.
+template <typename TN, size_t N, typename TW, HWY_IF_LE64(TN, N)>
+HWY_API Vec128<TN, N> ReorderDemote2To(Simd<TN, N> dn, Vec128<TW, N / 2> a,
+                                       Vec128<TW, N / 2> b) {
+  return DemoteTo(dn, Combine(Simd<TW, N>(), b, a));
+}
+
+// ------------------------------ OrderedDemote2To
+
+template <typename TN, size_t N, typename TW>
+HWY_API Vec128<TN, N> OrderedDemote2To(Simd<TN, N> dn, Vec128<TW, N / 2> a,
+                                       Vec128<TW, N / 2> b) {
+  return ReorderDemote2To(dn, a, b);
+}
+
 namespace detail {
 
 // For well-defined float->int demotion in all x86_*-inl.h.
@@ -4300,6 +5450,74 @@ HWY_API Vec128<double, N> Floor(const Vec128<double, N> v) {
 
 #endif  // !HWY_SSSE3
 
+// ------------------------------ Floating-point classification
+
+// AVX3 classifies and scales with single instructions; other targets use the
+// generic versions based on integer comparisons and exponent arithmetic.
+#if HWY_TARGET <= HWY_AVX3
+
+#ifdef HWY_NATIVE_FLOAT_CLASSIFY
+#undef HWY_NATIVE_FLOAT_CLASSIFY
+#else
+#define HWY_NATIVE_FLOAT_CLASSIFY
+#endif
+
+// fpclass categories: 0x01 QNaN, 0x08 +Inf, 0x10 -Inf, 0x80 SNaN.
+template <size_t N>
+HWY_API Mask128<float, N> IsNaN(const Vec128<float, N> v) {
+  return Mask128<float, N>{_mm_fpclass_ps_mask(v.raw, 0x81)};
+}
+template <size_t N>
+HWY_API Mask128<double, N> IsNaN(const Vec128<double, N> v) {
+  return Mask128<double, N>{_mm_fpclass_pd_mask(v.raw, 0x81)};
+}
+
+template <size_t N>
+HWY_API Mask128<float, N> IsInf(const Vec128<float, N> v) {
+  return Mask128<float, N>{_mm_fpclass_ps_mask(v.raw, 0x18)};
+}
+template <size_t N>
+HWY_API Mask128<double, N> IsInf(const Vec128<double, N> v) {
+  return Mask128<double, N>{_mm_fpclass_pd_mask(v.raw, 0x18)};
+}
+
+// Neither NaN nor infinity.
+template <size_t N>
+HWY_API Mask128<float, N> IsFinite(const Vec128<float, N> v) {
+  return Not(Mask128<float, N>{_mm_fpclass_ps_mask(v.raw, 0x99)});
+}
+template <size_t N>
+HWY_API Mask128<double, N> IsFinite(const Vec128<double, N> v) {
+  return Not(Mask128<double, N>{_mm_fpclass_pd_mask(v.raw, 0x99)});
+}
+
+// ------------------------------ GetExponent
+
+template <size_t N>
+HWY_API Vec128<float, N> GetExponent(const Vec128<float, N> v) {
+  return Vec128<float, N>{_mm_getexp_ps(v.raw)};
+}
+template <size_t N>
+HWY_API Vec128<double, N> GetExponent(const Vec128<double, N> v) {
+  return Vec128<double, N>{_mm_getexp_pd(v.raw)};
+}
+
+// ------------------------------ LdExp
+
+// scalef takes the exponent as a float; integer-valued inputs are exact.
+template <size_t N>
+HWY_API Vec128<float, N> LdExp(const Vec128<float, N> v,
+                               const Vec128<int32_t, N> e) {
+  return Vec128<float, N>{_mm_scalef_ps(v.raw, _mm_cvtepi32_ps(e.raw))};
+}
+template <size_t N>
+HWY_API Vec128<double, N> LdExp(const Vec128<double, N> v,
+                                const Vec128<int64_t, N> e) {
+  return Vec128<double, N>{_mm_scalef_pd(v.raw, _mm_cvtepi64_pd(e.raw))};
+}
+
+#endif  // HWY_TARGET <= HWY_AVX3
+
 // ================================================== CRYPTO
 
 #if !defined(HWY_DISABLE_PCLMUL_AES) && HWY_TARGET != HWY_SSSE3
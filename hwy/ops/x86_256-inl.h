@@ -1363,6 +1363,48 @@ HWY_API Vec256<double> operator-(const Vec256<double> a,
   return Vec256<double>{_mm256_sub_pd(a.raw, b.raw)};
 }
 
+// ------------------------------ SumsOf8
+HWY_API Vec256<uint64_t> SumsOf8(const Vec256<uint8_t> v) {
+  return Vec256<uint64_t>{_mm256_sad_epu8(v.raw, _mm256_setzero_si256())};
+}
+
+// ------------------------------ SumsOfAbsDiff
+HWY_API Vec256<uint64_t> SumsOfAbsDiff(const Vec256<uint8_t> a,
+                                       const Vec256<uint8_t> b) {
+  return Vec256<uint64_t>{_mm256_sad_epu8(a.raw, b.raw)};
+}
+
+// ------------------------------ SumsOf2
+
+HWY_API Vec256<uint16_t> SumsOf2(const Vec256<uint8_t> v) {
+  return Vec256<uint16_t>{_mm256_maddubs_epi16(v.raw, _mm256_set1_epi8(1))};
+}
+
+HWY_API Vec256<int16_t> SumsOf2(const Vec256<int8_t> v) {
+  // maddubs treats its first argument as unsigned and the second as signed.
+  return Vec256<int16_t>{_mm256_maddubs_epi16(_mm256_set1_epi8(1), v.raw)};
+}
+
+HWY_API Vec256<uint32_t> SumsOf2(const Vec256<uint16_t> v) {
+  // madd is signed: bias the inputs by -0x8000 and the sum by 2 * 0x8000.
+  const __m256i biased = _mm256_xor_si256(v.raw, _mm256_set1_epi16(-0x8000));
+  const __m256i sums = _mm256_madd_epi16(biased, _mm256_set1_epi16(1));
+  return Vec256<uint32_t>{_mm256_add_epi32(sums, _mm256_set1_epi32(0x10000))};
+}
+
+HWY_API Vec256<int32_t> SumsOf2(const Vec256<int16_t> v) {
+  return Vec256<int32_t>{_mm256_madd_epi16(v.raw, _mm256_set1_epi16(1))};
+}
+
+HWY_API Vec256<double> SumsOf2(const Vec256<float> v) {
+  // Move the even lanes to the lower block and the odd lanes to the upper.
+  const __m256i idx = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+  const __m256 split = _mm256_permutevar8x32_ps(v.raw, idx);
+  const __m256d even = _mm256_cvtps_pd(_mm256_castps256_ps128(split));
+  const __m256d odd = _mm256_cvtps_pd(_mm256_extractf128_ps(split, 1));
+  return Vec256<double>{_mm256_add_pd(even, odd)};
+}
+
 // ------------------------------ Saturating addition
 
 // Returns a + b clamped to the destination range.
@@ -1486,6 +1528,11 @@ HWY_API Vec256<int16_t> MulHigh(const Vec256<int16_t> a,
   return Vec256<int16_t>{_mm256_mulhi_epi16(a.raw, b.raw)};
 }
 
+HWY_API Vec256<int16_t> MulFixedPoint15(const Vec256<int16_t> a,
+                                        const Vec256<int16_t> b) {
+  return Vec256<int16_t>{_mm256_mulhrs_epi16(a.raw, b.raw)};
+}
+
 // Multiplies even lanes (0, 2 ..) and places the double-wide result into
 // even and the upper half into its odd neighbor lane.
 HWY_API Vec256<int64_t> MulEven(const Vec256<int32_t> a,
@@ -1717,6 +1764,60 @@ HWY_API Vec256<int8_t> ShiftRightSame(Vec256<int8_t> v, const int bits) {
   return (shifted ^ shifted_sign) - shifted_sign;
 }
 
+#if HWY_TARGET <= HWY_AVX3
+
+// ------------------------------ RotateRight (ShiftRight, ShiftLeft)
+
+template <int kBits, typename T, hwy::EnableIf<sizeof(T) <= 2>* = nullptr>
+HWY_API Vec256<T> RotateRight(const Vec256<T> v) {
+  return detail::RotateRightViaShifts<kBits>(v);
+}
+
+template <int kBits>
+HWY_API Vec256<uint32_t> RotateRight(const Vec256<uint32_t> v) {
+  static_assert(0 <= kBits && kBits < 32, "Invalid shift count");
+  return Vec256<uint32_t>{_mm256_ror_epi32(v.raw, kBits)};
+}
+template <int kBits>
+HWY_API Vec256<int32_t> RotateRight(const Vec256<int32_t> v) {
+  static_assert(0 <= kBits && kBits < 32, "Invalid shift count");
+  return Vec256<int32_t>{_mm256_ror_epi32(v.raw, kBits)};
+}
+template <int kBits>
+HWY_API Vec256<uint64_t> RotateRight(const Vec256<uint64_t> v) {
+  static_assert(0 <= kBits && kBits < 64, "Invalid shift count");
+  return Vec256<uint64_t>{_mm256_ror_epi64(v.raw, kBits)};
+}
+template <int kBits>
+HWY_API Vec256<int64_t> RotateRight(const Vec256<int64_t> v) {
+  static_assert(0 <= kBits && kBits < 64, "Invalid shift count");
+  return Vec256<int64_t>{_mm256_ror_epi64(v.raw, kBits)};
+}
+
+// ------------------------------ LeadingZeroCount (ShiftLeft, Min)
+
+HWY_API Vec256<uint32_t> LeadingZeroCount(const Vec256<uint32_t> v) {
+  return Vec256<uint32_t>{_mm256_lzcnt_epi32(v.raw)};
+}
+HWY_API Vec256<int32_t> LeadingZeroCount(const Vec256<int32_t> v) {
+  return Vec256<int32_t>{_mm256_lzcnt_epi32(v.raw)};
+}
+HWY_API Vec256<uint64_t> LeadingZeroCount(const Vec256<uint64_t> v) {
+  return Vec256<uint64_t>{_mm256_lzcnt_epi64(v.raw)};
+}
+HWY_API Vec256<int64_t> LeadingZeroCount(const Vec256<int64_t> v) {
+  return Vec256<int64_t>{_mm256_lzcnt_epi64(v.raw)};
+}
+
+template <typename T, hwy::EnableIf<sizeof(T) <= 2>* = nullptr>
+HWY_API Vec256<T> LeadingZeroCount(const Vec256<T> v) {
+  const Full256<MakeUnsigned<T>> du;
+  return BitCast(Full256<T>(),
+                 detail::LeadingZeroCountViaWide(BitCast(du, v)));
+}
+
+#endif  // HWY_TARGET <= HWY_AVX3
+
 // ------------------------------ Neg (Xor, Sub)
 
 template <typename T, HWY_IF_FLOAT(T)>
@@ -1890,6 +1991,252 @@ HWY_API Vec256<double> Floor(const Vec256<double> v) {
       _mm256_round_pd(v.raw, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC)};
 }
 
+// ------------------------------ Floating-point classification
+
+#if HWY_TARGET <= HWY_AVX3
+
+HWY_API Mask256<float> IsNaN(const Vec256<float> v) {
+  return Mask256<float>{_mm256_fpclass_ps_mask(v.raw, 0x81)};
+}
+HWY_API Mask256<double> IsNaN(const Vec256<double> v) {
+  return Mask256<double>{_mm256_fpclass_pd_mask(v.raw, 0x81)};
+}
+
+HWY_API Mask256<float> IsInf(const Vec256<float> v) {
+  return Mask256<float>{_mm256_fpclass_ps_mask(v.raw, 0x18)};
+}
+HWY_API Mask256<double> IsInf(const Vec256<double> v) {
+  return Mask256<double>{_mm256_fpclass_pd_mask(v.raw, 0x18)};
+}
+
+HWY_API Mask256<float> IsFinite(const Vec256<float> v) {
+  return Not(Mask256<float>{_mm256_fpclass_ps_mask(v.raw, 0x99)});
+}
+HWY_API Mask256<double> IsFinite(const Vec256<double> v) {
+  return Not(Mask256<double>{_mm256_fpclass_pd_mask(v.raw, 0x99)});
+}
+
+// ------------------------------ GetExponent
+
+HWY_API Vec256<float> GetExponent(const Vec256<float> v) {
+  return Vec256<float>{_mm256_getexp_ps(v.raw)};
+}
+HWY_API Vec256<double> GetExponent(const Vec256<double> v) {
+  return Vec256<double>{_mm256_getexp_pd(v.raw)};
+}
+
+// ------------------------------ LdExp
+
+HWY_API Vec256<float> LdExp(const Vec256<float> v, const Vec256<int32_t> e) {
+  return Vec256<float>{_mm256_scalef_ps(v.raw, _mm256_cvtepi32_ps(e.raw))};
+}
+HWY_API Vec256<double> LdExp(const Vec256<double> v, const Vec256<int64_t> e) {
+  return Vec256<double>{_mm256_scalef_pd(v.raw, _mm256_cvtepi64_pd(e.raw))};
+}
+
+#endif  // HWY_TARGET <= HWY_AVX3
+
+// ------------------------------ Masked arithmetic
+
+#if HWY_TARGET <= HWY_AVX3
+
+namespace detail {
+
+template <typename T>
+HWY_INLINE Vec256<T> MaskedAddOr(hwy::SizeTag<1> /* tag */, Vec256<T> no,
+                                 Mask256<T> m, Vec256<T> a, Vec256<T> b) {
+  return Vec256<T>{_mm256_mask_add_epi8(no.raw, m.raw, a.raw, b.raw)};
+}
+template <typename T>
+HWY_INLINE Vec256<T> MaskedAddOr(hwy::SizeTag<2> /* tag */, Vec256<T> no,
+                                 Mask256<T> m, Vec256<T> a, Vec256<T> b) {
+  return Vec256<T>{_mm256_mask_add_epi16(no.raw, m.raw, a.raw, b.raw)};
+}
+template <typename T>
+HWY_INLINE Vec256<T> MaskedAddOr(hwy::SizeTag<4> /* tag */, Vec256<T> no,
+                                 Mask256<T> m, Vec256<T> a, Vec256<T> b) {
+  return Vec256<T>{_mm256_mask_add_epi32(no.raw, m.raw, a.raw, b.raw)};
+}
+template <typename T>
+HWY_INLINE Vec256<T> MaskedAddOr(hwy::SizeTag<8> /* tag */, Vec256<T> no,
+                                 Mask256<T> m, Vec256<T> a, Vec256<T> b) {
+  return Vec256<T>{_mm256_mask_add_epi64(no.raw, m.raw, a.raw, b.raw)};
+}
+
+template <typename T>
+HWY_INLINE Vec256<T> MaskedSubOr(hwy::SizeTag<1> /* tag */, Vec256<T> no,
+                                 Mask256<T> m, Vec256<T> a, Vec256<T> b) {
+  return Vec256<T>{_mm256_mask_sub_epi8(no.raw, m.raw, a.raw, b.raw)};
+}
+template <typename T>
+HWY_INLINE Vec256<T> MaskedSubOr(hwy::SizeTag<2> /* tag */, Vec256<T> no,
+                                 Mask256<T> m, Vec256<T> a, Vec256<T> b) {
+  return Vec256<T>{_mm256_mask_sub_epi16(no.raw, m.raw, a.raw, b.raw)};
+}
+template <typename T>
+HWY_INLINE Vec256<T> MaskedSubOr(hwy::SizeTag<4> /* tag */, Vec256<T> no,
+                                 Mask256<T> m, Vec256<T> a, Vec256<T> b) {
+  return Vec256<T>{_mm256_mask_sub_epi32(no.raw, m.raw, a.raw, b.raw)};
+}
+template <typename T>
+HWY_INLINE Vec256<T> MaskedSubOr(hwy::SizeTag<8> /* tag */, Vec256<T> no,
+                                 Mask256<T> m, Vec256<T> a, Vec256<T> b) {
+  return Vec256<T>{_mm256_mask_sub_epi64(no.raw, m.raw, a.raw, b.raw)};
+}
+
+template <typename T>
+HWY_INLINE Vec256<T> MaskedMulOr(hwy::SizeTag<2> /* tag */, Vec256<T> no,
+                                 Mask256<T> m, Vec256<T> a, Vec256<T> b) {
+  return Vec256<T>{_mm256_mask_mullo_epi16(no.raw, m.raw, a.raw, b.raw)};
+}
+template <typename T>
+HWY_INLINE Vec256<T> MaskedMulOr(hwy::SizeTag<4> /* tag */, Vec256<T> no,
+                                 Mask256<T> m, Vec256<T> a, Vec256<T> b) {
+  return Vec256<T>{_mm256_mask_mullo_epi32(no.raw, m.raw, a.raw, b.raw)};
+}
+template <typename T>
+HWY_INLINE Vec256<T> MaskedMulOr(hwy::SizeTag<8> /* tag */, Vec256<T> no,
+                                 Mask256<T> m, Vec256<T> a, Vec256<T> b) {
+  return Vec256<T>{_mm256_mask_mullo_epi64(no.raw, m.raw, a.raw, b.raw)};
+}
+
+}  // namespace detail
+
+template <typename T>
+HWY_API Vec256<T> MaskedAddOr(Vec256<T> no, Mask256<T> m, Vec256<T> a,
+                              Vec256<T> b) {
+  return detail::MaskedAddOr(hwy::SizeTag<sizeof(T)>(), no, m, a, b);
+}
+HWY_API Vec256<float> MaskedAddOr(Vec256<float> no, Mask256<float> m,
+                                  Vec256<float> a, Vec256<float> b) {
+  return Vec256<float>{_mm256_mask_add_ps(no.raw, m.raw, a.raw, b.raw)};
+}
+HWY_API Vec256<double> MaskedAddOr(Vec256<double> no, Mask256<double> m,
+                                   Vec256<double> a, Vec256<double> b) {
+  return Vec256<double>{_mm256_mask_add_pd(no.raw, m.raw, a.raw, b.raw)};
+}
+
+template <typename T>
+HWY_API Vec256<T> MaskedSubOr(Vec256<T> no, Mask256<T> m, Vec256<T> a,
+                              Vec256<T> b) {
+  return detail::MaskedSubOr(hwy::SizeTag<sizeof(T)>(), no, m, a, b);
+}
+HWY_API Vec256<float> MaskedSubOr(Vec256<float> no, Mask256<float> m,
+                                  Vec256<float> a, Vec256<float> b) {
+  return Vec256<float>{_mm256_mask_sub_ps(no.raw, m.raw, a.raw, b.raw)};
+}
+HWY_API Vec256<double> MaskedSubOr(Vec256<double> no, Mask256<double> m,
+                                   Vec256<double> a, Vec256<double> b) {
+  return Vec256<double>{_mm256_mask_sub_pd(no.raw, m.raw, a.raw, b.raw)};
+}
+
+template <typename T>
+HWY_API Vec256<T> MaskedMulOr(Vec256<T> no, Mask256<T> m, Vec256<T> a,
+                              Vec256<T> b) {
+  return detail::MaskedMulOr(hwy::SizeTag<sizeof(T)>(), no, m, a, b);
+}
+HWY_API Vec256<float> MaskedMulOr(Vec256<float> no, Mask256<float> m,
+                                  Vec256<float> a, Vec256<float> b) {
+  return Vec256<float>{_mm256_mask_mul_ps(no.raw, m.raw, a.raw, b.raw)};
+}
+HWY_API Vec256<double> MaskedMulOr(Vec256<double> no, Mask256<double> m,
+                                   Vec256<double> a, Vec256<double> b) {
+  return Vec256<double>{_mm256_mask_mul_pd(no.raw, m.raw, a.raw, b.raw)};
+}
+
+HWY_API Vec256<float> MaskedDivOr(Vec256<float> no, Mask256<float> m,
+                                  Vec256<float> a, Vec256<float> b) {
+  return Vec256<float>{_mm256_mask_div_ps(no.raw, m.raw, a.raw, b.raw)};
+}
+HWY_API Vec256<double> MaskedDivOr(Vec256<double> no, Mask256<double> m,
+                                   Vec256<double> a, Vec256<double> b) {
+  return Vec256<double>{_mm256_mask_div_pd(no.raw, m.raw, a.raw, b.raw)};
+}
+
+HWY_API Vec256<uint8_t> MaskedMinOr(Vec256<uint8_t> no, Mask256<uint8_t> m,
+                                    Vec256<uint8_t> a, Vec256<uint8_t> b) {
+  return Vec256<uint8_t>{_mm256_mask_min_epu8(no.raw, m.raw, a.raw, b.raw)};
+}
+HWY_API Vec256<int8_t> MaskedMinOr(Vec256<int8_t> no, Mask256<int8_t> m,
+                                   Vec256<int8_t> a, Vec256<int8_t> b) {
+  return Vec256<int8_t>{_mm256_mask_min_epi8(no.raw, m.raw, a.raw, b.raw)};
+}
+HWY_API Vec256<uint16_t> MaskedMinOr(Vec256<uint16_t> no, Mask256<uint16_t> m,
+                                     Vec256<uint16_t> a, Vec256<uint16_t> b) {
+  return Vec256<uint16_t>{_mm256_mask_min_epu16(no.raw, m.raw, a.raw, b.raw)};
+}
+HWY_API Vec256<int16_t> MaskedMinOr(Vec256<int16_t> no, Mask256<int16_t> m,
+                                    Vec256<int16_t> a, Vec256<int16_t> b) {
+  return Vec256<int16_t>{_mm256_mask_min_epi16(no.raw, m.raw, a.raw, b.raw)};
+}
+HWY_API Vec256<uint32_t> MaskedMinOr(Vec256<uint32_t> no, Mask256<uint32_t> m,
+                                     Vec256<uint32_t> a, Vec256<uint32_t> b) {
+  return Vec256<uint32_t>{_mm256_mask_min_epu32(no.raw, m.raw, a.raw, b.raw)};
+}
+HWY_API Vec256<int32_t> MaskedMinOr(Vec256<int32_t> no, Mask256<int32_t> m,
+                                    Vec256<int32_t> a, Vec256<int32_t> b) {
+  return Vec256<int32_t>{_mm256_mask_min_epi32(no.raw, m.raw, a.raw, b.raw)};
+}
+HWY_API Vec256<uint64_t> MaskedMinOr(Vec256<uint64_t> no, Mask256<uint64_t> m,
+                                     Vec256<uint64_t> a, Vec256<uint64_t> b) {
+  return Vec256<uint64_t>{_mm256_mask_min_epu64(no.raw, m.raw, a.raw, b.raw)};
+}
+HWY_API Vec256<int64_t> MaskedMinOr(Vec256<int64_t> no, Mask256<int64_t> m,
+                                    Vec256<int64_t> a, Vec256<int64_t> b) {
+  return Vec256<int64_t>{_mm256_mask_min_epi64(no.raw, m.raw, a.raw, b.raw)};
+}
+HWY_API Vec256<float> MaskedMinOr(Vec256<float> no, Mask256<float> m,
+                                  Vec256<float> a, Vec256<float> b) {
+  return Vec256<float>{_mm256_mask_min_ps(no.raw, m.raw, a.raw, b.raw)};
+}
+HWY_API Vec256<double> MaskedMinOr(Vec256<double> no, Mask256<double> m,
+                                   Vec256<double> a, Vec256<double> b) {
+  return Vec256<double>{_mm256_mask_min_pd(no.raw, m.raw, a.raw, b.raw)};
+}
+
+HWY_API Vec256<uint8_t> MaskedMaxOr(Vec256<uint8_t> no, Mask256<uint8_t> m,
+                                    Vec256<uint8_t> a, Vec256<uint8_t> b) {
+  return Vec256<uint8_t>{_mm256_mask_max_epu8(no.raw, m.raw, a.raw, b.raw)};
+}
+HWY_API Vec256<int8_t> MaskedMaxOr(Vec256<int8_t> no, Mask256<int8_t> m,
+                                   Vec256<int8_t> a, Vec256<int8_t> b) {
+  return Vec256<int8_t>{_mm256_mask_max_epi8(no.raw, m.raw, a.raw, b.raw)};
+}
+HWY_API Vec256<uint16_t> MaskedMaxOr(Vec256<uint16_t> no, Mask256<uint16_t> m,
+                                     Vec256<uint16_t> a, Vec256<uint16_t> b) {
+  return Vec256<uint16_t>{_mm256_mask_max_epu16(no.raw, m.raw, a.raw, b.raw)};
+}
+HWY_API Vec256<int16_t> MaskedMaxOr(Vec256<int16_t> no, Mask256<int16_t> m,
+                                    Vec256<int16_t> a, Vec256<int16_t> b) {
+  return Vec256<int16_t>{_mm256_mask_max_epi16(no.raw, m.raw, a.raw, b.raw)};
+}
+HWY_API Vec256<uint32_t> MaskedMaxOr(Vec256<uint32_t> no, Mask256<uint32_t> m,
+                                     Vec256<uint32_t> a, Vec256<uint32_t> b) {
+  return Vec256<uint32_t>{_mm256_mask_max_epu32(no.raw, m.raw, a.raw, b.raw)};
+}
+HWY_API Vec256<int32_t> MaskedMaxOr(Vec256<int32_t> no, Mask256<int32_t> m,
+                                    Vec256<int32_t> a, Vec256<int32_t> b) {
+  return Vec256<int32_t>{_mm256_mask_max_epi32(no.raw, m.raw, a.raw, b.raw)};
+}
+HWY_API Vec256<uint64_t> MaskedMaxOr(Vec256<uint64_t> no, Mask256<uint64_t> m,
+                                     Vec256<uint64_t> a, Vec256<uint64_t> b) {
+  return Vec256<uint64_t>{_mm256_mask_max_epu64(no.raw, m.raw, a.raw, b.raw)};
+}
+HWY_API Vec256<int64_t> MaskedMaxOr(Vec256<int64_t> no, Mask256<int64_t> m,
+                                    Vec256<int64_t> a, Vec256<int64_t> b) {
+  return Vec256<int64_t>{_mm256_mask_max_epi64(no.raw, m.raw, a.raw, b.raw)};
+}
+HWY_API Vec256<float> MaskedMaxOr(Vec256<float> no, Mask256<float> m,
+                                  Vec256<float> a, Vec256<float> b) {
+  return Vec256<float>{_mm256_mask_max_ps(no.raw, m.raw, a.raw, b.raw)};
+}
+HWY_API Vec256<double> MaskedMaxOr(Vec256<double> no, Mask256<double> m,
+                                   Vec256<double> a, Vec256<double> b) {
+  return Vec256<double>{_mm256_mask_max_pd(no.raw, m.raw, a.raw, b.raw)};
+}
+
+#endif  // HWY_TARGET <= HWY_AVX3
+
 // ================================================== MEMORY
 
 // ------------------------------ Load
@@ -2041,6 +2388,45 @@ HWY_API void StoreU(const Vec256<double> v, Full256<double> /* tag */,
   _mm256_storeu_pd(p, v.raw);
 }
 
+// ------------------------------ BlendedStore
+
+#if HWY_TARGET <= HWY_AVX3
+
+template <typename T, HWY_IF_LANE_SIZE(T, 1)>
+HWY_API void BlendedStore(Vec256<T> v, Mask256<T> m, Full256<T> /* tag */,
+                          T* HWY_RESTRICT p) {
+  _mm256_mask_storeu_epi8(p, m.raw, v.raw);
+}
+
+template <typename T, HWY_IF_LANE_SIZE(T, 2)>
+HWY_API void BlendedStore(Vec256<T> v, Mask256<T> m, Full256<T> /* tag */,
+                          T* HWY_RESTRICT p) {
+  _mm256_mask_storeu_epi16(p, m.raw, v.raw);
+}
+
+template <typename T, HWY_IF_LANE_SIZE(T, 4)>
+HWY_API void BlendedStore(Vec256<T> v, Mask256<T> m, Full256<T> /* tag */,
+                          T* HWY_RESTRICT p) {
+  _mm256_mask_storeu_epi32(p, m.raw, v.raw);
+}
+
+template <typename T, HWY_IF_LANE_SIZE(T, 8)>
+HWY_API void BlendedStore(Vec256<T> v, Mask256<T> m, Full256<T> /* tag */,
+                          T* HWY_RESTRICT p) {
+  _mm256_mask_storeu_epi64(p, m.raw, v.raw);
+}
+
+HWY_API void BlendedStore(Vec256<float> v, Mask256<float> m,
+                          Full256<float> /* tag */, float* HWY_RESTRICT p) {
+  _mm256_mask_storeu_ps(p, m.raw, v.raw);
+}
+
+HWY_API void BlendedStore(Vec256<double> v, Mask256<double> m,
+                          Full256<double> /* tag */, double* HWY_RESTRICT p) {
+  _mm256_mask_storeu_pd(p, m.raw, v.raw);
+}
+
+#endif  // HWY_TARGET <= HWY_AVX3
 // ------------------------------ Non-temporal stores
 
 template <typename T>
@@ -2066,6 +2452,21 @@ HWY_DIAGNOSTICS_OFF(disable : 4245 4365, ignored "-Wsign-conversion")
 #if HWY_TARGET <= HWY_AVX3
 namespace detail {
 
+template <typename T, size_t kLaneSize, typename Offset,
+          hwy::EnableIf<kLaneSize <= 2>* = nullptr>
+HWY_INLINE void ScatterOffset(hwy::SizeTag<kLaneSize> /* tag */, Vec256<T> v,
+                              Full256<T> d, T* HWY_RESTRICT base,
+                              const Vec256<Offset> offset) {
+  ScatterOffsetEmu(v, d, base, offset);
+}
+template <typename T, size_t kLaneSize, typename Index,
+          hwy::EnableIf<kLaneSize <= 2>* = nullptr>
+HWY_INLINE void ScatterIndex(hwy::SizeTag<kLaneSize> /* tag */, Vec256<T> v,
+                             Full256<T> d, T* HWY_RESTRICT base,
+                             const Vec256<Index> index) {
+  ScatterIndexEmu(v, d, base, index);
+}
+
 template <typename T>
 HWY_INLINE void ScatterOffset(hwy::SizeTag<4> /* tag */, Vec256<T> v,
                               Full256<T> /* tag */, T* HWY_RESTRICT base,
@@ -2172,6 +2573,21 @@ HWY_API void ScatterIndex(Vec256<T> v, Full256<T> d, T* HWY_RESTRICT base,
 
 namespace detail {
 
+template <typename T, size_t kLaneSize, typename Offset,
+          hwy::EnableIf<kLaneSize <= 2>* = nullptr>
+HWY_INLINE Vec256<T> GatherOffset(hwy::SizeTag<kLaneSize> /* tag */,
+                                  Full256<T> d, const T* HWY_RESTRICT base,
+                                  const Vec256<Offset> offset) {
+  return GatherOffsetEmu(d, base, offset);
+}
+template <typename T, size_t kLaneSize, typename Index,
+          hwy::EnableIf<kLaneSize <= 2>* = nullptr>
+HWY_INLINE Vec256<T> GatherIndex(hwy::SizeTag<kLaneSize> /* tag */,
+                                 Full256<T> d, const T* HWY_RESTRICT base,
+                                 const Vec256<Index> index) {
+  return GatherIndexEmu(d, base, index);
+}
+
 template <typename T>
 HWY_INLINE Vec256<T> GatherOffset(hwy::SizeTag<4> /* tag */,
                                   Full256<T> /* tag */,
@@ -2243,6 +2659,83 @@ HWY_API Vec256<double> GatherIndex(Full256<double> /* tag */,
   return Vec256<double>{_mm256_i64gather_pd(base, index.raw, 8)};
 }
 
+// ------------------------------ MaskedGatherIndex
+
+namespace detail {
+
+template <typename T, size_t kLaneSize, typename Index,
+          hwy::EnableIf<kLaneSize <= 2>* = nullptr>
+HWY_INLINE Vec256<T> MaskedGatherIndex(hwy::SizeTag<kLaneSize> /* tag */,
+                                       Mask256<T> m, Full256<T> d,
+                                       const T* HWY_RESTRICT base,
+                                       const Vec256<Index> index) {
+  return MaskedGatherIndexEmu(m, d, base, index);
+}
+
+template <typename T>
+HWY_INLINE Vec256<T> MaskedGatherIndex(hwy::SizeTag<4> /* tag */,
+                                       Mask256<T> m, Full256<T> d,
+                                       const T* HWY_RESTRICT base,
+                                       const Vec256<int32_t> index) {
+#if HWY_TARGET <= HWY_AVX3
+  return Vec256<T>{_mm256_mmask_i32gather_epi32(Zero(d).raw, m.raw, index.raw,
+                                                base, 4)};
+#else
+  return Vec256<T>{_mm256_mask_i32gather_epi32(
+      Zero(d).raw, reinterpret_cast<const int*>(base), index.raw, m.raw, 4)};
+#endif
+}
+
+template <typename T>
+HWY_INLINE Vec256<T> MaskedGatherIndex(hwy::SizeTag<8> /* tag */,
+                                       Mask256<T> m, Full256<T> d,
+                                       const T* HWY_RESTRICT base,
+                                       const Vec256<int64_t> index) {
+#if HWY_TARGET <= HWY_AVX3
+  return Vec256<T>{_mm256_mmask_i64gather_epi64(Zero(d).raw, m.raw, index.raw,
+                                                base, 8)};
+#else
+  return Vec256<T>{_mm256_mask_i64gather_epi64(
+      Zero(d).raw, reinterpret_cast<const GatherIndex64*>(base), index.raw,
+      m.raw, 8)};
+#endif
+}
+
+}  // namespace detail
+
+template <typename T, typename Index>
+HWY_API Vec256<T> MaskedGatherIndex(Mask256<T> m, Full256<T> d,
+                                    const T* HWY_RESTRICT base,
+                                    const Vec256<Index> index) {
+  static_assert(sizeof(T) == sizeof(Index), "Must match for portability");
+  return detail::MaskedGatherIndex(hwy::SizeTag<sizeof(T)>(), m, d, base,
+                                   index);
+}
+
+HWY_API Vec256<float> MaskedGatherIndex(Mask256<float> m, Full256<float> d,
+                                        const float* HWY_RESTRICT base,
+                                        const Vec256<int32_t> index) {
+#if HWY_TARGET <= HWY_AVX3
+  return Vec256<float>{
+      _mm256_mmask_i32gather_ps(Zero(d).raw, m.raw, index.raw, base, 4)};
+#else
+  return Vec256<float>{
+      _mm256_mask_i32gather_ps(Zero(d).raw, base, index.raw, m.raw, 4)};
+#endif
+}
+
+HWY_API Vec256<double> MaskedGatherIndex(Mask256<double> m, Full256<double> d,
+                                         const double* HWY_RESTRICT base,
+                                         const Vec256<int64_t> index) {
+#if HWY_TARGET <= HWY_AVX3
+  return Vec256<double>{
+      _mm256_mmask_i64gather_pd(Zero(d).raw, m.raw, index.raw, base, 8)};
+#else
+  return Vec256<double>{
+      _mm256_mask_i64gather_pd(Zero(d).raw, base, index.raw, m.raw, 8)};
+#endif
+}
+
 HWY_DIAGNOSTICS(pop)
 
 // ================================================== SWIZZLE
@@ -2798,6 +3291,47 @@ HWY_API Vec256<double> OddEven(const Vec256<double> a, const Vec256<double> b) {
   return Vec256<double>{_mm256_blend_pd(a.raw, b.raw, 5)};
 }
 
+// ------------------------------ DupEven/DupOdd
+
+template <typename T, HWY_IF_LANE_SIZE(T, 4)>
+HWY_API Vec256<T> DupEven(const Vec256<T> v) {
+  return Vec256<T>{_mm256_shuffle_epi32(v.raw, _MM_SHUFFLE(2, 2, 0, 0))};
+}
+HWY_API Vec256<float> DupEven(const Vec256<float> v) {
+  return Vec256<float>{_mm256_moveldup_ps(v.raw)};
+}
+template <typename T, HWY_IF_LANE_SIZE(T, 8)>
+HWY_API Vec256<T> DupEven(const Vec256<T> v) {
+  return Vec256<T>{_mm256_unpacklo_epi64(v.raw, v.raw)};
+}
+HWY_API Vec256<double> DupEven(const Vec256<double> v) {
+  return Vec256<double>{_mm256_movedup_pd(v.raw)};
+}
+
+template <typename T, HWY_IF_LANE_SIZE(T, 4)>
+HWY_API Vec256<T> DupOdd(const Vec256<T> v) {
+  return Vec256<T>{_mm256_shuffle_epi32(v.raw, _MM_SHUFFLE(3, 3, 1, 1))};
+}
+HWY_API Vec256<float> DupOdd(const Vec256<float> v) {
+  return Vec256<float>{_mm256_movehdup_ps(v.raw)};
+}
+template <typename T, HWY_IF_LANE_SIZE(T, 8)>
+HWY_API Vec256<T> DupOdd(const Vec256<T> v) {
+  return Vec256<T>{_mm256_unpackhi_epi64(v.raw, v.raw)};
+}
+HWY_API Vec256<double> DupOdd(const Vec256<double> v) {
+  return Vec256<double>{_mm256_unpackhi_pd(v.raw, v.raw)};
+}
+
+// ------------------------------ AddSub
+
+HWY_API Vec256<float> AddSub(const Vec256<float> a, const Vec256<float> b) {
+  return Vec256<float>{_mm256_addsub_ps(a.raw, b.raw)};
+}
+HWY_API Vec256<double> AddSub(const Vec256<double> a, const Vec256<double> b) {
+  return Vec256<double>{_mm256_addsub_pd(a.raw, b.raw)};
+}
+
 // ------------------------------ TableLookupBytes (ZeroExtendVector)
 
 // Both full
@@ -2829,6 +3363,106 @@ HWY_API Vec256<TI> TableLookupBytes(const Vec128<T, N> bytes,
 
 // Partial both are handled by x86_128.
 
+// ------------------------------ TableLookupBytes64, TableLookupBytes128
+
+#if HWY_TARGET == HWY_AVX3_DL
+
+template <typename T, HWY_IF_LANE_SIZE(T, 1)>
+HWY_API Vec256<T> TableLookupBytes64(Full256<T> d, const T* HWY_RESTRICT table,
+                                     const Vec256<T> idx) {
+  return Vec256<T>{_mm256_permutex2var_epi8(LoadU(d, table).raw, idx.raw,
+                                            LoadU(d, table + 32).raw)};
+}
+
+template <typename T, HWY_IF_LANE_SIZE(T, 1)>
+HWY_API Vec256<T> TableLookupBytes128(Full256<T> d,
+                                      const T* HWY_RESTRICT table,
+                                      const Vec256<T> idx) {
+  const auto lower = TableLookupBytes64(d, table, idx);
+  const auto upper = TableLookupBytes64(d, table + 64, idx);
+  return IfThenElse(TestBit(idx, Set(d, T{64})), upper, lower);
+}
+
+#endif  // HWY_TARGET == HWY_AVX3_DL
+
+// ------------------------------ ReverseBlocks
+
+template <typename T>
+HWY_API Vec256<T> ReverseBlocks(Full256<T> d, const Vec256<T> v) {
+  const Repartition<uint64_t, decltype(d)> du64;
+  const __m256i raw = BitCast(du64, v).raw;
+  return BitCast(d, Vec256<uint64_t>{_mm256_permute4x64_epi64(raw, 0x4E)});
+}
+
+// ------------------------------ Reverse (ReverseBlocks, TableLookupLanes)
+
+template <typename T, HWY_IF_LANE_SIZE(T, 4)>
+HWY_API Vec256<T> Reverse(Full256<T> d, const Vec256<T> v) {
+  alignas(32) constexpr int32_t kReverse[8] = {7, 6, 5, 4, 3, 2, 1, 0};
+  return TableLookupLanes(v, SetTableIndices(d, kReverse));
+}
+
+template <typename T, HWY_IF_LANE_SIZE(T, 8)>
+HWY_API Vec256<T> Reverse(Full256<T> d, const Vec256<T> v) {
+  const Repartition<uint64_t, decltype(d)> du64;
+  const __m256i raw = BitCast(du64, v).raw;
+  return BitCast(d, Vec256<uint64_t>{_mm256_permute4x64_epi64(raw, 0x1B)});
+}
+
+// 8/16-bit: reverse within blocks, then swap the blocks.
+template <typename T, hwy::EnableIf<sizeof(T) <= 2>* = nullptr>
+HWY_API Vec256<T> Reverse(Full256<T> d, const Vec256<T> v) {
+  return ReverseBlocks(d, detail::ReverseGroupsViaBytes<16 / sizeof(T)>(d, v));
+}
+
+// ------------------------------ Reverse2
+
+template <typename T, hwy::EnableIf<sizeof(T) <= 2>* = nullptr>
+HWY_API Vec256<T> Reverse2(Full256<T> d, const Vec256<T> v) {
+  return detail::ReverseGroupsViaBytes<2>(d, v);
+}
+
+template <typename T, HWY_IF_LANE_SIZE(T, 4)>
+HWY_API Vec256<T> Reverse2(Full256<T> /* tag */, const Vec256<T> v) {
+  return Shuffle2301(v);
+}
+
+template <typename T, HWY_IF_LANE_SIZE(T, 8)>
+HWY_API Vec256<T> Reverse2(Full256<T> /* tag */, const Vec256<T> v) {
+  return Shuffle01(v);
+}
+
+// ------------------------------ Reverse4
+
+template <typename T, hwy::EnableIf<sizeof(T) <= 2>* = nullptr>
+HWY_API Vec256<T> Reverse4(Full256<T> d, const Vec256<T> v) {
+  return detail::ReverseGroupsViaBytes<4>(d, v);
+}
+
+template <typename T, HWY_IF_LANE_SIZE(T, 4)>
+HWY_API Vec256<T> Reverse4(Full256<T> /* tag */, const Vec256<T> v) {
+  return Shuffle0123(v);
+}
+
+// Four 64-bit lanes: same as Reverse.
+template <typename T, HWY_IF_LANE_SIZE(T, 8)>
+HWY_API Vec256<T> Reverse4(Full256<T> d, const Vec256<T> v) {
+  return Reverse(d, v);
+}
+
+// ------------------------------ Reverse8
+
+template <typename T, hwy::EnableIf<sizeof(T) <= 2>* = nullptr>
+HWY_API Vec256<T> Reverse8(Full256<T> d, const Vec256<T> v) {
+  return detail::ReverseGroupsViaBytes<8>(d, v);
+}
+
+// Eight 32-bit lanes: same as Reverse.
+template <typename T, HWY_IF_LANE_SIZE(T, 4)>
+HWY_API Vec256<T> Reverse8(Full256<T> d, const Vec256<T> v) {
+  return Reverse(d, v);
+}
+
 // ------------------------------ Shl (Mul, ZipLower)
 
 #if HWY_TARGET > HWY_AVX3  // AVX2 or older
@@ -2943,9 +3577,9 @@ HWY_INLINE Vec256<uint64_t> MulEven(const Vec256<uint64_t> a,
   const auto aH = Shuffle2301(a32);
   const auto bH = Shuffle2301(b32);
 
-  // Knuth double-word multiplication. We use 32x32 = 64 MulEven and only need
-  // the even (lower 64 bits of every 128-bit block) results. See
-  // https://github.com/hcs0/Hackers-Delight/blob/master/muldwu.c.tat
+  // Knuth double-word multiplication, see detail::MulHigh64 in x86_128-inl.h.
+  // We use 32x32 = 64 MulEven and only need the even (lower 64 bits of every
+  // 128-bit block) results.
   const auto aLbL = MulEven(a32, b32);
   const auto w3 = aLbL & maskL;
 
@@ -2988,6 +3622,60 @@ HWY_INLINE Vec256<uint64_t> MulOdd(const Vec256<uint64_t> a,
   return InterleaveUpper(du64, mulL, mulH);
 }
 
+// ------------------------------ MulOdd/MulHigh 32-bit (MulEven)
+
+// Multiplies odd lanes (1, 3 ..) and places the double-wide result into even
+// and the upper half into its odd neighbor lane.
+HWY_API Vec256<int64_t> MulOdd(const Vec256<int32_t> a,
+                               const Vec256<int32_t> b) {
+  const Vec256<int32_t> a_x3x1{_mm256_srli_epi64(a.raw, 32)};
+  const Vec256<int32_t> b_x3x1{_mm256_srli_epi64(b.raw, 32)};
+  return MulEven(a_x3x1, b_x3x1);
+}
+HWY_API Vec256<uint64_t> MulOdd(const Vec256<uint32_t> a,
+                                const Vec256<uint32_t> b) {
+  const Vec256<uint32_t> a_x3x1{_mm256_srli_epi64(a.raw, 32)};
+  const Vec256<uint32_t> b_x3x1{_mm256_srli_epi64(b.raw, 32)};
+  return MulEven(a_x3x1, b_x3x1);
+}
+
+// Returns the upper 32 bits of a * b in each lane.
+HWY_API Vec256<uint32_t> MulHigh(const Vec256<uint32_t> a,
+                                 const Vec256<uint32_t> b) {
+  return detail::MulHigh32(a, b);
+}
+HWY_API Vec256<int32_t> MulHigh(const Vec256<int32_t> a,
+                                const Vec256<int32_t> b) {
+  return detail::MulHigh32(a, b);
+}
+
+// ------------------------------ Mul/MulHigh 64-bit (MulEven)
+
+HWY_API Vec256<uint64_t> operator*(const Vec256<uint64_t> a,
+                                   const Vec256<uint64_t> b) {
+#if HWY_TARGET <= HWY_AVX3
+  return Vec256<uint64_t>{_mm256_mullo_epi64(a.raw, b.raw)};
+#else
+  return detail::MulLower64(a, b);
+#endif
+}
+HWY_API Vec256<int64_t> operator*(const Vec256<int64_t> a,
+                                  const Vec256<int64_t> b) {
+  // Same as unsigned.
+  const Full256<uint64_t> du;
+  return BitCast(Full256<int64_t>(), BitCast(du, a) * BitCast(du, b));
+}
+
+// Returns the upper 64 bits of a * b in each lane.
+HWY_API Vec256<uint64_t> MulHigh(const Vec256<uint64_t> a,
+                                 const Vec256<uint64_t> b) {
+  return detail::MulHigh64(a, b);
+}
+HWY_API Vec256<int64_t> MulHigh(const Vec256<int64_t> a,
+                                const Vec256<int64_t> b) {
+  return detail::MulHighSigned64(a, b);
+}
+
 // ================================================== CONVERT
 
 // ------------------------------ Promotions (part w/ narrow lanes -> full)
@@ -3174,6 +3862,42 @@ HWY_API Vec128<uint8_t, 8> U8FromU32(const Vec256<uint32_t> v) {
   return BitCast(Simd<uint8_t, 8>(), pair);
 }
 
+// ------------------------------ ReorderDemote2To
+
+// Packing operates within each 128-bit block, so the output holds 64-bit
+// groups of a and b in alternation.
+HWY_API Vec256<int16_t> ReorderDemote2To(Full256<int16_t> /* tag */,
+                                         Vec256<int32_t> a, Vec256<int32_t> b) {
+  return Vec256<int16_t>{_mm256_packs_epi32(a.raw, b.raw)};
+}
+
+HWY_API Vec256<uint16_t> ReorderDemote2To(Full256<uint16_t> /* tag */,
+                                          Vec256<int32_t> a,
+                                          Vec256<int32_t> b) {
+  return Vec256<uint16_t>{_mm256_packus_epi32(a.raw, b.raw)};
+}
+
+HWY_API Vec256<uint8_t> ReorderDemote2To(Full256<uint8_t> /* tag */,
+                                         Vec256<int16_t> a, Vec256<int16_t> b) {
+  return Vec256<uint8_t>{_mm256_packus_epi16(a.raw, b.raw)};
+}
+
+HWY_API Vec256<int8_t> ReorderDemote2To(Full256<int8_t> /* tag */,
+                                        Vec256<int16_t> a, Vec256<int16_t> b) {
+  return Vec256<int8_t>{_mm256_packs_epi16(a.raw, b.raw)};
+}
+
+// ------------------------------ OrderedDemote2To
+
+template <typename TN, typename TW>
+HWY_API Vec256<TN> OrderedDemote2To(Full256<TN> dn, Vec256<TW> a,
+                                    Vec256<TW> b) {
+  const Full256<uint64_t> du64;
+  const Vec256<uint64_t> packed = BitCast(du64, ReorderDemote2To(dn, a, b));
+  return BitCast(dn, Vec256<uint64_t>{_mm256_permute4x64_epi64(
+                         packed.raw, _MM_SHUFFLE(3, 1, 2, 0))});
+}
+
 // ------------------------------ Integer <=> fp (ShiftRight, OddEven)
 
 HWY_API Vec256<float> ConvertTo(Full256<float> /* tag */,
@@ -675,6 +675,49 @@ HWY_API Vec512<double> operator-(const Vec512<double> a,
   return Vec512<double>{_mm512_sub_pd(a.raw, b.raw)};
 }
 
+// ------------------------------ SumsOf8
+HWY_API Vec512<uint64_t> SumsOf8(const Vec512<uint8_t> v) {
+  return Vec512<uint64_t>{_mm512_sad_epu8(v.raw, _mm512_setzero_si512())};
+}
+
+// ------------------------------ SumsOfAbsDiff
+HWY_API Vec512<uint64_t> SumsOfAbsDiff(const Vec512<uint8_t> a,
+                                       const Vec512<uint8_t> b) {
+  return Vec512<uint64_t>{_mm512_sad_epu8(a.raw, b.raw)};
+}
+
+// ------------------------------ SumsOf2
+
+HWY_API Vec512<uint16_t> SumsOf2(const Vec512<uint8_t> v) {
+  return Vec512<uint16_t>{_mm512_maddubs_epi16(v.raw, _mm512_set1_epi8(1))};
+}
+
+HWY_API Vec512<int16_t> SumsOf2(const Vec512<int8_t> v) {
+  // maddubs treats its first argument as unsigned and the second as signed.
+  return Vec512<int16_t>{_mm512_maddubs_epi16(_mm512_set1_epi8(1), v.raw)};
+}
+
+HWY_API Vec512<uint32_t> SumsOf2(const Vec512<uint16_t> v) {
+  // madd is signed: bias the inputs by -0x8000 and the sum by 2 * 0x8000.
+  const __m512i biased = _mm512_xor_si512(v.raw, _mm512_set1_epi16(-0x8000));
+  const __m512i sums = _mm512_madd_epi16(biased, _mm512_set1_epi16(1));
+  return Vec512<uint32_t>{_mm512_add_epi32(sums, _mm512_set1_epi32(0x10000))};
+}
+
+HWY_API Vec512<int32_t> SumsOf2(const Vec512<int16_t> v) {
+  return Vec512<int32_t>{_mm512_madd_epi16(v.raw, _mm512_set1_epi16(1))};
+}
+
+HWY_API Vec512<double> SumsOf2(const Vec512<float> v) {
+  // Move the even lanes to the lower half and the odd lanes to the upper.
+  const __m512i idx = _mm512_setr_epi32(0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7,
+                                        9, 11, 13, 15);
+  const __m512 split = _mm512_permutexvar_ps(idx, v.raw);
+  const __m512d even = _mm512_cvtps_pd(_mm512_castps512_ps256(split));
+  const __m512d odd = _mm512_cvtps_pd(_mm512_extractf32x8_ps(split, 1));
+  return Vec512<double>{_mm512_add_pd(even, odd)};
+}
+
 // ------------------------------ Saturating addition
 
 // Returns a + b clamped to the destination range.
@@ -937,6 +980,56 @@ HWY_API Vec512<int8_t> ShiftRightSame(Vec512<int8_t> v, const int bits) {
   return (shifted ^ shifted_sign) - shifted_sign;
 }
 
+// ------------------------------ RotateRight (ShiftRight, ShiftLeft)
+
+template <int kBits, typename T, hwy::EnableIf<sizeof(T) <= 2>* = nullptr>
+HWY_API Vec512<T> RotateRight(const Vec512<T> v) {
+  return detail::RotateRightViaShifts<kBits>(v);
+}
+
+template <int kBits>
+HWY_API Vec512<uint32_t> RotateRight(const Vec512<uint32_t> v) {
+  static_assert(0 <= kBits && kBits < 32, "Invalid shift count");
+  return Vec512<uint32_t>{_mm512_ror_epi32(v.raw, kBits)};
+}
+template <int kBits>
+HWY_API Vec512<int32_t> RotateRight(const Vec512<int32_t> v) {
+  static_assert(0 <= kBits && kBits < 32, "Invalid shift count");
+  return Vec512<int32_t>{_mm512_ror_epi32(v.raw, kBits)};
+}
+template <int kBits>
+HWY_API Vec512<uint64_t> RotateRight(const Vec512<uint64_t> v) {
+  static_assert(0 <= kBits && kBits < 64, "Invalid shift count");
+  return Vec512<uint64_t>{_mm512_ror_epi64(v.raw, kBits)};
+}
+template <int kBits>
+HWY_API Vec512<int64_t> RotateRight(const Vec512<int64_t> v) {
+  static_assert(0 <= kBits && kBits < 64, "Invalid shift count");
+  return Vec512<int64_t>{_mm512_ror_epi64(v.raw, kBits)};
+}
+
+// ------------------------------ LeadingZeroCount (ShiftLeft, Min)
+
+HWY_API Vec512<uint32_t> LeadingZeroCount(const Vec512<uint32_t> v) {
+  return Vec512<uint32_t>{_mm512_lzcnt_epi32(v.raw)};
+}
+HWY_API Vec512<int32_t> LeadingZeroCount(const Vec512<int32_t> v) {
+  return Vec512<int32_t>{_mm512_lzcnt_epi32(v.raw)};
+}
+HWY_API Vec512<uint64_t> LeadingZeroCount(const Vec512<uint64_t> v) {
+  return Vec512<uint64_t>{_mm512_lzcnt_epi64(v.raw)};
+}
+HWY_API Vec512<int64_t> LeadingZeroCount(const Vec512<int64_t> v) {
+  return Vec512<int64_t>{_mm512_lzcnt_epi64(v.raw)};
+}
+
+template <typename T, hwy::EnableIf<sizeof(T) <= 2>* = nullptr>
+HWY_API Vec512<T> LeadingZeroCount(const Vec512<T> v) {
+  const Full512<MakeUnsigned<T>> du;
+  return BitCast(Full512<T>(),
+                 detail::LeadingZeroCountViaWide(BitCast(du, v)));
+}
+
 // ------------------------------ Shl
 
 HWY_API Vec512<uint16_t> operator<<(const Vec512<uint16_t> v,
@@ -1108,6 +1201,11 @@ HWY_API Vec512<int16_t> MulHigh(const Vec512<int16_t> a,
   return Vec512<int16_t>{_mm512_mulhi_epi16(a.raw, b.raw)};
 }
 
+HWY_API Vec512<int16_t> MulFixedPoint15(const Vec512<int16_t> a,
+                                        const Vec512<int16_t> b) {
+  return Vec512<int16_t>{_mm512_mulhrs_epi16(a.raw, b.raw)};
+}
+
 // Multiplies even lanes (0, 2 ..) and places the double-wide result into
 // even and the upper half into its odd neighbor lane.
 HWY_API Vec512<int64_t> MulEven(const Vec512<int32_t> a,
@@ -1264,6 +1362,203 @@ HWY_API Vec512<double> Floor(const Vec512<double> v) {
       _mm512_roundscale_pd(v.raw, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC)};
 }
 
+// ------------------------------ Masked arithmetic
+
+namespace detail {
+
+template <typename T>
+HWY_INLINE Vec512<T> MaskedAddOr(hwy::SizeTag<1> /* tag */, Vec512<T> no,
+                                 Mask512<T> m, Vec512<T> a, Vec512<T> b) {
+  return Vec512<T>{_mm512_mask_add_epi8(no.raw, m.raw, a.raw, b.raw)};
+}
+template <typename T>
+HWY_INLINE Vec512<T> MaskedAddOr(hwy::SizeTag<2> /* tag */, Vec512<T> no,
+                                 Mask512<T> m, Vec512<T> a, Vec512<T> b) {
+  return Vec512<T>{_mm512_mask_add_epi16(no.raw, m.raw, a.raw, b.raw)};
+}
+template <typename T>
+HWY_INLINE Vec512<T> MaskedAddOr(hwy::SizeTag<4> /* tag */, Vec512<T> no,
+                                 Mask512<T> m, Vec512<T> a, Vec512<T> b) {
+  return Vec512<T>{_mm512_mask_add_epi32(no.raw, m.raw, a.raw, b.raw)};
+}
+template <typename T>
+HWY_INLINE Vec512<T> MaskedAddOr(hwy::SizeTag<8> /* tag */, Vec512<T> no,
+                                 Mask512<T> m, Vec512<T> a, Vec512<T> b) {
+  return Vec512<T>{_mm512_mask_add_epi64(no.raw, m.raw, a.raw, b.raw)};
+}
+
+template <typename T>
+HWY_INLINE Vec512<T> MaskedSubOr(hwy::SizeTag<1> /* tag */, Vec512<T> no,
+                                 Mask512<T> m, Vec512<T> a, Vec512<T> b) {
+  return Vec512<T>{_mm512_mask_sub_epi8(no.raw, m.raw, a.raw, b.raw)};
+}
+template <typename T>
+HWY_INLINE Vec512<T> MaskedSubOr(hwy::SizeTag<2> /* tag */, Vec512<T> no,
+                                 Mask512<T> m, Vec512<T> a, Vec512<T> b) {
+  return Vec512<T>{_mm512_mask_sub_epi16(no.raw, m.raw, a.raw, b.raw)};
+}
+template <typename T>
+HWY_INLINE Vec512<T> MaskedSubOr(hwy::SizeTag<4> /* tag */, Vec512<T> no,
+                                 Mask512<T> m, Vec512<T> a, Vec512<T> b) {
+  return Vec512<T>{_mm512_mask_sub_epi32(no.raw, m.raw, a.raw, b.raw)};
+}
+template <typename T>
+HWY_INLINE Vec512<T> MaskedSubOr(hwy::SizeTag<8> /* tag */, Vec512<T> no,
+                                 Mask512<T> m, Vec512<T> a, Vec512<T> b) {
+  return Vec512<T>{_mm512_mask_sub_epi64(no.raw, m.raw, a.raw, b.raw)};
+}
+
+template <typename T>
+HWY_INLINE Vec512<T> MaskedMulOr(hwy::SizeTag<2> /* tag */, Vec512<T> no,
+                                 Mask512<T> m, Vec512<T> a, Vec512<T> b) {
+  return Vec512<T>{_mm512_mask_mullo_epi16(no.raw, m.raw, a.raw, b.raw)};
+}
+template <typename T>
+HWY_INLINE Vec512<T> MaskedMulOr(hwy::SizeTag<4> /* tag */, Vec512<T> no,
+                                 Mask512<T> m, Vec512<T> a, Vec512<T> b) {
+  return Vec512<T>{_mm512_mask_mullo_epi32(no.raw, m.raw, a.raw, b.raw)};
+}
+template <typename T>
+HWY_INLINE Vec512<T> MaskedMulOr(hwy::SizeTag<8> /* tag */, Vec512<T> no,
+                                 Mask512<T> m, Vec512<T> a, Vec512<T> b) {
+  return Vec512<T>{_mm512_mask_mullo_epi64(no.raw, m.raw, a.raw, b.raw)};
+}
+
+}  // namespace detail
+
+template <typename T>
+HWY_API Vec512<T> MaskedAddOr(Vec512<T> no, Mask512<T> m, Vec512<T> a,
+                              Vec512<T> b) {
+  return detail::MaskedAddOr(hwy::SizeTag<sizeof(T)>(), no, m, a, b);
+}
+HWY_API Vec512<float> MaskedAddOr(Vec512<float> no, Mask512<float> m,
+                                  Vec512<float> a, Vec512<float> b) {
+  return Vec512<float>{_mm512_mask_add_ps(no.raw, m.raw, a.raw, b.raw)};
+}
+HWY_API Vec512<double> MaskedAddOr(Vec512<double> no, Mask512<double> m,
+                                   Vec512<double> a, Vec512<double> b) {
+  return Vec512<double>{_mm512_mask_add_pd(no.raw, m.raw, a.raw, b.raw)};
+}
+
+template <typename T>
+HWY_API Vec512<T> MaskedSubOr(Vec512<T> no, Mask512<T> m, Vec512<T> a,
+                              Vec512<T> b) {
+  return detail::MaskedSubOr(hwy::SizeTag<sizeof(T)>(), no, m, a, b);
+}
+HWY_API Vec512<float> MaskedSubOr(Vec512<float> no, Mask512<float> m,
+                                  Vec512<float> a, Vec512<float> b) {
+  return Vec512<float>{_mm512_mask_sub_ps(no.raw, m.raw, a.raw, b.raw)};
+}
+HWY_API Vec512<double> MaskedSubOr(Vec512<double> no, Mask512<double> m,
+                                   Vec512<double> a, Vec512<double> b) {
+  return Vec512<double>{_mm512_mask_sub_pd(no.raw, m.raw, a.raw, b.raw)};
+}
+
+template <typename T>
+HWY_API Vec512<T> MaskedMulOr(Vec512<T> no, Mask512<T> m, Vec512<T> a,
+                              Vec512<T> b) {
+  return detail::MaskedMulOr(hwy::SizeTag<sizeof(T)>(), no, m, a, b);
+}
+HWY_API Vec512<float> MaskedMulOr(Vec512<float> no, Mask512<float> m,
+                                  Vec512<float> a, Vec512<float> b) {
+  return Vec512<float>{_mm512_mask_mul_ps(no.raw, m.raw, a.raw, b.raw)};
+}
+HWY_API Vec512<double> MaskedMulOr(Vec512<double> no, Mask512<double> m,
+                                   Vec512<double> a, Vec512<double> b) {
+  return Vec512<double>{_mm512_mask_mul_pd(no.raw, m.raw, a.raw, b.raw)};
+}
+
+HWY_API Vec512<float> MaskedDivOr(Vec512<float> no, Mask512<float> m,
+                                  Vec512<float> a, Vec512<float> b) {
+  return Vec512<float>{_mm512_mask_div_ps(no.raw, m.raw, a.raw, b.raw)};
+}
+HWY_API Vec512<double> MaskedDivOr(Vec512<double> no, Mask512<double> m,
+                                   Vec512<double> a, Vec512<double> b) {
+  return Vec512<double>{_mm512_mask_div_pd(no.raw, m.raw, a.raw, b.raw)};
+}
+
+HWY_API Vec512<uint8_t> MaskedMinOr(Vec512<uint8_t> no, Mask512<uint8_t> m,
+                                    Vec512<uint8_t> a, Vec512<uint8_t> b) {
+  return Vec512<uint8_t>{_mm512_mask_min_epu8(no.raw, m.raw, a.raw, b.raw)};
+}
+HWY_API Vec512<int8_t> MaskedMinOr(Vec512<int8_t> no, Mask512<int8_t> m,
+                                   Vec512<int8_t> a, Vec512<int8_t> b) {
+  return Vec512<int8_t>{_mm512_mask_min_epi8(no.raw, m.raw, a.raw, b.raw)};
+}
+HWY_API Vec512<uint16_t> MaskedMinOr(Vec512<uint16_t> no, Mask512<uint16_t> m,
+                                     Vec512<uint16_t> a, Vec512<uint16_t> b) {
+  return Vec512<uint16_t>{_mm512_mask_min_epu16(no.raw, m.raw, a.raw, b.raw)};
+}
+HWY_API Vec512<int16_t> MaskedMinOr(Vec512<int16_t> no, Mask512<int16_t> m,
+                                    Vec512<int16_t> a, Vec512<int16_t> b) {
+  return Vec512<int16_t>{_mm512_mask_min_epi16(no.raw, m.raw, a.raw, b.raw)};
+}
+HWY_API Vec512<uint32_t> MaskedMinOr(Vec512<uint32_t> no, Mask512<uint32_t> m,
+                                     Vec512<uint32_t> a, Vec512<uint32_t> b) {
+  return Vec512<uint32_t>{_mm512_mask_min_epu32(no.raw, m.raw, a.raw, b.raw)};
+}
+HWY_API Vec512<int32_t> MaskedMinOr(Vec512<int32_t> no, Mask512<int32_t> m,
+                                    Vec512<int32_t> a, Vec512<int32_t> b) {
+  return Vec512<int32_t>{_mm512_mask_min_epi32(no.raw, m.raw, a.raw, b.raw)};
+}
+HWY_API Vec512<uint64_t> MaskedMinOr(Vec512<uint64_t> no, Mask512<uint64_t> m,
+                                     Vec512<uint64_t> a, Vec512<uint64_t> b) {
+  return Vec512<uint64_t>{_mm512_mask_min_epu64(no.raw, m.raw, a.raw, b.raw)};
+}
+HWY_API Vec512<int64_t> MaskedMinOr(Vec512<int64_t> no, Mask512<int64_t> m,
+                                    Vec512<int64_t> a, Vec512<int64_t> b) {
+  return Vec512<int64_t>{_mm512_mask_min_epi64(no.raw, m.raw, a.raw, b.raw)};
+}
+HWY_API Vec512<float> MaskedMinOr(Vec512<float> no, Mask512<float> m,
+                                  Vec512<float> a, Vec512<float> b) {
+  return Vec512<float>{_mm512_mask_min_ps(no.raw, m.raw, a.raw, b.raw)};
+}
+HWY_API Vec512<double> MaskedMinOr(Vec512<double> no, Mask512<double> m,
+                                   Vec512<double> a, Vec512<double> b) {
+  return Vec512<double>{_mm512_mask_min_pd(no.raw, m.raw, a.raw, b.raw)};
+}
+
+HWY_API Vec512<uint8_t> MaskedMaxOr(Vec512<uint8_t> no, Mask512<uint8_t> m,
+                                    Vec512<uint8_t> a, Vec512<uint8_t> b) {
+  return Vec512<uint8_t>{_mm512_mask_max_epu8(no.raw, m.raw, a.raw, b.raw)};
+}
+HWY_API Vec512<int8_t> MaskedMaxOr(Vec512<int8_t> no, Mask512<int8_t> m,
+                                   Vec512<int8_t> a, Vec512<int8_t> b) {
+  return Vec512<int8_t>{_mm512_mask_max_epi8(no.raw, m.raw, a.raw, b.raw)};
+}
+HWY_API Vec512<uint16_t> MaskedMaxOr(Vec512<uint16_t> no, Mask512<uint16_t> m,
+                                     Vec512<uint16_t> a, Vec512<uint16_t> b) {
+  return Vec512<uint16_t>{_mm512_mask_max_epu16(no.raw, m.raw, a.raw, b.raw)};
+}
+HWY_API Vec512<int16_t> MaskedMaxOr(Vec512<int16_t> no, Mask512<int16_t> m,
+                                    Vec512<int16_t> a, Vec512<int16_t> b) {
+  return Vec512<int16_t>{_mm512_mask_max_epi16(no.raw, m.raw, a.raw, b.raw)};
+}
+HWY_API Vec512<uint32_t> MaskedMaxOr(Vec512<uint32_t> no, Mask512<uint32_t> m,
+                                     Vec512<uint32_t> a, Vec512<uint32_t> b) {
+  return Vec512<uint32_t>{_mm512_mask_max_epu32(no.raw, m.raw, a.raw, b.raw)};
+}
+HWY_API Vec512<int32_t> MaskedMaxOr(Vec512<int32_t> no, Mask512<int32_t> m,
+                                    Vec512<int32_t> a, Vec512<int32_t> b) {
+  return Vec512<int32_t>{_mm512_mask_max_epi32(no.raw, m.raw, a.raw, b.raw)};
+}
+HWY_API Vec512<uint64_t> MaskedMaxOr(Vec512<uint64_t> no, Mask512<uint64_t> m,
+                                     Vec512<uint64_t> a, Vec512<uint64_t> b) {
+  return Vec512<uint64_t>{_mm512_mask_max_epu64(no.raw, m.raw, a.raw, b.raw)};
+}
+HWY_API Vec512<int64_t> MaskedMaxOr(Vec512<int64_t> no, Mask512<int64_t> m,
+                                    Vec512<int64_t> a, Vec512<int64_t> b) {
+  return Vec512<int64_t>{_mm512_mask_max_epi64(no.raw, m.raw, a.raw, b.raw)};
+}
+HWY_API Vec512<float> MaskedMaxOr(Vec512<float> no, Mask512<float> m,
+                                  Vec512<float> a, Vec512<float> b) {
+  return Vec512<float>{_mm512_mask_max_ps(no.raw, m.raw, a.raw, b.raw)};
+}
+HWY_API Vec512<double> MaskedMaxOr(Vec512<double> no, Mask512<double> m,
+                                   Vec512<double> a, Vec512<double> b) {
+  return Vec512<double>{_mm512_mask_max_pd(no.raw, m.raw, a.raw, b.raw)};
+}
+
 HWY_DIAGNOSTICS(pop)
 
 // ================================================== COMPARE
@@ -1689,6 +1984,47 @@ HWY_API Mask512<T> Xor(const Mask512<T> a, Mask512<T> b) {
   return detail::Xor(hwy::SizeTag<sizeof(T)>(), a, b);
 }
 
+// ------------------------------ Floating-point classification (Not)
+
+HWY_API Mask512<float> IsNaN(const Vec512<float> v) {
+  return Mask512<float>{_mm512_fpclass_ps_mask(v.raw, 0x81)};
+}
+HWY_API Mask512<double> IsNaN(const Vec512<double> v) {
+  return Mask512<double>{_mm512_fpclass_pd_mask(v.raw, 0x81)};
+}
+
+HWY_API Mask512<float> IsInf(const Vec512<float> v) {
+  return Mask512<float>{_mm512_fpclass_ps_mask(v.raw, 0x18)};
+}
+HWY_API Mask512<double> IsInf(const Vec512<double> v) {
+  return Mask512<double>{_mm512_fpclass_pd_mask(v.raw, 0x18)};
+}
+
+HWY_API Mask512<float> IsFinite(const Vec512<float> v) {
+  return Not(Mask512<float>{_mm512_fpclass_ps_mask(v.raw, 0x99)});
+}
+HWY_API Mask512<double> IsFinite(const Vec512<double> v) {
+  return Not(Mask512<double>{_mm512_fpclass_pd_mask(v.raw, 0x99)});
+}
+
+// ------------------------------ GetExponent
+
+HWY_API Vec512<float> GetExponent(const Vec512<float> v) {
+  return Vec512<float>{_mm512_getexp_ps(v.raw)};
+}
+HWY_API Vec512<double> GetExponent(const Vec512<double> v) {
+  return Vec512<double>{_mm512_getexp_pd(v.raw)};
+}
+
+// ------------------------------ LdExp
+
+HWY_API Vec512<float> LdExp(const Vec512<float> v, const Vec512<int32_t> e) {
+  return Vec512<float>{_mm512_scalef_ps(v.raw, _mm512_cvtepi32_ps(e.raw))};
+}
+HWY_API Vec512<double> LdExp(const Vec512<double> v, const Vec512<int64_t> e) {
+  return Vec512<double>{_mm512_scalef_pd(v.raw, _mm512_cvtepi64_pd(e.raw))};
+}
+
 // ------------------------------ BroadcastSignBit (ShiftRight, compare, mask)
 
 HWY_API Vec512<int8_t> BroadcastSignBit(const Vec512<int8_t> v) {
@@ -1847,6 +2183,41 @@ HWY_API void StoreU(const Vec512<double> v, Full512<double>,
   _mm512_storeu_pd(p, v.raw);
 }
 
+// ------------------------------ BlendedStore
+
+template <typename T, HWY_IF_LANE_SIZE(T, 1)>
+HWY_API void BlendedStore(Vec512<T> v, Mask512<T> m, Full512<T> /* tag */,
+                          T* HWY_RESTRICT p) {
+  _mm512_mask_storeu_epi8(p, m.raw, v.raw);
+}
+
+template <typename T, HWY_IF_LANE_SIZE(T, 2)>
+HWY_API void BlendedStore(Vec512<T> v, Mask512<T> m, Full512<T> /* tag */,
+                          T* HWY_RESTRICT p) {
+  _mm512_mask_storeu_epi16(p, m.raw, v.raw);
+}
+
+template <typename T, HWY_IF_LANE_SIZE(T, 4)>
+HWY_API void BlendedStore(Vec512<T> v, Mask512<T> m, Full512<T> /* tag */,
+                          T* HWY_RESTRICT p) {
+  _mm512_mask_storeu_epi32(p, m.raw, v.raw);
+}
+
+template <typename T, HWY_IF_LANE_SIZE(T, 8)>
+HWY_API void BlendedStore(Vec512<T> v, Mask512<T> m, Full512<T> /* tag */,
+                          T* HWY_RESTRICT p) {
+  _mm512_mask_storeu_epi64(p, m.raw, v.raw);
+}
+
+HWY_API void BlendedStore(Vec512<float> v, Mask512<float> m,
+                          Full512<float> /* tag */, float* HWY_RESTRICT p) {
+  _mm512_mask_storeu_ps(p, m.raw, v.raw);
+}
+
+HWY_API void BlendedStore(Vec512<double> v, Mask512<double> m,
+                          Full512<double> /* tag */, double* HWY_RESTRICT p) {
+  _mm512_mask_storeu_pd(p, m.raw, v.raw);
+}
 // ------------------------------ Non-temporal stores
 
 template <typename T>
@@ -1871,6 +2242,21 @@ HWY_DIAGNOSTICS_OFF(disable : 4245 4365, ignored "-Wsign-conversion")
 
 namespace detail {
 
+template <typename T, size_t kLaneSize, typename Offset,
+          hwy::EnableIf<kLaneSize <= 2>* = nullptr>
+HWY_INLINE void ScatterOffset(hwy::SizeTag<kLaneSize> /* tag */, Vec512<T> v,
+                              Full512<T> d, T* HWY_RESTRICT base,
+                              const Vec512<Offset> offset) {
+  ScatterOffsetEmu(v, d, base, offset);
+}
+template <typename T, size_t kLaneSize, typename Index,
+          hwy::EnableIf<kLaneSize <= 2>* = nullptr>
+HWY_INLINE void ScatterIndex(hwy::SizeTag<kLaneSize> /* tag */, Vec512<T> v,
+                             Full512<T> d, T* HWY_RESTRICT base,
+                             const Vec512<Index> index) {
+  ScatterIndexEmu(v, d, base, index);
+}
+
 template <typename T>
 HWY_INLINE void ScatterOffset(hwy::SizeTag<4> /* tag */, Vec512<T> v,
                               Full512<T> /* tag */, T* HWY_RESTRICT base,
@@ -1938,6 +2324,21 @@ HWY_API void ScatterIndex(Vec512<double> v, Full512<double> /* tag */,
 
 namespace detail {
 
+template <typename T, size_t kLaneSize, typename Offset,
+          hwy::EnableIf<kLaneSize <= 2>* = nullptr>
+HWY_INLINE Vec512<T> GatherOffset(hwy::SizeTag<kLaneSize> /* tag */,
+                                  Full512<T> d, const T* HWY_RESTRICT base,
+                                  const Vec512<Offset> offset) {
+  return GatherOffsetEmu(d, base, offset);
+}
+template <typename T, size_t kLaneSize, typename Index,
+          hwy::EnableIf<kLaneSize <= 2>* = nullptr>
+HWY_INLINE Vec512<T> GatherIndex(hwy::SizeTag<kLaneSize> /* tag */,
+                                 Full512<T> d, const T* HWY_RESTRICT base,
+                                 const Vec512<Index> index) {
+  return GatherIndexEmu(d, base, index);
+}
+
 template <typename T>
 HWY_INLINE Vec512<T> GatherOffset(hwy::SizeTag<4> /* tag */,
                                   Full512<T> /* tag */,
@@ -2005,6 +2406,62 @@ HWY_API Vec512<double> GatherIndex(Full512<double> /* tag */,
   return Vec512<double>{_mm512_i64gather_pd(index.raw, base, 8)};
 }
 
+// ------------------------------ MaskedGatherIndex
+
+namespace detail {
+
+template <typename T, size_t kLaneSize, typename Index,
+          hwy::EnableIf<kLaneSize <= 2>* = nullptr>
+HWY_INLINE Vec512<T> MaskedGatherIndex(hwy::SizeTag<kLaneSize> /* tag */,
+                                       Mask512<T> m, Full512<T> d,
+                                       const T* HWY_RESTRICT base,
+                                       const Vec512<Index> index) {
+  return MaskedGatherIndexEmu(m, d, base, index);
+}
+
+template <typename T>
+HWY_INLINE Vec512<T> MaskedGatherIndex(hwy::SizeTag<4> /* tag */,
+                                       Mask512<T> m, Full512<T> d,
+                                       const T* HWY_RESTRICT base,
+                                       const Vec512<int32_t> index) {
+  return Vec512<T>{_mm512_mask_i32gather_epi32(Zero(d).raw, m.raw, index.raw,
+                                               base, 4)};
+}
+
+template <typename T>
+HWY_INLINE Vec512<T> MaskedGatherIndex(hwy::SizeTag<8> /* tag */,
+                                       Mask512<T> m, Full512<T> d,
+                                       const T* HWY_RESTRICT base,
+                                       const Vec512<int64_t> index) {
+  return Vec512<T>{_mm512_mask_i64gather_epi64(Zero(d).raw, m.raw, index.raw,
+                                               base, 8)};
+}
+
+}  // namespace detail
+
+template <typename T, typename Index>
+HWY_API Vec512<T> MaskedGatherIndex(Mask512<T> m, Full512<T> d,
+                                    const T* HWY_RESTRICT base,
+                                    const Vec512<Index> index) {
+  static_assert(sizeof(T) == sizeof(Index), "Must match for portability");
+  return detail::MaskedGatherIndex(hwy::SizeTag<sizeof(T)>(), m, d, base,
+                                   index);
+}
+
+HWY_API Vec512<float> MaskedGatherIndex(Mask512<float> m, Full512<float> d,
+                                        const float* HWY_RESTRICT base,
+                                        const Vec512<int32_t> index) {
+  return Vec512<float>{
+      _mm512_mask_i32gather_ps(Zero(d).raw, m.raw, index.raw, base, 4)};
+}
+
+HWY_API Vec512<double> MaskedGatherIndex(Mask512<double> m, Full512<double> d,
+                                         const double* HWY_RESTRICT base,
+                                         const Vec512<int64_t> index) {
+  return Vec512<double>{
+      _mm512_mask_i64gather_pd(Zero(d).raw, m.raw, index.raw, base, 8)};
+}
+
 HWY_DIAGNOSTICS(pop)
 
 // ================================================== SWIZZLE
@@ -2536,6 +2993,49 @@ HWY_API Vec512<T> OddEven(const Vec512<T> a, const Vec512<T> b) {
   return IfThenElse(Mask512<T>{0x5555555555555555ull >> shift}, b, a);
 }
 
+// ------------------------------ DupEven/DupOdd
+
+template <typename T, HWY_IF_LANE_SIZE(T, 4)>
+HWY_API Vec512<T> DupEven(const Vec512<T> v) {
+  return Vec512<T>{_mm512_shuffle_epi32(v.raw, _MM_PERM_CCAA)};
+}
+HWY_API Vec512<float> DupEven(const Vec512<float> v) {
+  return Vec512<float>{_mm512_moveldup_ps(v.raw)};
+}
+template <typename T, HWY_IF_LANE_SIZE(T, 8)>
+HWY_API Vec512<T> DupEven(const Vec512<T> v) {
+  return Vec512<T>{_mm512_unpacklo_epi64(v.raw, v.raw)};
+}
+HWY_API Vec512<double> DupEven(const Vec512<double> v) {
+  return Vec512<double>{_mm512_movedup_pd(v.raw)};
+}
+
+template <typename T, HWY_IF_LANE_SIZE(T, 4)>
+HWY_API Vec512<T> DupOdd(const Vec512<T> v) {
+  return Vec512<T>{_mm512_shuffle_epi32(v.raw, _MM_PERM_DDBB)};
+}
+HWY_API Vec512<float> DupOdd(const Vec512<float> v) {
+  return Vec512<float>{_mm512_movehdup_ps(v.raw)};
+}
+template <typename T, HWY_IF_LANE_SIZE(T, 8)>
+HWY_API Vec512<T> DupOdd(const Vec512<T> v) {
+  return Vec512<T>{_mm512_unpackhi_epi64(v.raw, v.raw)};
+}
+HWY_API Vec512<double> DupOdd(const Vec512<double> v) {
+  return Vec512<double>{_mm512_unpackhi_pd(v.raw, v.raw)};
+}
+
+// ------------------------------ AddSub
+
+// There is no addsub instruction, but fmaddsub with a unit factor is exact.
+HWY_API Vec512<float> AddSub(const Vec512<float> a, const Vec512<float> b) {
+  return Vec512<float>{_mm512_fmaddsub_ps(a.raw, _mm512_set1_ps(1.0f), b.raw)};
+}
+HWY_API Vec512<double> AddSub(const Vec512<double> a, const Vec512<double> b) {
+  return Vec512<double>{
+      _mm512_fmaddsub_pd(a.raw, _mm512_set1_pd(1.0), b.raw)};
+}
+
 // ------------------------------ TableLookupBytes (ZeroExtendVector)
 
 // Both full
@@ -2584,6 +3084,129 @@ HWY_API Vec512<TI> TableLookupBytes(Vec256<T> bytes, Vec512<TI> from) {
 
 // Partial both are handled by x86_128/256.
 
+// ------------------------------ TableLookupBytes64, TableLookupBytes128
+
+#if HWY_TARGET == HWY_AVX3_DL
+
+template <typename T, HWY_IF_LANE_SIZE(T, 1)>
+HWY_API Vec512<T> TableLookupBytes64(Full512<T> d, const T* HWY_RESTRICT table,
+                                     const Vec512<T> idx) {
+  return Vec512<T>{_mm512_permutexvar_epi8(idx.raw, LoadU(d, table).raw)};
+}
+
+template <typename T, HWY_IF_LANE_SIZE(T, 1)>
+HWY_API Vec512<T> TableLookupBytes128(Full512<T> d,
+                                      const T* HWY_RESTRICT table,
+                                      const Vec512<T> idx) {
+  return Vec512<T>{_mm512_permutex2var_epi8(LoadU(d, table).raw, idx.raw,
+                                            LoadU(d, table + 64).raw)};
+}
+
+#endif  // HWY_TARGET == HWY_AVX3_DL
+
+// ------------------------------ ReverseBlocks
+
+template <typename T>
+HWY_API Vec512<T> ReverseBlocks(Full512<T> d, const Vec512<T> v) {
+  const Repartition<uint32_t, decltype(d)> du32;
+  const __m512i raw = BitCast(du32, v).raw;
+  return BitCast(
+      d, Vec512<uint32_t>{_mm512_shuffle_i32x4(raw, raw, _MM_PERM_ABCD)});
+}
+
+// ------------------------------ Reverse (ReverseBlocks, TableLookupLanes)
+
+template <typename T, HWY_IF_LANE_SIZE(T, 2)>
+HWY_API Vec512<T> Reverse(Full512<T> d, const Vec512<T> v) {
+  const Repartition<int16_t, decltype(d)> di16;
+  alignas(64) constexpr int16_t kReverse[32] = {
+      31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16,
+      15, 14, 13, 12, 11, 10, 9,  8,  7,  6,  5,  4,  3,  2,  1,  0};
+  const Vec512<int16_t> idx = Load(di16, kReverse);
+  const __m512i raw = BitCast(di16, v).raw;
+  return BitCast(d, Vec512<int16_t>{_mm512_permutexvar_epi16(idx.raw, raw)});
+}
+
+template <typename T, HWY_IF_LANE_SIZE(T, 4)>
+HWY_API Vec512<T> Reverse(Full512<T> d, const Vec512<T> v) {
+  alignas(64) constexpr int32_t kReverse[16] = {15, 14, 13, 12, 11, 10, 9, 8,
+                                                7,  6,  5,  4,  3,  2,  1, 0};
+  return TableLookupLanes(v, SetTableIndices(d, kReverse));
+}
+
+template <typename T, HWY_IF_LANE_SIZE(T, 8)>
+HWY_API Vec512<T> Reverse(Full512<T> d, const Vec512<T> v) {
+  const Repartition<int64_t, decltype(d)> di64;
+  alignas(64) constexpr int64_t kReverse[8] = {7, 6, 5, 4, 3, 2, 1, 0};
+  const Vec512<int64_t> idx = Load(di64, kReverse);
+  const __m512i raw = BitCast(di64, v).raw;
+  return BitCast(d, Vec512<int64_t>{_mm512_permutexvar_epi64(idx.raw, raw)});
+}
+
+// 8-bit: reverse within blocks, then reverse the blocks.
+template <typename T, HWY_IF_LANE_SIZE(T, 1)>
+HWY_API Vec512<T> Reverse(Full512<T> d, const Vec512<T> v) {
+  return ReverseBlocks(d, detail::ReverseGroupsViaBytes<16>(d, v));
+}
+
+// ------------------------------ Reverse2
+
+template <typename T, hwy::EnableIf<sizeof(T) <= 2>* = nullptr>
+HWY_API Vec512<T> Reverse2(Full512<T> d, const Vec512<T> v) {
+  return detail::ReverseGroupsViaBytes<2>(d, v);
+}
+
+template <typename T, HWY_IF_LANE_SIZE(T, 4)>
+HWY_API Vec512<T> Reverse2(Full512<T> /* tag */, const Vec512<T> v) {
+  return Shuffle2301(v);
+}
+
+template <typename T, HWY_IF_LANE_SIZE(T, 8)>
+HWY_API Vec512<T> Reverse2(Full512<T> /* tag */, const Vec512<T> v) {
+  return Shuffle01(v);
+}
+
+// ------------------------------ Reverse4
+
+template <typename T, hwy::EnableIf<sizeof(T) <= 2>* = nullptr>
+HWY_API Vec512<T> Reverse4(Full512<T> d, const Vec512<T> v) {
+  return detail::ReverseGroupsViaBytes<4>(d, v);
+}
+
+template <typename T, HWY_IF_LANE_SIZE(T, 4)>
+HWY_API Vec512<T> Reverse4(Full512<T> /* tag */, const Vec512<T> v) {
+  return Shuffle0123(v);
+}
+
+// Reverses each 256-bit half.
+template <typename T, HWY_IF_LANE_SIZE(T, 8)>
+HWY_API Vec512<T> Reverse4(Full512<T> d, const Vec512<T> v) {
+  const Repartition<uint64_t, decltype(d)> du64;
+  const __m512i raw = BitCast(du64, v).raw;
+  return BitCast(d, Vec512<uint64_t>{_mm512_permutex_epi64(raw, 0x1B)});
+}
+
+// ------------------------------ Reverse8
+
+template <typename T, hwy::EnableIf<sizeof(T) <= 2>* = nullptr>
+HWY_API Vec512<T> Reverse8(Full512<T> d, const Vec512<T> v) {
+  return detail::ReverseGroupsViaBytes<8>(d, v);
+}
+
+// Reverses each 256-bit half.
+template <typename T, HWY_IF_LANE_SIZE(T, 4)>
+HWY_API Vec512<T> Reverse8(Full512<T> d, const Vec512<T> v) {
+  alignas(64) constexpr int32_t kReverse8[16] = {7,  6,  5,  4,  3,  2,  1, 0,
+                                                 15, 14, 13, 12, 11, 10, 9, 8};
+  return TableLookupLanes(v, SetTableIndices(d, kReverse8));
+}
+
+// Eight 64-bit lanes: same as Reverse.
+template <typename T, HWY_IF_LANE_SIZE(T, 8)>
+HWY_API Vec512<T> Reverse8(Full512<T> d, const Vec512<T> v) {
+  return Reverse(d, v);
+}
+
 // ================================================== CONVERT
 
 // ------------------------------ Promotions (part w/ narrow lanes -> full)
@@ -2762,6 +3385,46 @@ HWY_API Vec128<uint8_t, 16> U8FromU32(const Vec512<uint32_t> v) {
   return LowerHalf(LowerHalf(bytes));
 }
 
+// ------------------------------ ReorderDemote2To
+
+// Packing operates within each 128-bit block, so the output holds 64-bit
+// groups of a and b in alternation.
+HWY_API Vec512<int16_t> ReorderDemote2To(Full512<int16_t> /* tag */,
+                                         Vec512<int32_t> a, Vec512<int32_t> b) {
+  return Vec512<int16_t>{_mm512_packs_epi32(a.raw, b.raw)};
+}
+
+HWY_API Vec512<uint16_t> ReorderDemote2To(Full512<uint16_t> /* tag */,
+                                          Vec512<int32_t> a,
+                                          Vec512<int32_t> b) {
+  return Vec512<uint16_t>{_mm512_packus_epi32(a.raw, b.raw)};
+}
+
+HWY_API Vec512<uint8_t> ReorderDemote2To(Full512<uint8_t> /* tag */,
+                                         Vec512<int16_t> a, Vec512<int16_t> b) {
+  return Vec512<uint8_t>{_mm512_packus_epi16(a.raw, b.raw)};
+}
+
+HWY_API Vec512<int8_t> ReorderDemote2To(Full512<int8_t> /* tag */,
+                                        Vec512<int16_t> a, Vec512<int16_t> b) {
+  return Vec512<int8_t>{_mm512_packs_epi16(a.raw, b.raw)};
+}
+
+// ------------------------------ OrderedDemote2To
+
+template <typename TN, typename TW>
+HWY_API Vec512<TN> OrderedDemote2To(Full512<TN> dn, Vec512<TW> a,
+                                    Vec512<TW> b) {
+  const Full512<uint64_t> du64;
+  const Vec512<uint64_t> packed = BitCast(du64, ReorderDemote2To(dn, a, b));
+
+  // Gather the u64 groups from a (even) and then those from b (odd).
+  alignas(64) static constexpr uint64_t kLanes[8] = {0, 2, 4, 6, 1, 3, 5, 7};
+  const auto idx64 = Load(du64, kLanes);
+  return BitCast(
+      dn, Vec512<uint64_t>{_mm512_permutexvar_epi64(idx64.raw, packed.raw)});
+}
+
 // ------------------------------ Convert integer <=> floating point
 
 HWY_API Vec512<float> ConvertTo(Full512<float> /* tag */,
@@ -3259,9 +3922,9 @@ HWY_INLINE Vec512<uint64_t> MulEven(const Vec512<uint64_t> a,
   const auto aH = Shuffle2301(a32);
   const auto bH = Shuffle2301(b32);
 
-  // Knuth double-word multiplication. We use 32x32 = 64 MulEven and only need
-  // the even (lower 64 bits of every 128-bit block) results. See
-  // https://github.com/hcs0/Hackers-Delight/blob/master/muldwu.c.tat
+  // Knuth double-word multiplication, see detail::MulHigh64 in x86_128-inl.h.
+  // We use 32x32 = 64 MulEven and only need the even (lower 64 bits of every
+  // 128-bit block) results.
   const auto aLbL = MulEven(a32, b32);
   const auto w3 = aLbL & maskL;
 
@@ -3304,6 +3967,55 @@ HWY_INLINE Vec512<uint64_t> MulOdd(const Vec512<uint64_t> a,
   return InterleaveUpper(du64, mulL, mulH);
 }
 
+// ------------------------------ MulOdd/MulHigh 32-bit (MulEven)
+
+// Multiplies odd lanes (1, 3 ..) and places the double-wide result into even
+// and the upper half into its odd neighbor lane.
+HWY_API Vec512<int64_t> MulOdd(const Vec512<int32_t> a,
+                               const Vec512<int32_t> b) {
+  const Vec512<int32_t> a_x3x1{_mm512_srli_epi64(a.raw, 32)};
+  const Vec512<int32_t> b_x3x1{_mm512_srli_epi64(b.raw, 32)};
+  return MulEven(a_x3x1, b_x3x1);
+}
+HWY_API Vec512<uint64_t> MulOdd(const Vec512<uint32_t> a,
+                                const Vec512<uint32_t> b) {
+  const Vec512<uint32_t> a_x3x1{_mm512_srli_epi64(a.raw, 32)};
+  const Vec512<uint32_t> b_x3x1{_mm512_srli_epi64(b.raw, 32)};
+  return MulEven(a_x3x1, b_x3x1);
+}
+
+// Returns the upper 32 bits of a * b in each lane.
+HWY_API Vec512<uint32_t> MulHigh(const Vec512<uint32_t> a,
+                                 const Vec512<uint32_t> b) {
+  return detail::MulHigh32(a, b);
+}
+HWY_API Vec512<int32_t> MulHigh(const Vec512<int32_t> a,
+                                const Vec512<int32_t> b) {
+  return detail::MulHigh32(a, b);
+}
+
+// ------------------------------ Mul/MulHigh 64-bit (MulEven)
+
+HWY_API Vec512<uint64_t> operator*(const Vec512<uint64_t> a,
+                                   const Vec512<uint64_t> b) {
+  return Vec512<uint64_t>{_mm512_mullo_epi64(a.raw, b.raw)};
+}
+HWY_API Vec512<int64_t> operator*(const Vec512<int64_t> a,
+                                  const Vec512<int64_t> b) {
+  return Vec512<int64_t>{_mm512_mullo_epi64(a.raw, b.raw)};
+}
+
+// Returns the upper 64 bits of a * b in each lane. There is no native
+// instruction (IFMA only provides 52-bit products), so emulate.
+HWY_API Vec512<uint64_t> MulHigh(const Vec512<uint64_t> a,
+                                 const Vec512<uint64_t> b) {
+  return detail::MulHigh64(a, b);
+}
+HWY_API Vec512<int64_t> MulHigh(const Vec512<int64_t> a,
+                                const Vec512<int64_t> b) {
+  return detail::MulHighSigned64(a, b);
+}
+
 // ------------------------------ Reductions
 
 // Returns the sum in each lane.
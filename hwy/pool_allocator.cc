@@ -0,0 +1,243 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "hwy/pool_allocator.h"
+
+#include <stdint.h>
+#include <stdlib.h>  // malloc
+
+#include <atomic>
+#include <mutex>  // NOLINT
+
+#include "hwy/base.h"
+
+namespace hwy {
+namespace {
+
+// Precedes the memory returned by PoolAlloc. `next` is only used while the
+// block is in a FreeList.
+struct BlockHeader {
+  uint32_t size_class;
+  void* next;
+};
+
+// Keeps the alignment of malloc; AllocateAlignedBytes aligns further.
+constexpr size_t kHeaderBytes = 16;
+static_assert(sizeof(BlockHeader) <= kHeaderBytes, "Header too large");
+constexpr uint32_t kUnpooled = ~0u;
+
+// Class i holds blocks of (1 << (kMinClassBits + i)) bytes including header.
+constexpr uint32_t kMinClassBits = 6;
+constexpr uint32_t kMaxClassBits = 21;  // kMaxPoolBytes plus header
+constexpr uint32_t kNumClasses = kMaxClassBits - kMinClassBits + 1;
+static_assert((size_t{1} << kMaxClassBits) >= kMaxPoolBytes + kHeaderBytes,
+              "Largest class too small");
+
+// Each thread caches up to this many bytes per class (but at least two
+// blocks); beyond that, half of them are moved to the shared lists.
+constexpr size_t kMaxCachedBytes = 256 * 1024;
+
+size_t ClassBytes(uint32_t size_class) {
+  return size_t{1} << (kMinClassBits + size_class);
+}
+
+size_t MaxCached(uint32_t size_class) {
+  return HWY_MAX(kMaxCachedBytes / ClassBytes(size_class), size_t{2});
+}
+
+// Returns the smallest class whose blocks can hold `total` bytes.
+uint32_t ClassFor(size_t total) {
+  uint32_t bits = kMinClassBits;
+  while ((size_t{1} << bits) < total) ++bits;
+  return bits - kMinClassBits;
+}
+
+BlockHeader* Header(void* block) { return static_cast<BlockHeader*>(block); }
+
+// Intrusive singly-linked list of free blocks.
+class FreeList {
+ public:
+  bool Empty() const { return head_ == nullptr; }
+  size_t Count() const { return count_; }
+
+  void Push(void* block) {
+    Header(block)->next = head_;
+    head_ = block;
+    ++count_;
+  }
+
+  void* Pop() {
+    void* block = head_;
+    head_ = Header(block)->next;
+    --count_;
+    return block;
+  }
+
+  // Moves up to `num` blocks to `other`.
+  void MoveTo(FreeList* other, size_t num) {
+    for (; num != 0 && !Empty(); --num) {
+      other->Push(Pop());
+    }
+  }
+
+  void FreeAll() {
+    while (!Empty()) {
+      free(Pop());
+    }
+  }
+
+ private:
+  void* head_ = nullptr;
+  size_t count_ = 0;
+};
+
+// Blocks returned by threads that cache too many or exited.
+struct SharedLists {
+  // Must be called with `mutex` held after changing lists[size_class].
+  void UpdateCount(uint32_t size_class) {
+    counts[size_class].store(lists[size_class].Count(),
+                             std::memory_order_relaxed);
+  }
+
+  // Whether lists[size_class] might have blocks. Allows skipping the mutex,
+  // e.g. in threads that only allocate. A stale result is harmless because it
+  // only causes a malloc or an unnecessary lock.
+  bool MayHaveBlocks(uint32_t size_class) const {
+    return counts[size_class].load(std::memory_order_relaxed) != 0;
+  }
+
+  std::mutex mutex;
+  FreeList lists[kNumClasses];
+  std::atomic<size_t> counts[kNumClasses]{};
+};
+
+// Never destroyed because threads may exit after static destructors have run.
+SharedLists& Shared() {
+  static SharedLists* shared = new SharedLists;
+  return *shared;
+}
+
+// Set once the calling thread's cache is destroyed. Other thread_local
+// destructors may still allocate or free afterwards, and must then use the
+// shared lists. Trivially destructible, hence still accessible at that point.
+thread_local bool thread_cache_destroyed = false;
+
+struct ThreadCache {
+  ~ThreadCache() {
+    SharedLists& shared = Shared();
+    std::lock_guard<std::mutex> lock(shared.mutex);
+    for (uint32_t c = 0; c < kNumClasses; ++c) {
+      lists[c].MoveTo(&shared.lists[c], lists[c].Count());
+      shared.UpdateCount(c);
+    }
+    thread_cache_destroyed = true;
+  }
+
+  FreeList lists[kNumClasses];
+};
+
+thread_local ThreadCache thread_cache;
+
+// Used instead of thread_cache after it was destroyed.
+void* PopShared(uint32_t size_class) {
+  SharedLists& shared = Shared();
+  if (!shared.MayHaveBlocks(size_class)) return nullptr;
+  std::lock_guard<std::mutex> lock(shared.mutex);
+  FreeList& list = shared.lists[size_class];
+  if (list.Empty()) return nullptr;
+  void* block = list.Pop();
+  shared.UpdateCount(size_class);
+  return block;
+}
+
+void PushShared(void* block, uint32_t size_class) {
+  SharedLists& shared = Shared();
+  std::lock_guard<std::mutex> lock(shared.mutex);
+  shared.lists[size_class].Push(block);
+  shared.UpdateCount(size_class);
+}
+
+}  // namespace
+
+void* PoolAlloc(void* /*opaque*/, size_t bytes) {
+  if (bytes > kMaxPoolBytes) {
+    void* block = malloc(kHeaderBytes + bytes);
+    if (block == nullptr) return nullptr;
+    Header(block)->size_class = kUnpooled;
+    return static_cast<uint8_t*>(block) + kHeaderBytes;
+  }
+
+  const uint32_t size_class = ClassFor(kHeaderBytes + bytes);
+  void* block = nullptr;
+  if (HWY_UNLIKELY(thread_cache_destroyed)) {
+    block = PopShared(size_class);
+  } else {
+    FreeList& list = thread_cache.lists[size_class];
+    SharedLists& shared = Shared();
+    if (HWY_UNLIKELY(list.Empty()) && shared.MayHaveBlocks(size_class)) {
+      // Take half of the maximum so that the next frees do not immediately
+      // return them.
+      std::lock_guard<std::mutex> lock(shared.mutex);
+      shared.lists[size_class].MoveTo(&list, MaxCached(size_class) / 2);
+      shared.UpdateCount(size_class);
+    }
+    if (HWY_LIKELY(!list.Empty())) block = list.Pop();
+  }
+
+  if (block == nullptr) {
+    block = malloc(ClassBytes(size_class));
+    if (block == nullptr) return nullptr;
+    Header(block)->size_class = size_class;
+  }
+  return static_cast<uint8_t*>(block) + kHeaderBytes;
+}
+
+void PoolFree(void* /*opaque*/, void* memory) {
+  if (memory == nullptr) return;
+  void* block = static_cast<uint8_t*>(memory) - kHeaderBytes;
+  const uint32_t size_class = Header(block)->size_class;
+  if (size_class == kUnpooled) {
+    free(block);
+    return;
+  }
+  if (HWY_UNLIKELY(thread_cache_destroyed)) {
+    PushShared(block, size_class);
+    return;
+  }
+
+  FreeList& list = thread_cache.lists[size_class];
+  list.Push(block);
+  if (HWY_UNLIKELY(list.Count() > MaxCached(size_class))) {
+    SharedLists& shared = Shared();
+    std::lock_guard<std::mutex> lock(shared.mutex);
+    list.MoveTo(&shared.lists[size_class], list.Count() / 2);
+    shared.UpdateCount(size_class);
+  }
+}
+
+void TrimPool() {
+  if (!thread_cache_destroyed) {
+    for (FreeList& list : thread_cache.lists) {
+      list.FreeAll();
+    }
+  }
+  SharedLists& shared = Shared();
+  std::lock_guard<std::mutex> lock(shared.mutex);
+  for (uint32_t c = 0; c < kNumClasses; ++c) {
+    shared.lists[c].FreeAll();
+    shared.UpdateCount(c);
+  }
+}
+
+}  // namespace hwy
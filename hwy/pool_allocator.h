@@ -0,0 +1,49 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef HIGHWAY_HWY_POOL_ALLOCATOR_H_
+#define HIGHWAY_HWY_POOL_ALLOCATOR_H_
+
+// Process-wide pool with power-of-two size classes and per-thread caches, for
+// short-lived buffers that are frequently allocated and freed. It only replaces
+// the underlying malloc/free, hence AllocateAlignedBytes still applies its
+// alignment and per-allocation offsets.
+//
+// Example:
+//   auto scratch = hwy::AllocateAligned<float>(num, &hwy::PoolAlloc,
+//                                              &hwy::PoolFree, nullptr);
+// or, for all allocations:
+//   hwy::SetDefaultAllocator(&hwy::PoolAlloc, &hwy::PoolFree, nullptr);
+
+#include <stddef.h>
+
+namespace hwy {
+
+// Requests up to this size are served from size classes; larger ones are
+// passed through to malloc/free.
+static constexpr size_t kMaxPoolBytes = size_t{1} << 20;
+
+// AllocPtr and FreePtr for the pool; `opaque` is unused. Memory may be freed
+// by any thread, which then caches it for reuse. Thread-safe.
+void* PoolAlloc(void* opaque, size_t bytes);
+void PoolFree(void* opaque, void* memory);
+
+// Returns the blocks cached by the calling thread, and those shared between
+// threads, to malloc. Threads automatically return their cached blocks to the
+// shared lists when they exit.
+void TrimPool();
+
+}  // namespace hwy
+
+#endif  // HIGHWAY_HWY_POOL_ALLOCATOR_H_
@@ -0,0 +1,179 @@
+// Copyright 2021 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "hwy/pool_allocator.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <random>
+#include <set>
+#include <thread>  // NOLINT
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "hwy/aligned_allocator.h"
+#include "hwy/base.h"
+
+namespace hwy {
+namespace {
+
+TEST(PoolAllocatorTest, FreeNullptr) { PoolFree(nullptr, nullptr); }
+
+TEST(PoolAllocatorTest, Reuse) {
+  void* ptr1 = PoolAlloc(nullptr, 1000);
+  ASSERT_NE(nullptr, ptr1);
+  PoolFree(nullptr, ptr1);
+  // Same size class.
+  void* ptr2 = PoolAlloc(nullptr, 900);
+  EXPECT_EQ(ptr1, ptr2);
+  PoolFree(nullptr, ptr2);
+}
+
+TEST(PoolAllocatorTest, Sizes) {
+  for (size_t bytes = 1; bytes <= 4 * kMaxPoolBytes; bytes = bytes * 3 + 1) {
+    for (size_t delta : {size_t{0}, size_t{1}}) {
+      uint8_t* ptr = static_cast<uint8_t*>(PoolAlloc(nullptr, bytes + delta));
+      ASSERT_NE(nullptr, ptr);
+      memset(ptr, 0xAB, bytes + delta);
+      PoolFree(nullptr, ptr);
+    }
+  }
+  uint8_t* max = static_cast<uint8_t*>(PoolAlloc(nullptr, kMaxPoolBytes));
+  memset(max, 0xAB, kMaxPoolBytes);
+  PoolFree(nullptr, max);
+  TrimPool();
+}
+
+// AllocateAligned still aligns and staggers allocations that reuse a block.
+TEST(PoolAllocatorTest, Aligned) {
+  std::set<uintptr_t> addresses;
+  for (size_t i = 0; i < 16; ++i) {
+    auto ptr = AllocateAligned<float>(1000, &PoolAlloc, &PoolFree, nullptr);
+    const uintptr_t address = reinterpret_cast<uintptr_t>(ptr.get());
+    EXPECT_EQ(0u, address % HWY_ALIGNMENT);
+    addresses.insert(address);
+  }
+#if HWY_ARCH_X86
+  // The block is the same, but NextAlignedOffset varies.
+  EXPECT_GT(addresses.size(), 1u);
+#endif
+}
+
+struct Counted {
+  Counted() { ++constructed; }
+  ~Counted() { ++destroyed; }
+  static int constructed;
+  static int destroyed;
+  float data[7];
+};
+int Counted::constructed = 0;
+int Counted::destroyed = 0;
+
+TEST(PoolAllocatorTest, MakeUniqueAlignedArray) {
+  {
+    auto arr = MakeUniqueAlignedArrayWithAlloc<Counted>(10, &PoolAlloc,
+                                                        &PoolFree, nullptr);
+    EXPECT_EQ(10, Counted::constructed);
+  }
+  EXPECT_EQ(10, Counted::destroyed);
+}
+
+TEST(PoolAllocatorTest, DefaultAllocator) {
+  SetDefaultAllocator(&PoolAlloc, &PoolFree, nullptr);
+  void* ptr1 = AllocateAligned<int>(100).get();
+  void* ptr2 = AllocateAligned<int>(100).get();
+  SetDefaultAllocator(nullptr, nullptr, nullptr);
+  // Same block, possibly at a different offset.
+  EXPECT_LT(reinterpret_cast<uintptr_t>(ptr1) - 1024,
+            reinterpret_cast<uintptr_t>(ptr2));
+  EXPECT_LT(reinterpret_cast<uintptr_t>(ptr2),
+            reinterpret_cast<uintptr_t>(ptr1) + 1024);
+}
+
+// Allocations are freed by the same and other threads, and some threads exit
+// with cached blocks.
+TEST(PoolAllocatorTest, Threads) {
+  const size_t kThreads = 4;
+  const size_t kAllocs = 2000;
+  std::vector<std::vector<AlignedFreeUniquePtr<uint8_t[]>>> live(kThreads);
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < kThreads; ++t) {
+    threads.emplace_back([t, &live]() {
+      std::mt19937 rng(static_cast<uint32_t>(t));
+      std::uniform_int_distribution<size_t> dist(1, 70000);
+      for (size_t i = 0; i < kAllocs; ++i) {
+        const size_t bytes = dist(rng);
+        auto ptr = AllocateAligned<uint8_t>(bytes, &PoolAlloc, &PoolFree,
+                                            nullptr);
+        ASSERT_TRUE(ptr != nullptr);
+        memset(ptr.get(), static_cast<int>(t), bytes);
+        ASSERT_EQ(static_cast<uint8_t>(t), ptr[bytes - 1]);
+        if (i % 8 == 0) live[t].push_back(std::move(ptr));
+      }
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  live.clear();
+  TrimPool();
+}
+
+// Frees and allocates in its destructor, which runs after that of the pool's
+// thread cache because it was constructed first.
+struct FreeOnThreadExit {
+  ~FreeOnThreadExit() {
+    PoolFree(nullptr, memory);
+    uint8_t* ptr = static_cast<uint8_t*>(PoolAlloc(nullptr, 1000));
+    if (ptr == nullptr) return;
+    memset(ptr, 0xAB, 1000);
+    PoolFree(nullptr, ptr);
+    last_freed = ptr;
+  }
+  void* memory = nullptr;
+  static void* last_freed;
+};
+void* FreeOnThreadExit::last_freed = nullptr;
+
+TEST(PoolAllocatorTest, AfterThreadCacheDestroyed) {
+  TrimPool();
+  for (int i = 0; i < 4; ++i) {
+    std::thread thread([]() {
+      thread_local FreeOnThreadExit free_on_exit;
+      free_on_exit.memory = PoolAlloc(nullptr, 1000);
+      ASSERT_NE(nullptr, free_on_exit.memory);
+    });
+    thread.join();
+  }
+  // The last block went to the shared lists, from which a new thread (with
+  // an empty cache) takes it.
+  std::thread thread([]() {
+    void* ptr = PoolAlloc(nullptr, 1000);
+    EXPECT_EQ(FreeOnThreadExit::last_freed, ptr);
+    PoolFree(nullptr, ptr);
+  });
+  thread.join();
+  TrimPool();
+}
+
+}  // namespace
+}  // namespace hwy
+
+// Ought not to be necessary, but without this, no tests run on RVV.
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
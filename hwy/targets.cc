@@ -17,10 +17,13 @@
 #include <stdarg.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
 #include <atomic>
 #include <cstddef>
 #include <limits>
+#include <thread>  // NOLINT
 
 #if defined(ADDRESS_SANITIZER) || defined(MEMORY_SANITIZER) || \
     defined(THREAD_SANITIZER)
@@ -121,9 +124,11 @@ enum class FeatureIndex : uint32_t {
   kAVX512VL,
   kAVX512DQ,
   kAVX512BW,
+  kAVX512CD,
 
   kVNNI,
   kVPCLMULQDQ,
+  kVBMI,
   kVBMI2,
   kVAES,
   kPOPCNTDQ,
@@ -170,17 +175,211 @@ constexpr uint64_t kGroupAVX2 =
 
 constexpr uint64_t kGroupAVX3 =
     Bit(FeatureIndex::kAVX512F) | Bit(FeatureIndex::kAVX512VL) |
-    Bit(FeatureIndex::kAVX512DQ) | Bit(FeatureIndex::kAVX512BW) | kGroupAVX2;
+    Bit(FeatureIndex::kAVX512DQ) | Bit(FeatureIndex::kAVX512BW) |
+    Bit(FeatureIndex::kAVX512CD) | kGroupAVX2;
 
 constexpr uint64_t kGroupAVX3_DL =
     Bit(FeatureIndex::kVNNI) | Bit(FeatureIndex::kVPCLMULQDQ) |
-    Bit(FeatureIndex::kVBMI2) | Bit(FeatureIndex::kVAES) |
-    Bit(FeatureIndex::kPOPCNTDQ) | Bit(FeatureIndex::kBITALG) | kGroupAVX3;
+    Bit(FeatureIndex::kVBMI) | Bit(FeatureIndex::kVBMI2) |
+    Bit(FeatureIndex::kVAES) | Bit(FeatureIndex::kPOPCNTDQ) |
+    Bit(FeatureIndex::kBITALG) | kGroupAVX3;
+
+// Appends the caches reported by CPUID leaf 4 (Intel) or 0x8000001D (AMD),
+// which share the same layout.
+void DetectCachesX86(CpuInfo* info) {
+  uint32_t abcd[4];
+  Cpuid(0, 0, abcd);
+  const uint32_t max_level = abcd[0];
+  // "AuthenticAMD" or "HygonGenuine"
+  const bool is_amd = abcd[1] == 0x68747541 || abcd[1] == 0x6F677948;
+
+  uint32_t leaf = 4;
+  if (is_amd) {
+    Cpuid(0x80000000U, 0, abcd);
+    if (abcd[0] < 0x8000001DU) return;
+    Cpuid(0x80000001U, 0, abcd);
+    if (!IsBitSet(abcd[2], 22)) return;  // TopologyExtensions
+    leaf = 0x8000001DU;
+  } else if (max_level < 4) {
+    return;
+  }
+
+  for (uint32_t index = 0; info->num_caches < CpuInfo::kMaxCaches; ++index) {
+    Cpuid(leaf, index, abcd);
+    const uint32_t type = abcd[0] & 0x1F;
+    if (type == 0 || type > 3) break;  // no more caches
+    CacheInfo& cache = info->caches[info->num_caches++];
+    cache.level = (abcd[0] >> 5) & 7;
+    cache.type = static_cast<CacheInfo::Type>(type);
+    cache.line_bytes = (abcd[1] & 0xFFF) + 1;
+    const uint32_t partitions = ((abcd[1] >> 12) & 0x3FF) + 1;
+    const uint32_t ways = (abcd[1] >> 22) + 1;
+    const uint32_t sets = abcd[2] + 1;
+    cache.associativity = IsBitSet(abcd[0], 9) ? 0 : ways;
+    cache.cores_sharing = ((abcd[0] >> 14) & 0xFFF) + 1;
+    cache.bytes = size_t(ways) * partitions * cache.line_bytes * sets;
+  }
+}
+
+void DetectModelX86(CpuInfo* info) {
+  uint32_t abcd[4];
+  Cpuid(0, 0, abcd);
+  if (abcd[0] < 1) return;
+  char vendor[13];
+  CopyBytes<4>(&abcd[1], vendor + 0);
+  CopyBytes<4>(&abcd[3], vendor + 4);
+  CopyBytes<4>(&abcd[2], vendor + 8);
+  vendor[12] = '\0';
+  for (char& c : vendor) {
+    if (c == ' ') c = '_';  // e.g. "  Shanghai  "
+  }
+
+  Cpuid(1, 0, abcd);
+  uint32_t family = (abcd[0] >> 8) & 0xF;
+  uint32_t model = (abcd[0] >> 4) & 0xF;
+  if (family == 6 || family == 0xF) model |= ((abcd[0] >> 16) & 0xF) << 4;
+  if (family == 0xF) family += (abcd[0] >> 20) & 0xFF;
+  snprintf(info->model, sizeof(info->model), "%s %u.%u.%u", vendor, family,
+           model, abcd[0] & 0xF);
+}
+
+// Returns the number of hardware threads per core according to the SMT level
+// of CPUID leaf 0xB, or 0 if unknown.
+size_t DetectSMTX86() {
+  uint32_t abcd[4];
+  Cpuid(0, 0, abcd);
+  if (abcd[0] < 0xB) return 0;
+  Cpuid(0xB, 0, abcd);
+  const uint32_t level_type = (abcd[2] >> 8) & 0xFF;
+  if (level_type != 1) return 0;  // not the SMT level
+  return abcd[1] & 0xFFFF;
+}
 
 #endif  // HWY_ARCH_X86
 
+#if defined(__linux__)
+
+// Reads the first line of a (small) sysfs file without its newline. Returns
+// false if the file does not exist or is empty.
+bool ReadSysfs(const char* path, char* buf, size_t size) {
+  FILE* f = fopen(path, "r");
+  if (f == nullptr) return false;
+  const bool ok = fgets(buf, static_cast<int>(size), f) != nullptr;
+  fclose(f);
+  if (!ok) return false;
+  buf[strcspn(buf, "\n")] = '\0';
+  return buf[0] != '\0';
+}
+
+size_t ReadSysfsNumber(const char* path) {
+  char buf[64];
+  if (!ReadSysfs(path, buf, sizeof(buf))) return 0;
+  unsigned long long value = 0;
+  char suffix = '\0';
+  if (sscanf(buf, "%llu%c", &value, &suffix) < 1) return 0;
+  if (suffix == 'K') value <<= 10;
+  if (suffix == 'M') value <<= 20;
+  if (suffix == 'G') value <<= 30;
+  return static_cast<size_t>(value);
+}
+
+// Returns the number of entries in a sysfs list such as "0-3,8,10-11".
+size_t ReadSysfsListCount(const char* path) {
+  char buf[1024];
+  if (!ReadSysfs(path, buf, sizeof(buf))) return 0;
+  size_t count = 0;
+  const char* pos = buf;
+  for (;;) {
+    char* end;
+    const unsigned long first = strtoul(pos, &end, 10);
+    if (end == pos) return count;  // not a number
+    unsigned long last = first;
+    if (*end == '-') {
+      pos = end + 1;
+      last = strtoul(pos, &end, 10);
+      if (end == pos || last < first) return count;
+    }
+    count += last - first + 1;
+    if (*end != ',') return count;
+    pos = end + 1;
+  }
+}
+
+void DetectCachesSysfs(CpuInfo* info) {
+  char path[128];
+  char type[32];
+  for (size_t index = 0; info->num_caches < CpuInfo::kMaxCaches; ++index) {
+    const int len = snprintf(path, sizeof(path),
+                             "/sys/devices/system/cpu/cpu0/cache/index%zu/",
+                             index);
+    char* const file = path + len;
+    const size_t file_size = sizeof(path) - static_cast<size_t>(len);
+
+    snprintf(file, file_size, "type");
+    if (!ReadSysfs(path, type, sizeof(type))) break;  // no more caches
+    CacheInfo& cache = info->caches[info->num_caches++];
+    cache.type = CacheInfo::Type::kUnified;
+    if (strcmp(type, "Data") == 0) cache.type = CacheInfo::Type::kData;
+    if (strcmp(type, "Instruction") == 0) {
+      cache.type = CacheInfo::Type::kInstruction;
+    }
+    snprintf(file, file_size, "level");
+    cache.level = static_cast<uint32_t>(ReadSysfsNumber(path));
+    snprintf(file, file_size, "coherency_line_size");
+    cache.line_bytes = static_cast<uint32_t>(ReadSysfsNumber(path));
+    snprintf(file, file_size, "ways_of_associativity");
+    cache.associativity = static_cast<uint32_t>(ReadSysfsNumber(path));
+    snprintf(file, file_size, "shared_cpu_list");
+    cache.cores_sharing = static_cast<uint32_t>(ReadSysfsListCount(path));
+    snprintf(file, file_size, "size");
+    cache.bytes = ReadSysfsNumber(path);
+  }
+}
+
+#endif  // __linux__
+
+CpuInfo DetectCpuInfo() {
+  CpuInfo info = {};
+
+#if HWY_ARCH_X86
+  DetectCachesX86(&info);
+  info.smt_per_core = DetectSMTX86();
+  DetectModelX86(&info);
+#endif
+
+#if defined(__linux__)
+  if (info.num_caches == 0) DetectCachesSysfs(&info);
+  if (info.smt_per_core == 0) {
+    info.smt_per_core = ReadSysfsListCount(
+        "/sys/devices/system/cpu/cpu0/topology/thread_siblings_list");
+  }
+  info.numa_nodes = ReadSysfsListCount("/sys/devices/system/node/online");
+  if (info.model[0] == '\0') {
+    char midr[32];
+    if (ReadSysfs("/sys/devices/system/cpu/cpu0/regs/identification/midr_el1",
+                  midr, sizeof(midr))) {
+      snprintf(info.model, sizeof(info.model), "MIDR %s", midr);
+    }
+  }
+#endif
+
+  info.logical_cores = std::thread::hardware_concurrency();
+  if (info.smt_per_core != 0 && info.logical_cores != 0) {
+    info.physical_cores =
+        HWY_MAX(info.logical_cores / info.smt_per_core, size_t{1});
+  }
+  return info;
+}
+
 }  // namespace
 
+constexpr size_t CpuInfo::kMaxCaches;
+
+const CpuInfo& GetCpuInfo() {
+  static const CpuInfo info = DetectCpuInfo();
+  return info;
+}
+
 HWY_NORETURN void HWY_FORMAT(3, 4)
     Abort(const char* file, int line, const char* format, ...) {
   char buf[2000];
@@ -280,9 +479,11 @@ uint32_t SupportedTargets() {
 
       flags |= IsBitSet(abcd[1], 16) ? Bit(FeatureIndex::kAVX512F) : 0;
       flags |= IsBitSet(abcd[1], 17) ? Bit(FeatureIndex::kAVX512DQ) : 0;
+      flags |= IsBitSet(abcd[1], 28) ? Bit(FeatureIndex::kAVX512CD) : 0;
       flags |= IsBitSet(abcd[1], 30) ? Bit(FeatureIndex::kAVX512BW) : 0;
       flags |= IsBitSet(abcd[1], 31) ? Bit(FeatureIndex::kAVX512VL) : 0;
 
+      flags |= IsBitSet(abcd[2], 1) ? Bit(FeatureIndex::kVBMI) : 0;
       flags |= IsBitSet(abcd[2], 6) ? Bit(FeatureIndex::kVBMI2) : 0;
       flags |= IsBitSet(abcd[2], 9) ? Bit(FeatureIndex::kVAES) : 0;
       flags |= IsBitSet(abcd[2], 10) ? Bit(FeatureIndex::kVPCLMULQDQ) : 0;
@@ -322,8 +523,8 @@ uint32_t SupportedTargets() {
     if (!IsBitSet(xcr0, 2)) {
       bits &= ~uint32_t(HWY_AVX2 | HWY_AVX3 | HWY_AVX3_DL);
     }
-    // ZMM + opmask
-    if ((xcr0 & 0x70) != 0x70) {
+    // opmask, ZMM_Hi256 and Hi16_ZMM state (bits 5-7)
+    if ((xcr0 & 0xE0) != 0xE0) {
       bits &= ~uint32_t(HWY_AVX3 | HWY_AVX3_DL);
     }
   }
@@ -342,6 +543,39 @@ uint32_t SupportedTargets() {
   return bits & supported_mask_;
 }
 
+namespace detail {
+
+// Declared in targets.h
+std::atomic<uint32_t> num_target_overrides{0};
+
+void SetFunctionTargets(std::atomic<uint32_t>* function_targets,
+                        uint32_t targets) {
+  const uint32_t prev = function_targets->exchange(targets);
+  if (prev == 0 && targets != 0) num_target_overrides.fetch_add(1);
+  if (prev != 0 && targets == 0) num_target_overrides.fetch_sub(1);
+}
+
+}  // namespace detail
+
+namespace {
+
+// Not a class with destructor (which could decrement num_target_overrides when
+// the thread exits) because that would prevent using a fast TLS access model.
+// Threads exiting with a restriction merely cause other threads to keep
+// checking for restrictions.
+thread_local uint32_t thread_targets = 0;
+
+}  // namespace
+
+void SetThreadTargets(uint32_t targets) {
+  const uint32_t prev = thread_targets;
+  thread_targets = targets;
+  if (prev == 0 && targets != 0) detail::num_target_overrides.fetch_add(1);
+  if (prev != 0 && targets == 0) detail::num_target_overrides.fetch_sub(1);
+}
+
+uint32_t GetThreadTargets() { return thread_targets; }
+
 // Declared in targets.h
 ChosenTarget chosen_target;
 
@@ -58,6 +58,17 @@ void SetSupportedTargetsForTest(uint32_t targets);
 // SetSupportedTargetsForTest() call.
 bool SupportedTargetsCalledForTest();
 
+// Restricts HWY_DYNAMIC_DISPATCH in the calling thread to the given mask of
+// targets, e.g. to keep latency-critical threads on AVX2 while others use
+// AVX3. Call with 0 to remove the restriction. If none of the targets are
+// supported and compiled, the restriction is ignored. Functions exported via
+// HWY_EXPORT_CACHED or HWY_EXPORT_AUTOTUNED resolve their target only once for
+// all threads and thus ignore this.
+void SetThreadTargets(uint32_t targets);
+
+// Returns the mask set by SetThreadTargets for the calling thread, or 0.
+uint32_t GetThreadTargets();
+
 // Return the list of targets in HWY_TARGETS supported by the CPU as a list of
 // individual HWY_* target macros such as HWY_SCALAR or HWY_NEON. This list
 // is affected by the current SetSupportedTargetsForTest() mock if any.
@@ -118,6 +129,60 @@ static inline HWY_MAYBE_UNUSED const char* TargetName(uint32_t target) {
   }
 }
 
+// Properties of one cache as seen by a core. Fields are 0 if unknown.
+struct CacheInfo {
+  enum class Type : uint32_t { kData = 1, kInstruction, kUnified };
+
+  uint32_t level;  // 1 for L1 etc.
+  Type type;
+  uint32_t line_bytes;
+  uint32_t associativity;  // number of ways, 0 if fully associative/unknown
+  uint32_t cores_sharing;  // upper bound on logical cores sharing this cache
+  size_t bytes;
+};
+
+// CPU properties for choosing block sizes and thread counts at runtime. Fields
+// are 0 if unknown.
+struct CpuInfo {
+  static constexpr size_t kMaxCaches = 8;
+
+  // Returns the data or unified cache at "level", or nullptr if unknown.
+  const CacheInfo* DataCache(uint32_t level) const {
+    for (size_t i = 0; i < num_caches; ++i) {
+      if (caches[i].level == level &&
+          caches[i].type != CacheInfo::Type::kInstruction) {
+        return &caches[i];
+      }
+    }
+    return nullptr;
+  }
+
+  // Returns the size of the data or unified cache at "level", or "fallback" if
+  // unknown. Example: DataCacheBytes(2, 256 * 1024).
+  size_t DataCacheBytes(uint32_t level, size_t fallback) const {
+    const CacheInfo* cache = DataCache(level);
+    return (cache == nullptr || cache->bytes == 0) ? fallback : cache->bytes;
+  }
+
+  // In ascending order of level, as reported by the CPU or OS.
+  CacheInfo caches[kMaxCaches];
+  size_t num_caches;
+
+  size_t logical_cores;   // online hardware threads
+  size_t physical_cores;  // logical_cores / smt_per_core
+  size_t smt_per_core;    // hardware threads per core (SMT siblings)
+  size_t numa_nodes;
+
+  // Identifies the CPU model, e.g. "GenuineIntel 6.85.7" (vendor and CPUID
+  // family.model.stepping) on x86 or the MIDR_EL1 register on Arm Linux. Empty
+  // if unknown. Contains no whitespace other than the space after the vendor.
+  char model[48];
+};
+
+// Returns the properties of the current CPU. Detected on the first call via
+// CPUID on x86 and/or sysfs on Linux, then cached. Thread-safe.
+const CpuInfo& GetCpuInfo();
+
 // The maximum number of dynamic targets on any architecture is defined by
 // HWY_MAX_DYNAMIC_TARGETS and depends on the arch.
 
@@ -221,6 +286,28 @@ static inline HWY_MAYBE_UNUSED const char* TargetName(uint32_t target) {
 #define HWY_HIGHEST_TARGET_BIT HWY_HIGHEST_TARGET_BIT_SCALAR
 #endif
 
+namespace detail {
+
+// Number of threads and exported functions with a target restriction. While
+// zero, HWY_DYNAMIC_DISPATCH does not need to check for restrictions.
+extern std::atomic<uint32_t> num_target_overrides;
+
+// Sets the restriction of an exported function, see HWY_SET_DISPATCH_TARGETS.
+void SetFunctionTargets(std::atomic<uint32_t>* function_targets,
+                        uint32_t targets);
+
+// Returns the ChosenTarget-format "mask" restricted to "targets" (a mask of
+// HWY_* bits), or "mask" if this would leave no target.
+static HWY_INLINE uint32_t RestrictChosenMask(uint32_t mask, uint32_t targets) {
+  const uint32_t shifted =
+      HWY_CHOSEN_TARGET_SHIFT(targets) |
+      ((targets & HWY_SCALAR) ? HWY_CHOSEN_TARGET_MASK_SCALAR : 0u);
+  const uint32_t restricted = mask & shifted;
+  return restricted == 0 ? mask : restricted;
+}
+
+}  // namespace detail
+
 struct ChosenTarget {
  public:
   // Update the ChosenTarget mask based on the current CPU supported
@@ -244,7 +331,36 @@ struct ChosenTarget {
                                               HWY_CHOSEN_TARGET_MASK_TARGETS);
   }
 
+  // Same as GetIndex(), but also honors the SetThreadTargets restriction of the
+  // calling thread and "function_targets" (set by HWY_SET_DISPATCH_TARGETS).
+  // Without any restrictions, this only adds one load and branch.
+  size_t HWY_INLINE
+  GetIndex(const std::atomic<uint32_t>& function_targets) const {
+    uint32_t mask = mask_.load() & HWY_CHOSEN_TARGET_MASK_TARGETS;
+    if (HWY_UNLIKELY(detail::num_target_overrides.load(
+                         std::memory_order_relaxed) != 0)) {
+      mask = RestrictMask(
+          mask, function_targets.load(std::memory_order_relaxed));
+    }
+    return hwy::Num0BitsBelowLS1Bit_Nonzero32(mask);
+  }
+
  private:
+  // Applies the function and thread restrictions, if any. The function's takes
+  // precedence if they are disjoint. The uninitialized mask (1) is unaffected
+  // because no restriction includes its bit.
+  static HWY_INLINE uint32_t RestrictMask(uint32_t mask,
+                                          uint32_t function_targets) {
+    if (function_targets != 0) {
+      mask = detail::RestrictChosenMask(mask, function_targets);
+    }
+    const uint32_t thread_targets = GetThreadTargets();
+    if (thread_targets != 0) {
+      mask = detail::RestrictChosenMask(mask, thread_targets);
+    }
+    return mask;
+  }
+
   // Initialized to 1 so GetChosenTargetIndex() returns 0.
   std::atomic<uint32_t> mask_{1};
 };
@@ -14,13 +14,19 @@
 
 #include "hwy/targets.h"
 
+#include <string.h>
+
+#include <thread>  // NOLINT
+
 #include "hwy/tests/test_util-inl.h"
 
 namespace fake {
 
-#define DECLARE_FUNCTION(TGT)                        \
-  namespace N_##TGT {                                \
-    uint32_t FakeFunction(int) { return HWY_##TGT; } \
+#define DECLARE_FUNCTION(TGT)                                  \
+  namespace N_##TGT {                                          \
+    uint32_t FakeFunction(int) { return HWY_##TGT; }           \
+    uint32_t FakeCachedFunction(int) { return HWY_##TGT; }     \
+    uint32_t FakeRestrictedFunction(int) { return HWY_##TGT; } \
   }
 
 DECLARE_FUNCTION(AVX3_DL)
@@ -37,6 +43,8 @@ DECLARE_FUNCTION(RVV)
 DECLARE_FUNCTION(SCALAR)
 
 HWY_EXPORT(FakeFunction);
+HWY_EXPORT_CACHED(FakeCachedFunction);
+HWY_EXPORT(FakeRestrictedFunction);
 
 void CheckFakeFunction() {
 #define CHECK_ARRAY_ENTRY(TGT)                                              \
@@ -68,6 +76,113 @@ void CheckFakeFunction() {
 #undef CHECK_ARRAY_ENTRY
 }
 
+void CheckFakeCachedFunction() {
+#define CHECK_CACHED_ENTRY(TGT)                                              \
+  if ((HWY_TARGETS & HWY_##TGT) != 0) {                                      \
+    hwy::SetSupportedTargetsForTest(HWY_##TGT);                              \
+    /* The first call resolves the pointer and initializes chosen_target. */ \
+    hwy::chosen_target.DeInit();                                             \
+    HWY_RESET_CACHED_DISPATCH(FakeCachedFunction);                           \
+    EXPECT_EQ(uint32_t(HWY_##TGT),                                           \
+              HWY_CACHED_DISPATCH(FakeCachedFunction)(42));                  \
+    EXPECT_TRUE(hwy::chosen_target.IsInitialized());                         \
+    /* Second call goes directly through the cached pointer. */              \
+    EXPECT_EQ(uint32_t(HWY_##TGT),                                           \
+              HWY_CACHED_DISPATCH(FakeCachedFunction)(42));                  \
+  }
+  CHECK_CACHED_ENTRY(AVX3_DL)
+  CHECK_CACHED_ENTRY(AVX3)
+  CHECK_CACHED_ENTRY(AVX2)
+  CHECK_CACHED_ENTRY(SSE4)
+  CHECK_CACHED_ENTRY(SSSE3)
+  CHECK_CACHED_ENTRY(NEON)
+  CHECK_CACHED_ENTRY(SVE)
+  CHECK_CACHED_ENTRY(SVE2)
+  CHECK_CACHED_ENTRY(PPC8)
+  CHECK_CACHED_ENTRY(WASM)
+  CHECK_CACHED_ENTRY(RVV)
+  CHECK_CACHED_ENTRY(SCALAR)
+#undef CHECK_CACHED_ENTRY
+}
+
+void CheckCachedDispatchIgnoresLaterChanges() {
+  const uint32_t targets = hwy::SupportedTargets() & HWY_TARGETS;
+  if ((targets & (targets - 1)) == 0) return;  // Only one target.
+  const uint32_t best = targets & (~targets + 1);
+  const uint32_t others = targets & (targets - 1);
+  const uint32_t second = others & (~others + 1);
+
+  hwy::SetSupportedTargetsForTest(best);
+  hwy::chosen_target.DeInit();
+  HWY_RESET_CACHED_DISPATCH(FakeCachedFunction);
+  EXPECT_EQ(best, HWY_CACHED_DISPATCH(FakeCachedFunction)(42));
+
+  // Changing the targets does not affect the pointer until it is reset.
+  hwy::SetSupportedTargetsForTest(second);
+  hwy::chosen_target.Update();
+  EXPECT_EQ(best, HWY_CACHED_DISPATCH(FakeCachedFunction)(42));
+  EXPECT_EQ(second, HWY_DYNAMIC_DISPATCH(FakeFunction)(42));
+  HWY_RESET_CACHED_DISPATCH(FakeCachedFunction);
+  EXPECT_EQ(second, HWY_CACHED_DISPATCH(FakeCachedFunction)(42));
+}
+
+void CheckThreadTargets() {
+  const uint32_t targets = hwy::SupportedTargets() & HWY_TARGETS;
+  if ((targets & (targets - 1)) == 0) return;  // Only one target.
+  const uint32_t best = targets & (~targets + 1);
+
+  for (uint32_t rest = targets; rest != 0; rest &= rest - 1) {
+    const uint32_t target = rest & (~rest + 1);
+    hwy::SetThreadTargets(target);
+    hwy::chosen_target.Update();
+    EXPECT_EQ(target, HWY_DYNAMIC_DISPATCH(FakeFunction)(42));
+    // Also when the first call initializes the chosen target.
+    hwy::chosen_target.DeInit();
+    EXPECT_EQ(target, HWY_DYNAMIC_DISPATCH(FakeFunction)(42));
+
+    // Other threads are unaffected.
+    uint32_t other = 0;
+    std::thread thread([&other]() {
+      EXPECT_EQ(0u, hwy::GetThreadTargets());
+      other = HWY_DYNAMIC_DISPATCH(FakeFunction)(42);
+    });
+    thread.join();
+    EXPECT_EQ(best, other);
+  }
+
+  // Unsupported or uncompiled targets are ignored.
+  hwy::SetThreadTargets(~targets & ~uint32_t(HWY_SCALAR));
+  EXPECT_EQ(best, HWY_DYNAMIC_DISPATCH(FakeFunction)(42));
+
+  hwy::SetThreadTargets(0);
+  EXPECT_EQ(0u, hwy::detail::num_target_overrides.load());
+  EXPECT_EQ(best, HWY_DYNAMIC_DISPATCH(FakeFunction)(42));
+}
+
+void CheckFunctionTargets() {
+  const uint32_t targets = hwy::SupportedTargets() & HWY_TARGETS;
+  if ((targets & (targets - 1)) == 0) return;  // Only one target.
+  const uint32_t best = targets & (~targets + 1);
+  const uint32_t others = targets & (targets - 1);
+  const uint32_t second = others & (~others + 1);
+
+  hwy::chosen_target.Update();
+  HWY_SET_DISPATCH_TARGETS(FakeRestrictedFunction, second);
+  EXPECT_EQ(second, HWY_DYNAMIC_DISPATCH(FakeRestrictedFunction)(42));
+  // Other functions are unaffected.
+  EXPECT_EQ(best, HWY_DYNAMIC_DISPATCH(FakeFunction)(42));
+
+  // The function restriction takes precedence over a disjoint thread one.
+  hwy::SetThreadTargets(best);
+  EXPECT_EQ(second, HWY_DYNAMIC_DISPATCH(FakeRestrictedFunction)(42));
+  EXPECT_EQ(best, HWY_DYNAMIC_DISPATCH(FakeFunction)(42));
+  hwy::SetThreadTargets(0);
+
+  HWY_SET_DISPATCH_TARGETS(FakeRestrictedFunction, 0);
+  EXPECT_EQ(0u, hwy::detail::num_target_overrides.load());
+  EXPECT_EQ(best, HWY_DYNAMIC_DISPATCH(FakeRestrictedFunction)(42));
+}
+
 }  // namespace fake
 
 namespace hwy {
@@ -85,6 +200,16 @@ class HwyTargetsTest : public testing::Test {
 // enabled in the current compilation.
 TEST_F(HwyTargetsTest, ChosenTargetOrderTest) { fake::CheckFakeFunction(); }
 
+// Same for HWY_EXPORT_CACHED, whose pointer is resolved via the same table.
+TEST_F(HwyTargetsTest, CachedDispatchTest) {
+  fake::CheckFakeCachedFunction();
+  fake::CheckCachedDispatchIgnoresLaterChanges();
+}
+
+// SetThreadTargets and HWY_SET_DISPATCH_TARGETS restrict HWY_DYNAMIC_DISPATCH.
+TEST_F(HwyTargetsTest, ThreadTargetsTest) { fake::CheckThreadTargets(); }
+TEST_F(HwyTargetsTest, FunctionTargetsTest) { fake::CheckFunctionTargets(); }
+
 TEST_F(HwyTargetsTest, DisabledTargetsTest) {
   DisableTargets(~0u);
   // Check that the baseline can't be disabled.
@@ -107,6 +232,50 @@ TEST_F(HwyTargetsTest, DisabledTargetsTest) {
   DisableTargets(0);  // Reset the mask.
 }
 
+TEST(HwyTargetsCpuInfoTest, TestCpuInfo) {
+  const CpuInfo& info = GetCpuInfo();
+  // Cached: returns the same object.
+  EXPECT_EQ(&info, &GetCpuInfo());
+
+  EXPECT_LE(info.num_caches, CpuInfo::kMaxCaches);
+  uint32_t prev_level = 0;
+  for (size_t i = 0; i < info.num_caches; ++i) {
+    const CacheInfo& cache = info.caches[i];
+    EXPECT_LE(prev_level, cache.level);
+    prev_level = cache.level;
+    if (cache.line_bytes != 0) {
+      EXPECT_TRUE((cache.line_bytes & (cache.line_bytes - 1)) == 0);
+      EXPECT_LE(cache.line_bytes, cache.bytes);
+    }
+  }
+  const CacheInfo* l1 = info.DataCache(1);
+  if (l1 != nullptr) {
+    EXPECT_NE(CacheInfo::Type::kInstruction, l1->type);
+    EXPECT_EQ(l1->bytes, info.DataCacheBytes(1, 0));
+  }
+  EXPECT_EQ(123u, info.DataCacheBytes(99, 123));
+
+  if (info.physical_cores != 0) {
+    EXPECT_LE(info.physical_cores, info.logical_cores);
+    EXPECT_NE(0u, info.smt_per_core);
+  }
+
+  EXPECT_LT(strlen(info.model), sizeof(info.model));
+#if HWY_ARCH_X86
+  EXPECT_NE('\0', info.model[0]);
+#endif
+
+  fprintf(stderr, "%s: %zu logical, %zu physical cores, SMT %zu, %zu NUMA "
+          "nodes\n", info.model, info.logical_cores, info.physical_cores,
+          info.smt_per_core, info.numa_nodes);
+  for (size_t i = 0; i < info.num_caches; ++i) {
+    const CacheInfo& cache = info.caches[i];
+    fprintf(stderr, "L%u type %u: %zu KiB, line %u, %u-way, shared by %u\n",
+            cache.level, static_cast<uint32_t>(cache.type), cache.bytes >> 10,
+            cache.line_bytes, cache.associativity, cache.cores_sharing);
+  }
+}
+
 }  // namespace hwy
 
 // Ought not to be necessary, but without this, no tests run on RVV.
@@ -16,6 +16,7 @@
 #include <stdint.h>
 
 #include <algorithm>
+#include <cmath>
 #include <limits>
 
 #undef HWY_TARGET_INCLUDE
@@ -598,6 +599,115 @@ HWY_NOINLINE void TestAllMinMax() {
   ForFloatTypes(ForPartialVectors<TestFloatMinMax>());
 }
 
+struct TestMaskedArith {
+  template <typename T, class D>
+  HWY_NOINLINE void operator()(T /*unused*/, D d) {
+    RandomState rng;
+
+    using TI = MakeSigned<T>;  // For mask > 0 comparison
+    const Rebind<TI, D> di;
+    const size_t N = Lanes(d);
+    auto bool_lanes = AllocateAligned<TI>(N);
+
+    const auto no = Set(d, T{7});
+    const auto a = Iota(d, T{3});
+    const auto b = Set(d, T{2});
+
+    // Each lane should have a chance of having mask=true.
+    for (size_t rep = 0; rep < 50; ++rep) {
+      for (size_t i = 0; i < N; ++i) {
+        bool_lanes[i] = (Random32(&rng) & 1024) ? TI(1) : TI(0);
+      }
+      const auto m = RebindMask(d, Gt(Load(di, bool_lanes.get()), Zero(di)));
+
+      HWY_ASSERT_VEC_EQ(d, IfThenElse(m, Add(a, b), no),
+                        MaskedAddOr(no, m, a, b));
+      HWY_ASSERT_VEC_EQ(d, IfThenElse(m, Sub(a, b), no),
+                        MaskedSubOr(no, m, a, b));
+      HWY_ASSERT_VEC_EQ(d, IfThenElse(m, Min(a, b), no),
+                        MaskedMinOr(no, m, a, b));
+      HWY_ASSERT_VEC_EQ(d, IfThenElse(m, Max(a, b), no),
+                        MaskedMaxOr(no, m, a, b));
+
+      HWY_ASSERT_VEC_EQ(d, IfThenElseZero(m, Add(a, b)), MaskedAdd(m, a, b));
+      HWY_ASSERT_VEC_EQ(d, IfThenElseZero(m, Sub(a, b)), MaskedSub(m, a, b));
+      HWY_ASSERT_VEC_EQ(d, IfThenElseZero(m, Min(a, b)), MaskedMin(m, a, b));
+      HWY_ASSERT_VEC_EQ(d, IfThenElseZero(m, Max(a, b)), MaskedMax(m, a, b));
+    }
+  }
+};
+
+struct TestMaskedMul {
+  template <typename T, class D>
+  HWY_NOINLINE void operator()(T /*unused*/, D d) {
+    RandomState rng;
+
+    using TI = MakeSigned<T>;  // For mask > 0 comparison
+    const Rebind<TI, D> di;
+    const size_t N = Lanes(d);
+    auto bool_lanes = AllocateAligned<TI>(N);
+
+    const auto no = Set(d, T{7});
+    const auto a = Iota(d, T{3});
+    const auto b = Set(d, T{2});
+
+    for (size_t rep = 0; rep < 50; ++rep) {
+      for (size_t i = 0; i < N; ++i) {
+        bool_lanes[i] = (Random32(&rng) & 1024) ? TI(1) : TI(0);
+      }
+      const auto m = RebindMask(d, Gt(Load(di, bool_lanes.get()), Zero(di)));
+
+      HWY_ASSERT_VEC_EQ(d, IfThenElse(m, Mul(a, b), no),
+                        MaskedMulOr(no, m, a, b));
+      HWY_ASSERT_VEC_EQ(d, IfThenElseZero(m, Mul(a, b)), MaskedMul(m, a, b));
+    }
+  }
+};
+
+struct TestMaskedDiv {
+  template <typename T, class D>
+  HWY_NOINLINE void operator()(T /*unused*/, D d) {
+    RandomState rng;
+
+    using TI = MakeSigned<T>;  // For mask > 0 comparison
+    const Rebind<TI, D> di;
+    const size_t N = Lanes(d);
+    auto bool_lanes = AllocateAligned<TI>(N);
+
+    const auto no = Set(d, T(7));
+    const auto a = Iota(d, T(3));
+    const auto b = Set(d, T(0.5));
+
+    for (size_t rep = 0; rep < 50; ++rep) {
+      for (size_t i = 0; i < N; ++i) {
+        bool_lanes[i] = (Random32(&rng) & 1024) ? TI(1) : TI(0);
+      }
+      const auto m = RebindMask(d, Gt(Load(di, bool_lanes.get()), Zero(di)));
+
+      HWY_ASSERT_VEC_EQ(d, IfThenElse(m, Div(a, b), no),
+                        MaskedDivOr(no, m, a, b));
+      HWY_ASSERT_VEC_EQ(d, IfThenElseZero(m, Div(a, b)), MaskedDiv(m, a, b));
+    }
+  }
+};
+
+HWY_NOINLINE void TestAllMaskedArith() {
+  ForAllTypes(ForPartialVectors<TestMaskedArith>());
+
+  const ForPartialVectors<TestMaskedMul> test_mul;
+  test_mul(uint16_t());
+  test_mul(int16_t());
+  test_mul(uint32_t());
+  test_mul(int32_t());
+#if HWY_CAP_INTEGER64
+  test_mul(uint64_t());
+  test_mul(int64_t());
+#endif
+  ForFloatTypes(test_mul);
+
+  ForFloatTypes(ForPartialVectors<TestMaskedDiv>());
+}
+
 struct TestUnsignedMul {
   template <typename T, class D>
   HWY_NOINLINE void operator()(T /*unused*/, D d) {
@@ -628,9 +738,8 @@ struct TestUnsignedMul {
     HWY_ASSERT_VEC_EQ(d, vmax, Mul(vmax, v1));
     HWY_ASSERT_VEC_EQ(d, vmax, Mul(v1, vmax));
 
-    const size_t bits = sizeof(T) * 8;
-    const uint64_t mask = (1ull << bits) - 1;
-    const T max2 = (uint64_t(max) * max) & mask;
+    // Truncation to T is the same as masking the lower sizeof(T)*8 bits.
+    const T max2 = static_cast<T>(uint64_t(max) * max);
     HWY_ASSERT_VEC_EQ(d, Set(d, max2), Mul(vmax, vmax));
   }
 };
@@ -668,19 +777,20 @@ HWY_NOINLINE void TestAllMul() {
   // No u8.
   test_unsigned(uint16_t());
   test_unsigned(uint32_t());
-  // No u64.
+  test_unsigned(uint64_t());
 
   const ForPartialVectors<TestSignedMul> test_signed;
   // No i8.
   test_signed(int16_t());
   test_signed(int32_t());
-  // No i64.
+  test_signed(int64_t());
 }
 
 struct TestMulHigh {
   template <typename T, class D>
   HWY_NOINLINE void operator()(T /*unused*/, D d) {
     using Wide = MakeWide<T>;
+    constexpr size_t kBits = sizeof(T) * 8;
     const size_t N = Lanes(d);
     auto in_lanes = AllocateAligned<T>(N);
     auto expected_lanes = AllocateAligned<T>(N);
@@ -696,31 +806,154 @@ struct TestMulHigh {
     // Large positive squared
     for (size_t i = 0; i < N; ++i) {
       in_lanes[i] = T(LimitsMax<T>() >> i);
-      expected_lanes[i] = T((Wide(in_lanes[i]) * in_lanes[i]) >> 16);
+      expected_lanes[i] = T((Wide(in_lanes[i]) * in_lanes[i]) >> kBits);
     }
     auto v = Load(d, in_lanes.get());
     HWY_ASSERT_VEC_EQ(d, expected_lanes.get(), MulHigh(v, v));
 
     // Large positive * small positive
     for (size_t i = 0; i < N; ++i) {
-      expected_lanes[i] = T((Wide(in_lanes[i]) * T(1u + i)) >> 16);
+      expected_lanes[i] = T((Wide(in_lanes[i]) * T(1u + i)) >> kBits);
     }
     HWY_ASSERT_VEC_EQ(d, expected_lanes.get(), MulHigh(v, vi));
     HWY_ASSERT_VEC_EQ(d, expected_lanes.get(), MulHigh(vi, v));
 
     // Large positive * small negative
     for (size_t i = 0; i < N; ++i) {
-      expected_lanes[i] = T((Wide(in_lanes[i]) * T(i - N)) >> 16);
+      expected_lanes[i] = T((Wide(in_lanes[i]) * T(i - N)) >> kBits);
     }
     HWY_ASSERT_VEC_EQ(d, expected_lanes.get(), MulHigh(v, vni));
     HWY_ASSERT_VEC_EQ(d, expected_lanes.get(), MulHigh(vni, v));
   }
 };
 
+// Random 64-bit inputs; compares both halves of the product against Mul128.
+struct TestMulHigh64 {
+  template <typename T, class D>
+  HWY_NOINLINE void operator()(T /*unused*/, D d) {
+    using TU = MakeUnsigned<T>;
+    const size_t N = Lanes(d);
+    auto in1 = AllocateAligned<T>(N);
+    auto in2 = AllocateAligned<T>(N);
+    auto expected_lo = AllocateAligned<T>(N);
+    auto expected_hi = AllocateAligned<T>(N);
+
+    RandomState rng;
+    for (size_t rep = 0; rep < 1000; ++rep) {
+      for (size_t i = 0; i < N; ++i) {
+        in1[i] = static_cast<T>(Random64(&rng));
+        in2[i] = static_cast<T>(Random64(&rng));
+        // Multiply magnitudes, then negate the 128-bit product if the signs
+        // differ. Avoids relying on the identity used by the implementation.
+        const bool neg1 = IsSigned<T>() && in1[i] < 0;
+        const bool neg2 = IsSigned<T>() && in2[i] < 0;
+        const TU abs1 = neg1 ? TU(0) - TU(in1[i]) : TU(in1[i]);
+        const TU abs2 = neg2 ? TU(0) - TU(in2[i]) : TU(in2[i]);
+        uint64_t hi;
+        uint64_t lo = Mul128(abs1, abs2, &hi);
+        if (neg1 != neg2) {
+          lo = ~lo + 1;
+          hi = ~hi + (lo == 0 ? 1 : 0);
+        }
+        expected_lo[i] = static_cast<T>(lo);
+        expected_hi[i] = static_cast<T>(hi);
+      }
+
+      const auto a = Load(d, in1.get());
+      const auto b = Load(d, in2.get());
+      HWY_ASSERT_VEC_EQ(d, expected_lo.get(), Mul(a, b));
+      HWY_ASSERT_VEC_EQ(d, expected_hi.get(), MulHigh(a, b));
+    }
+  }
+};
+
 HWY_NOINLINE void TestAllMulHigh() {
   ForPartialVectors<TestMulHigh> test;
   test(int16_t());
   test(uint16_t());
+  test(int32_t());
+  test(uint32_t());
+
+  ForPartialVectors<TestMulHigh64> test64;
+  test64(int64_t());
+  test64(uint64_t());
+}
+
+struct TestMulFixedPoint15 {
+  template <typename T, class D>
+  HWY_NOINLINE void operator()(T /*unused*/, D d) {
+    const size_t N = Lanes(d);
+    auto in1 = AllocateAligned<T>(N);
+    auto in2 = AllocateAligned<T>(N);
+    auto expected = AllocateAligned<T>(N);
+
+    // Extremes; -32768 * -32768 is implementation-defined.
+    const auto vmin = Set(d, LimitsMin<T>());
+    const auto vmax = Set(d, LimitsMax<T>());
+    HWY_ASSERT_VEC_EQ(d, Set(d, T(-32767)), MulFixedPoint15(vmin, vmax));
+    HWY_ASSERT_VEC_EQ(d, Set(d, T(32766)), MulFixedPoint15(vmax, vmax));
+    HWY_ASSERT_VEC_EQ(d, Zero(d), MulFixedPoint15(vmax, Zero(d)));
+
+    RandomState rng;
+    for (size_t rep = 0; rep < 1000; ++rep) {
+      for (size_t i = 0; i < N; ++i) {
+        in1[i] = static_cast<T>(Random64(&rng));
+        in2[i] = static_cast<T>(Random64(&rng));
+        if (in1[i] == LimitsMin<T>() && in2[i] == LimitsMin<T>()) {
+          in2[i] = LimitsMax<T>();
+        }
+        const int32_t product = int32_t(in1[i]) * in2[i];
+        expected[i] = static_cast<T>((product + (1 << 14)) >> 15);
+      }
+
+      const auto a = Load(d, in1.get());
+      const auto b = Load(d, in2.get());
+      HWY_ASSERT_VEC_EQ(d, expected.get(), MulFixedPoint15(a, b));
+    }
+  }
+};
+
+HWY_NOINLINE void TestAllMulFixedPoint15() {
+  ForPartialVectors<TestMulFixedPoint15>()(int16_t());
+}
+
+struct TestMulHighRound {
+  template <typename T, class D>
+  HWY_NOINLINE void operator()(T /*unused*/, D d) {
+    using Wide = MakeWide<T>;
+    constexpr size_t kBits = sizeof(T) * 8;
+    const size_t N = Lanes(d);
+    auto in1 = AllocateAligned<T>(N);
+    auto in2 = AllocateAligned<T>(N);
+    auto expected = AllocateAligned<T>(N);
+
+    RandomState rng;
+    for (size_t rep = 0; rep < 1000; ++rep) {
+      for (size_t i = 0; i < N; ++i) {
+        in1[i] = static_cast<T>(Random64(&rng));
+        in2[i] = static_cast<T>(Random64(&rng));
+        // Every 4th lane: extremes.
+        if ((i & 3) == 0) in1[i] = (rep & 1) ? LimitsMin<T>() : LimitsMax<T>();
+        if ((i & 3) == 1) in2[i] = in1[i];
+        const Wide product = static_cast<Wide>(Wide(in1[i]) * in2[i]);
+        const Wide half = static_cast<Wide>(Wide(1) << (kBits - 1));
+        expected[i] = static_cast<T>((product + half) >> kBits);
+      }
+
+      const auto a = Load(d, in1.get());
+      const auto b = Load(d, in2.get());
+      HWY_ASSERT_VEC_EQ(d, expected.get(), MulHighRound(a, b));
+      HWY_ASSERT_VEC_EQ(d, expected.get(), MulHighRound(b, a));
+    }
+  }
+};
+
+HWY_NOINLINE void TestAllMulHighRound() {
+  ForPartialVectors<TestMulHighRound> test;
+  test(int16_t());
+  test(uint16_t());
+  test(int32_t());
+  test(uint32_t());
 }
 
 struct TestMulEven {
@@ -747,6 +980,35 @@ struct TestMulEven {
   }
 };
 
+struct TestMulOdd {
+  template <typename T, class D>
+  HWY_NOINLINE void operator()(T /*unused*/, D d) {
+#if HWY_TARGET != HWY_SCALAR
+    using Wide = MakeWide<T>;
+    const Repartition<Wide, D> d2;
+    const size_t N = Lanes(d);
+    if (N == 1) return;
+
+    const auto v0 = Zero(d);
+    HWY_ASSERT_VEC_EQ(d2, Zero(d2), MulOdd(v0, v0));
+
+    auto in_lanes = AllocateAligned<T>(N);
+    auto expected = AllocateAligned<Wide>(Lanes(d2));
+    const T extreme = IsSigned<T>() ? LimitsMin<T>() : LimitsMax<T>();
+    for (size_t i = 0; i < N; i += 2) {
+      in_lanes[i + 0] = 1;  // unused
+      in_lanes[i + 1] = static_cast<T>(extreme >> i);
+      expected[i / 2] = Wide(in_lanes[i + 1]) * in_lanes[i + 1];
+    }
+
+    const auto v = Load(d, in_lanes.get());
+    HWY_ASSERT_VEC_EQ(d2, expected.get(), MulOdd(v, v));
+#else
+    (void)d;
+#endif  // HWY_TARGET != HWY_SCALAR
+  }
+};
+
 struct TestMulEvenOdd64 {
   template <typename T, class D>
   HWY_NOINLINE void operator()(T /*unused*/, D d) {
@@ -792,6 +1054,10 @@ HWY_NOINLINE void TestAllMulEven() {
   test(int32_t());
   test(uint32_t());
 
+  ForExtendableVectors<TestMulOdd> test_odd;
+  test_odd(int32_t());
+  test_odd(uint32_t());
+
   ForGE128Vectors<TestMulEvenOdd64>()(uint64_t());
 }
 
@@ -1274,6 +1540,222 @@ HWY_NOINLINE void TestAllNeg() {
   ForFloatTypes(ForPartialVectors<TestNeg>());
 }
 
+struct TestSumsOf8 {
+  template <typename T, class D>
+  HWY_NOINLINE void operator()(T /*unused*/, D d) {
+    RandomState rng;
+    const size_t N = Lanes(d);
+    const Repartition<uint64_t, D> d64;
+    auto in_lanes = AllocateAligned<T>(N);
+    auto sum_lanes = AllocateAligned<uint64_t>(N / 8);
+
+    for (size_t rep = 0; rep < 100; ++rep) {
+      for (size_t i = 0; i < N; ++i) {
+        // Include the maximum to detect overflow.
+        in_lanes[i] = (rep == 0) ? T(255) : static_cast<T>(Random64(&rng));
+      }
+      for (size_t idx_sum = 0; idx_sum < N / 8; ++idx_sum) {
+        uint64_t sum = 0;
+        for (size_t i = 0; i < 8; ++i) {
+          sum += in_lanes[idx_sum * 8 + i];
+        }
+        sum_lanes[idx_sum] = sum;
+      }
+
+      const Vec<D> in = Load(d, in_lanes.get());
+      HWY_ASSERT_VEC_EQ(d64, sum_lanes.get(), SumsOf8(in));
+    }
+  }
+};
+
+HWY_NOINLINE void TestAllSumsOf8() {
+  ForGE64Vectors<TestSumsOf8>()(uint8_t());
+}
+
+struct TestSumsOfAbsDiff {
+  template <typename T, class D>
+  HWY_NOINLINE void operator()(T /*unused*/, D d) {
+    RandomState rng;
+    const size_t N = Lanes(d);
+    const Repartition<uint64_t, D> d64;
+    auto a_lanes = AllocateAligned<T>(N);
+    auto b_lanes = AllocateAligned<T>(N);
+    auto sum_lanes = AllocateAligned<uint64_t>(N / 8);
+
+    for (size_t rep = 0; rep < 100; ++rep) {
+      for (size_t i = 0; i < N; ++i) {
+        a_lanes[i] = static_cast<T>(Random64(&rng));
+        b_lanes[i] = (rep == 0) ? T(255 - a_lanes[i])
+                                : static_cast<T>(Random64(&rng));
+      }
+      for (size_t idx_sum = 0; idx_sum < N / 8; ++idx_sum) {
+        uint64_t sum = 0;
+        for (size_t i = 0; i < 8; ++i) {
+          const int a = a_lanes[idx_sum * 8 + i];
+          const int b = b_lanes[idx_sum * 8 + i];
+          sum += static_cast<uint64_t>(std::abs(a - b));
+        }
+        sum_lanes[idx_sum] = sum;
+      }
+
+      const Vec<D> a = Load(d, a_lanes.get());
+      const Vec<D> b = Load(d, b_lanes.get());
+      HWY_ASSERT_VEC_EQ(d64, sum_lanes.get(), SumsOfAbsDiff(a, b));
+      HWY_ASSERT_VEC_EQ(d64, sum_lanes.get(), SumsOfAbsDiff(b, a));
+    }
+  }
+};
+
+HWY_NOINLINE void TestAllSumsOfAbsDiff() {
+  ForGE64Vectors<TestSumsOfAbsDiff>()(uint8_t());
+}
+
+struct TestAddSub {
+  template <typename T, class D>
+  HWY_NOINLINE void operator()(T /*unused*/, D d) {
+    const size_t N = Lanes(d);
+    const auto a = Iota(d, 10);
+    const auto b = Iota(d, 2 * N + 1);
+    auto expected = AllocateAligned<T>(N);
+    for (size_t i = 0; i < N; ++i) {
+      const T ai = static_cast<T>(10 + i);
+      const T bi = static_cast<T>(2 * N + 1 + i);
+      expected[i] = (i & 1) ? ai + bi : ai - bi;
+    }
+    HWY_ASSERT_VEC_EQ(d, expected.get(), AddSub(a, b));
+  }
+};
+
+HWY_NOINLINE void TestAllAddSub() {
+  ForFloatTypes(ForShrinkableVectors<TestAddSub>());
+}
+
+template <typename T, class D>
+AlignedFreeUniquePtr<T[]> ClassifyTestCases(T /*unused*/, D d,
+                                            size_t& padded) {
+  const T test_cases[] = {
+      T(0),
+      -T(0),
+      T(1),
+      T(-1.5),
+      T(1E-30),
+      T(-3E30),
+      std::numeric_limits<T>::min(),
+      std::numeric_limits<T>::denorm_min(),
+      -std::numeric_limits<T>::denorm_min() * T(3),
+      std::numeric_limits<T>::max(),
+      std::numeric_limits<T>::lowest(),
+      std::numeric_limits<T>::infinity(),
+      -std::numeric_limits<T>::infinity(),
+      GetLane(NaN(d)),
+  };
+  const size_t kNumTestCases = sizeof(test_cases) / sizeof(test_cases[0]);
+  const size_t N = Lanes(d);
+  padded = RoundUpTo(kNumTestCases, N);  // allow loading whole vectors
+  auto in = AllocateAligned<T>(padded);
+  std::copy(test_cases, test_cases + kNumTestCases, in.get());
+  std::fill(in.get() + kNumTestCases, in.get() + padded, T(1));
+  return in;
+}
+
+struct TestFloatClassify {
+  template <typename T, class D>
+  HWY_NOINLINE void operator()(T t, D d) {
+    using TI = MakeSigned<T>;
+    const RebindToSigned<D> di;
+    size_t padded;
+    auto in = ClassifyTestCases(t, d, padded);
+    auto is_nan = AllocateAligned<TI>(padded);
+    auto is_inf = AllocateAligned<TI>(padded);
+    auto is_finite = AllocateAligned<TI>(padded);
+    for (size_t i = 0; i < padded; ++i) {
+      is_nan[i] = std::isnan(in[i]);
+      is_inf[i] = std::isinf(in[i]);
+      is_finite[i] = std::isfinite(in[i]);
+    }
+    const auto one = Set(di, 1);
+    for (size_t i = 0; i < padded; i += Lanes(d)) {
+      const auto v = Load(d, &in[i]);
+      HWY_ASSERT_MASK_EQ(d, RebindMask(d, Eq(Load(di, &is_nan[i]), one)),
+                         IsNaN(v));
+      HWY_ASSERT_MASK_EQ(d, RebindMask(d, Eq(Load(di, &is_inf[i]), one)),
+                         IsInf(v));
+      HWY_ASSERT_MASK_EQ(d, RebindMask(d, Eq(Load(di, &is_finite[i]), one)),
+                         IsFinite(v));
+    }
+  }
+};
+
+HWY_NOINLINE void TestAllFloatClassify() {
+  ForFloatTypes(ForPartialVectors<TestFloatClassify>());
+}
+
+struct TestGetExponent {
+  template <typename T, class D>
+  HWY_NOINLINE void operator()(T t, D d) {
+    size_t padded;
+    auto in = ClassifyTestCases(t, d, padded);
+    auto expected = AllocateAligned<T>(padded);
+    for (size_t i = 0; i < padded; ++i) {
+      // Results for zero, infinity and NaN are unspecified.
+      if (!std::isfinite(in[i]) || in[i] == T(0)) in[i] = T(1);
+      expected[i] = std::logb(in[i]);
+    }
+    for (size_t i = 0; i < padded; i += Lanes(d)) {
+      HWY_ASSERT_VEC_EQ(d, &expected[i], GetExponent(Load(d, &in[i])));
+    }
+  }
+};
+
+HWY_NOINLINE void TestAllGetExponent() {
+  ForFloatTypes(ForPartialVectors<TestGetExponent>());
+}
+
+struct TestLdExpFrexp {
+  template <typename T, class D>
+  HWY_NOINLINE void operator()(T t, D d) {
+    using TI = MakeSigned<T>;
+    const RebindToSigned<D> di;
+    const size_t N = Lanes(d);
+    size_t padded;
+    auto in = ClassifyTestCases(t, d, padded);
+    auto exp = AllocateAligned<TI>(padded);
+    auto expected = AllocateAligned<T>(padded);
+    auto mantissa = AllocateAligned<T>(padded);
+    auto expected_exp = AllocateAligned<TI>(padded);
+
+    // Exponents beyond the range of T must still saturate correctly.
+    const TI kExponents[] = {0, 1, -1, 7, -30, 127, -149, 300, -300, 2000};
+    for (TI e : kExponents) {
+      for (size_t i = 0; i < padded; ++i) {
+        exp[i] = static_cast<TI>(e + static_cast<TI>(i % 3));
+        expected[i] = std::ldexp(in[i], static_cast<int>(exp[i]));
+      }
+      for (size_t i = 0; i < padded; i += N) {
+        HWY_ASSERT_VEC_EQ(d, &expected[i],
+                          LdExp(Load(d, &in[i]), Load(di, &exp[i])));
+      }
+    }
+
+    for (size_t i = 0; i < padded; ++i) {
+      int e = 0;
+      mantissa[i] = std::frexp(in[i], &e);
+      // std::frexp leaves the exponent unspecified for infinity and NaN.
+      expected_exp[i] = std::isfinite(in[i]) ? static_cast<TI>(e) : 0;
+    }
+    for (size_t i = 0; i < padded; i += N) {
+      Vec<decltype(di)> actual_exp;
+      const auto actual = Frexp(Load(d, &in[i]), &actual_exp);
+      HWY_ASSERT_VEC_EQ(d, &mantissa[i], actual);
+      HWY_ASSERT_VEC_EQ(di, &expected_exp[i], actual_exp);
+    }
+  }
+};
+
+HWY_NOINLINE void TestAllLdExpFrexp() {
+  ForFloatTypes(ForPartialVectors<TestLdExpFrexp>());
+}
+
 // NOLINTNEXTLINE(google-readability-namespace-comments)
 }  // namespace HWY_NAMESPACE
 }  // namespace hwy
@@ -1288,10 +1770,13 @@ HWY_EXPORT_AND_TEST_P(HwyArithmeticTest, TestAllSaturatingArithmetic);
 HWY_EXPORT_AND_TEST_P(HwyArithmeticTest, TestAllShifts);
 HWY_EXPORT_AND_TEST_P(HwyArithmeticTest, TestAllVariableShifts);
 HWY_EXPORT_AND_TEST_P(HwyArithmeticTest, TestAllMinMax);
+HWY_EXPORT_AND_TEST_P(HwyArithmeticTest, TestAllMaskedArith);
 HWY_EXPORT_AND_TEST_P(HwyArithmeticTest, TestAllAverage);
 HWY_EXPORT_AND_TEST_P(HwyArithmeticTest, TestAllAbs);
 HWY_EXPORT_AND_TEST_P(HwyArithmeticTest, TestAllMul);
 HWY_EXPORT_AND_TEST_P(HwyArithmeticTest, TestAllMulHigh);
+HWY_EXPORT_AND_TEST_P(HwyArithmeticTest, TestAllMulFixedPoint15);
+HWY_EXPORT_AND_TEST_P(HwyArithmeticTest, TestAllMulHighRound);
 HWY_EXPORT_AND_TEST_P(HwyArithmeticTest, TestAllMulEven);
 HWY_EXPORT_AND_TEST_P(HwyArithmeticTest, TestAllMulAdd);
 HWY_EXPORT_AND_TEST_P(HwyArithmeticTest, TestAllDiv);
@@ -1307,6 +1792,12 @@ HWY_EXPORT_AND_TEST_P(HwyArithmeticTest, TestAllCeil);
 HWY_EXPORT_AND_TEST_P(HwyArithmeticTest, TestAllFloor);
 HWY_EXPORT_AND_TEST_P(HwyArithmeticTest, TestAllAbsDiff);
 HWY_EXPORT_AND_TEST_P(HwyArithmeticTest, TestAllNeg);
+HWY_EXPORT_AND_TEST_P(HwyArithmeticTest, TestAllSumsOf8);
+HWY_EXPORT_AND_TEST_P(HwyArithmeticTest, TestAllSumsOfAbsDiff);
+HWY_EXPORT_AND_TEST_P(HwyArithmeticTest, TestAllAddSub);
+HWY_EXPORT_AND_TEST_P(HwyArithmeticTest, TestAllFloatClassify);
+HWY_EXPORT_AND_TEST_P(HwyArithmeticTest, TestAllGetExponent);
+HWY_EXPORT_AND_TEST_P(HwyArithmeticTest, TestAllLdExpFrexp);
 }  // namespace hwy
 
 // Ought not to be necessary, but without this, no tests run on RVV.
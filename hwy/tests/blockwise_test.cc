@@ -273,6 +273,44 @@ HWY_NOINLINE void TestAllTableLookupBytes() {
 #endif
 }
 
+struct TestTableLookupBytes64 {
+  template <class T, class D>
+  HWY_NOINLINE void operator()(T /*unused*/, D d) {
+    RandomState rng;
+    const size_t N = Lanes(d);
+    T table[128];
+    for (size_t i = 0; i < 128; ++i) {
+      table[i] = static_cast<T>(Random32(&rng) & 0xFF);
+    }
+    auto indices = AllocateAligned<T>(N);
+    auto expected = AllocateAligned<T>(N);
+
+    for (size_t rep = 0; rep < 100; ++rep) {
+      for (size_t i = 0; i < N; ++i) {
+        const size_t index = Random32(&rng) & 63;
+        indices[i] = static_cast<T>(index);
+        expected[i] = table[index];
+      }
+      const auto idx = Load(d, indices.get());
+      HWY_ASSERT_VEC_EQ(d, expected.get(), TableLookupBytes64(d, table, idx));
+
+      for (size_t i = 0; i < N; ++i) {
+        const size_t index = Random32(&rng) & 127;
+        indices[i] = static_cast<T>(index);
+        expected[i] = table[index];
+      }
+      const auto idx128 = Load(d, indices.get());
+      HWY_ASSERT_VEC_EQ(d, expected.get(),
+                        TableLookupBytes128(d, table, idx128));
+    }
+  }
+};
+
+HWY_NOINLINE void TestAllTableLookupBytes64() {
+  ForPartialVectors<TestTableLookupBytes64>()(uint8_t());
+  ForPartialVectors<TestTableLookupBytes64>()(int8_t());
+}
+
 struct TestInterleaveLower {
   template <class T, class D>
   HWY_NOINLINE void operator()(T /*unused*/, D d) {
@@ -628,6 +666,75 @@ HWY_NOINLINE void TestAllSpecialShuffles() {
 #endif
 }
 
+struct TestPairwiseAdd {
+  template <class T, class D>
+  HWY_NOINLINE void operator()(T /*unused*/, D d) {
+    const size_t N = Lanes(d);
+    auto in_a = AllocateAligned<T>(N);
+    auto in_b = AllocateAligned<T>(N);
+    auto expected = AllocateAligned<T>(N);
+    // Small values so that integer sums do not overflow.
+    for (size_t i = 0; i < N; ++i) {
+      in_a[i] = static_cast<T>(i & 0x3F);
+      in_b[i] = static_cast<T>((3 * i + 1) & 0x3F);
+    }
+    for (size_t i = 0; i < N; i += 2) {
+      expected[i + 0] = static_cast<T>(in_a[i] + in_a[i + 1]);
+      expected[i + 1] = static_cast<T>(in_b[i] + in_b[i + 1]);
+    }
+    const auto a = Load(d, in_a.get());
+    const auto b = Load(d, in_b.get());
+    HWY_ASSERT_VEC_EQ(d, expected.get(), PairwiseAdd(d, a, b));
+  }
+};
+
+HWY_NOINLINE void TestAllPairwiseAdd() {
+  ForAllTypes(ForShrinkableVectors<TestPairwiseAdd>());
+}
+
+struct TestSumsOf2 {
+  template <class T, class D>
+  HWY_NOINLINE void operator()(T /*unused*/, D d) {
+    using TW = MakeWide<T>;
+    const RepartitionToWide<D> dw;
+    const size_t N = Lanes(d);
+    auto in = AllocateAligned<T>(N);
+    auto expected = AllocateAligned<TW>(N / 2);
+
+    RandomState rng;
+    for (size_t rep = 0; rep < 100; ++rep) {
+      for (size_t i = 0; i < N; ++i) {
+        // Up to 32 significant bits, hence f32 pair sums are exact in f64.
+        const int64_t bits = static_cast<int64_t>(Random64(&rng)) >> 32;
+        in[i] = static_cast<T>(bits);
+      }
+      for (size_t i = 0; i < N / 2; ++i) {
+        expected[i] = static_cast<TW>(static_cast<TW>(in[2 * i]) +
+                                      static_cast<TW>(in[2 * i + 1]));
+      }
+      HWY_ASSERT_VEC_EQ(dw, expected.get(), SumsOf2(Load(d, in.get())));
+    }
+  }
+};
+
+HWY_NOINLINE void TestAllSumsOf2() {
+  const ForShrinkableVectors<TestSumsOf2> test;
+  test(uint8_t());
+  test(int8_t());
+  test(uint16_t());
+  test(int16_t());
+
+#if HWY_CAP_INTEGER64
+  test(uint32_t());
+  test(int32_t());
+#endif
+
+  // RVV lacks fractional LMUL for the f64 result, and WASM lacks f64.
+#if HWY_CAP_FLOAT64 && HWY_TARGET != HWY_RVV
+  test(float());
+#endif
+}
+
 // NOLINTNEXTLINE(google-readability-namespace-comments)
 }  // namespace HWY_NAMESPACE
 }  // namespace hwy
@@ -641,10 +748,13 @@ HWY_EXPORT_AND_TEST_P(HwyBlockwiseTest, TestAllShiftBytes);
 HWY_EXPORT_AND_TEST_P(HwyBlockwiseTest, TestAllShiftLanes);
 HWY_EXPORT_AND_TEST_P(HwyBlockwiseTest, TestAllBroadcast);
 HWY_EXPORT_AND_TEST_P(HwyBlockwiseTest, TestAllTableLookupBytes);
+HWY_EXPORT_AND_TEST_P(HwyBlockwiseTest, TestAllTableLookupBytes64);
 HWY_EXPORT_AND_TEST_P(HwyBlockwiseTest, TestAllInterleave);
 HWY_EXPORT_AND_TEST_P(HwyBlockwiseTest, TestAllZip);
 HWY_EXPORT_AND_TEST_P(HwyBlockwiseTest, TestAllCombineShiftRight);
 HWY_EXPORT_AND_TEST_P(HwyBlockwiseTest, TestAllSpecialShuffles);
+HWY_EXPORT_AND_TEST_P(HwyBlockwiseTest, TestAllPairwiseAdd);
+HWY_EXPORT_AND_TEST_P(HwyBlockwiseTest, TestAllSumsOf2);
 }  // namespace hwy
 
 // Ought not to be necessary, but without this, no tests run on RVV.
@@ -101,6 +101,8 @@ struct TestStrictInt {
     HWY_ENSURE_GREATER(d, max, min);
     HWY_ENSURE_GREATER(d, 0, min);
     HWY_ENSURE_GREATER(d, min / 2, min);
+    // Sets the MSB of the lower half (for emulated 64-bit comparisons).
+    HWY_ENSURE_GREATER(d, static_cast<T>((max >> (sizeof(T) * 4)) + 1), 1);
 
     // Also use Iota to ensure lanes are independent
     HWY_ASSERT_MASK_EQ(d, mask_true, Gt(v2, vn));
@@ -187,6 +189,64 @@ HWY_NOINLINE void TestAllWeakFloat() {
   ForFloatTypes(ForPartialVectors<TestWeakFloat>());
 }
 
+// Returns whether the 128-bit key (hi, lo) a is less than b.
+bool Lt128Scalar(const uint64_t* a, const uint64_t* b) {
+  return (a[1] < b[1]) || (a[1] == b[1] && a[0] < b[0]);
+}
+
+struct TestKeys128 {
+  template <typename T, class D>
+  HWY_NOINLINE void operator()(T /*unused*/, D d) {
+#if HWY_TARGET != HWY_SCALAR && HWY_CAP_INTEGER64
+    RandomState rng;
+    const size_t N = Lanes(d);
+    auto in_a = AllocateAligned<T>(N);
+    auto in_b = AllocateAligned<T>(N);
+    auto lt = AllocateAligned<T>(N);
+    auto eq = AllocateAligned<T>(N);
+    auto min = AllocateAligned<T>(N);
+    auto max = AllocateAligned<T>(N);
+
+    for (size_t rep = 0; rep < 1000; ++rep) {
+      for (size_t i = 0; i < N; i += 2) {
+        // Small values make equal halves likely; also cover the sign bit.
+        const uint64_t bits = Random64(&rng);
+        const bool small = (bits & 1) != 0;
+        for (size_t j = 0; j < 2; ++j) {
+          const uint64_t ra = Random64(&rng);
+          const uint64_t rb = Random64(&rng);
+          in_a[i + j] = small ? (ra & 3) << (bits & 63) : ra;
+          in_b[i + j] = small ? (rb & 3) << (bits & 63) : rb;
+        }
+        const bool is_lt = Lt128Scalar(&in_a[i], &in_b[i]);
+        const bool is_gt = Lt128Scalar(&in_b[i], &in_a[i]);
+        const bool is_eq = !is_lt && !is_gt;
+        for (size_t j = 0; j < 2; ++j) {
+          lt[i + j] = is_lt ? ~T(0) : T(0);
+          eq[i + j] = is_eq ? ~T(0) : T(0);
+          min[i + j] = is_lt ? in_a[i + j] : in_b[i + j];
+          max[i + j] = is_gt ? in_a[i + j] : in_b[i + j];
+        }
+      }
+      const auto a = Load(d, in_a.get());
+      const auto b = Load(d, in_b.get());
+      HWY_ASSERT_MASK_EQ(d, MaskFromVec(Load(d, lt.get())), Lt128(d, a, b));
+      HWY_ASSERT_MASK_EQ(d, MaskFromVec(Load(d, eq.get())), Eq128(d, a, b));
+      HWY_ASSERT_MASK_EQ(d, MaskTrue(d), Eq128(d, a, a));
+      HWY_ASSERT_MASK_EQ(d, MaskFalse(d), Lt128(d, a, a));
+      HWY_ASSERT_VEC_EQ(d, min.get(), Min128(d, a, b));
+      HWY_ASSERT_VEC_EQ(d, max.get(), Max128(d, a, b));
+    }
+#else
+    (void)d;
+#endif
+  }
+};
+
+HWY_NOINLINE void TestAllKeys128() {
+  ForGE128Vectors<TestKeys128>()(uint64_t());
+}
+
 // NOLINTNEXTLINE(google-readability-namespace-comments)
 }  // namespace HWY_NAMESPACE
 }  // namespace hwy
@@ -200,6 +260,7 @@ HWY_EXPORT_AND_TEST_P(HwyCompareTest, TestAllEquality);
 HWY_EXPORT_AND_TEST_P(HwyCompareTest, TestAllStrictInt);
 HWY_EXPORT_AND_TEST_P(HwyCompareTest, TestAllStrictFloat);
 HWY_EXPORT_AND_TEST_P(HwyCompareTest, TestAllWeakFloat);
+HWY_EXPORT_AND_TEST_P(HwyCompareTest, TestAllKeys128);
 }  // namespace hwy
 
 // Ought not to be necessary, but without this, no tests run on RVV.
@@ -16,6 +16,8 @@
 #include <stdint.h>
 #include <string.h>
 
+#include <algorithm>  // std::sort
+
 #undef HWY_TARGET_INCLUDE
 #define HWY_TARGET_INCLUDE "tests/convert_test.cc"
 #include "hwy/foreach_target.h"
@@ -275,6 +277,49 @@ HWY_NOINLINE void TestAllDemoteToMixed() {
 #endif
 }
 
+template <typename ToT>
+struct TestDemote2To {
+  template <typename T, class D>
+  HWY_NOINLINE void operator()(T /*unused*/, D from_d) {
+    static_assert(sizeof(T) == 2 * sizeof(ToT), "Input must be twice as wide");
+    const Repartition<ToT, D> to_d;
+
+    const size_t N = Lanes(from_d);
+    auto from = AllocateAligned<T>(2 * N);
+    auto expected = AllocateAligned<ToT>(2 * N);
+    auto actual = AllocateAligned<ToT>(2 * N);
+
+    const T min = LimitsMin<ToT>();
+    const T max = LimitsMax<ToT>();
+
+    RandomState rng;
+    for (size_t rep = 0; rep < 1000; ++rep) {
+      for (size_t i = 0; i < 2 * N; ++i) {
+        const uint64_t bits = rng();
+        memcpy(&from[i], &bits, sizeof(T));
+        expected[i] = static_cast<ToT>(HWY_MIN(HWY_MAX(min, from[i]), max));
+      }
+
+      const auto a = Load(from_d, from.get());
+      const auto b = Load(from_d, from.get() + N);
+      HWY_ASSERT_VEC_EQ(to_d, expected.get(), OrderedDemote2To(to_d, a, b));
+
+      // Lane order is unspecified, so compare the sorted lanes.
+      Store(ReorderDemote2To(to_d, a, b), to_d, actual.get());
+      std::sort(expected.get(), expected.get() + 2 * N);
+      std::sort(actual.get(), actual.get() + 2 * N);
+      HWY_ASSERT_VEC_EQ(to_d, expected.get(), Load(to_d, actual.get()));
+    }
+  }
+};
+
+HWY_NOINLINE void TestAllDemote2To() {
+  ForPartialVectors<TestDemote2To<uint8_t>>()(int16_t());
+  ForPartialVectors<TestDemote2To<int8_t>>()(int16_t());
+  ForPartialVectors<TestDemote2To<uint16_t>>()(int32_t());
+  ForPartialVectors<TestDemote2To<int16_t>>()(int32_t());
+}
+
 template <typename ToT>
 struct TestDemoteToFloat {
   template <typename T, class D>
@@ -613,6 +658,7 @@ HWY_EXPORT_AND_TEST_P(HwyConvertTest, TestAllBitCast);
 HWY_EXPORT_AND_TEST_P(HwyConvertTest, TestAllPromoteTo);
 HWY_EXPORT_AND_TEST_P(HwyConvertTest, TestAllDemoteToInt);
 HWY_EXPORT_AND_TEST_P(HwyConvertTest, TestAllDemoteToMixed);
+HWY_EXPORT_AND_TEST_P(HwyConvertTest, TestAllDemote2To);
 HWY_EXPORT_AND_TEST_P(HwyConvertTest, TestAllDemoteToFloat);
 HWY_EXPORT_AND_TEST_P(HwyConvertTest, TestAllF16);
 HWY_EXPORT_AND_TEST_P(HwyConvertTest, TestAllConvertU8);
@@ -257,6 +257,155 @@ HWY_NOINLINE void TestAllPopulationCount() {
   ForUnsignedTypes(ForPartialVectors<TestPopulationCount>());
 }
 
+struct TestLeadingZeroCount {
+  template <class T, class D>
+  HWY_NOINLINE void operator()(T /*unused*/, D d) {
+    using TU = MakeUnsigned<T>;
+    constexpr size_t kBits = sizeof(T) * 8;
+    RandomState rng;
+    const size_t N = Lanes(d);
+    auto data = AllocateAligned<T>(N);
+    auto expected = AllocateAligned<T>(N);
+    for (size_t rep = 0; rep < 1000; ++rep) {
+      for (size_t i = 0; i < N; ++i) {
+        // Shift by a random amount so that all counts are covered.
+        const TU bits = static_cast<TU>(rng());
+        const TU u = static_cast<TU>(bits >> (rng() % kBits));
+        data[i] = static_cast<T>((rep == 0 && i == 0) ? 0 : u);
+        size_t count = 0;
+        for (TU mask = static_cast<TU>(TU(1) << (kBits - 1));
+             mask != 0 && (static_cast<TU>(data[i]) & mask) == 0;
+             mask = static_cast<TU>(mask >> 1)) {
+          ++count;
+        }
+        expected[i] = static_cast<T>(count);
+      }
+      HWY_ASSERT_VEC_EQ(d, expected.get(),
+                        LeadingZeroCount(Load(d, data.get())));
+    }
+  }
+};
+
+HWY_NOINLINE void TestAllLeadingZeroCount() {
+  ForIntegerTypes(ForPartialVectors<TestLeadingZeroCount>());
+}
+
+struct TestTrailingZeroCount {
+  template <class T, class D>
+  HWY_NOINLINE void operator()(T /*unused*/, D d) {
+    using TU = MakeUnsigned<T>;
+    constexpr size_t kBits = sizeof(T) * 8;
+    RandomState rng;
+    const size_t N = Lanes(d);
+    auto data = AllocateAligned<T>(N);
+    auto expected = AllocateAligned<T>(N);
+    for (size_t rep = 0; rep < 1000; ++rep) {
+      for (size_t i = 0; i < N; ++i) {
+        const TU bits = static_cast<TU>(rng());
+        const TU u = static_cast<TU>(bits << (rng() % kBits));
+        data[i] = static_cast<T>((rep == 0 && i == 0) ? 0 : u);
+        size_t count = 0;
+        for (TU mask = 1;
+             mask != 0 && (static_cast<TU>(data[i]) & mask) == 0;
+             mask = static_cast<TU>(mask << 1)) {
+          ++count;
+        }
+        expected[i] = static_cast<T>(count);
+      }
+      HWY_ASSERT_VEC_EQ(d, expected.get(),
+                        TrailingZeroCount(Load(d, data.get())));
+    }
+  }
+};
+
+HWY_NOINLINE void TestAllTrailingZeroCount() {
+  ForIntegerTypes(ForPartialVectors<TestTrailingZeroCount>());
+}
+
+struct TestReverseBits {
+  template <class T, class D>
+  HWY_NOINLINE void operator()(T /*unused*/, D d) {
+    using TU = MakeUnsigned<T>;
+    constexpr size_t kBits = sizeof(T) * 8;
+    RandomState rng;
+    const size_t N = Lanes(d);
+    auto data = AllocateAligned<T>(N);
+    auto expected = AllocateAligned<T>(N);
+    for (size_t rep = 0; rep < 1000; ++rep) {
+      for (size_t i = 0; i < N; ++i) {
+        const TU u = static_cast<TU>(rng());
+        TU reversed = 0;
+        for (size_t bit = 0; bit < kBits; ++bit) {
+          if (u & static_cast<TU>(TU(1) << bit)) {
+            reversed = static_cast<TU>(reversed | (TU(1) << (kBits - 1 - bit)));
+          }
+        }
+        data[i] = static_cast<T>(u);
+        expected[i] = static_cast<T>(reversed);
+      }
+      HWY_ASSERT_VEC_EQ(d, expected.get(), ReverseBits(Load(d, data.get())));
+    }
+  }
+};
+
+HWY_NOINLINE void TestAllReverseBits() {
+  ForIntegerTypes(ForPartialVectors<TestReverseBits>());
+}
+
+struct TestRotate {
+  template <int kBits, class T, class D>
+  static void Check(D d, const T* HWY_RESTRICT data,
+                    T* HWY_RESTRICT expected) {
+    using TU = MakeUnsigned<T>;
+    constexpr int kSizeInBits = static_cast<int>(sizeof(T) * 8);
+    const size_t N = Lanes(d);
+    const auto v = Load(d, data);
+
+    for (size_t i = 0; i < N; ++i) {
+      const TU u = static_cast<TU>(data[i]);
+      expected[i] = static_cast<T>(
+          kBits == 0 ? u
+                     : static_cast<TU>((u >> kBits) |
+                                       (u << ((kSizeInBits - kBits) &
+                                              (kSizeInBits - 1)))));
+    }
+    HWY_ASSERT_VEC_EQ(d, expected, RotateRight<kBits>(v));
+
+    for (size_t i = 0; i < N; ++i) {
+      const TU u = static_cast<TU>(data[i]);
+      expected[i] = static_cast<T>(
+          kBits == 0 ? u
+                     : static_cast<TU>((u << kBits) |
+                                       (u >> ((kSizeInBits - kBits) &
+                                              (kSizeInBits - 1)))));
+    }
+    HWY_ASSERT_VEC_EQ(d, expected, RotateLeft<kBits>(v));
+  }
+
+  template <class T, class D>
+  HWY_NOINLINE void operator()(T /*unused*/, D d) {
+    constexpr int kSizeInBits = static_cast<int>(sizeof(T) * 8);
+    RandomState rng;
+    const size_t N = Lanes(d);
+    auto data = AllocateAligned<T>(N);
+    auto expected = AllocateAligned<T>(N);
+    for (size_t rep = 0; rep < 100; ++rep) {
+      for (size_t i = 0; i < N; ++i) {
+        data[i] = static_cast<T>(rng());
+      }
+      Check<0>(d, data.get(), expected.get());
+      Check<1>(d, data.get(), expected.get());
+      Check<3>(d, data.get(), expected.get());
+      Check<kSizeInBits / 2>(d, data.get(), expected.get());
+      Check<kSizeInBits - 1>(d, data.get(), expected.get());
+    }
+  }
+};
+
+HWY_NOINLINE void TestAllRotate() {
+  ForIntegerTypes(ForPartialVectors<TestRotate>());
+}
+
 // NOLINTNEXTLINE(google-readability-namespace-comments)
 }  // namespace HWY_NAMESPACE
 }  // namespace hwy
@@ -273,6 +422,10 @@ HWY_EXPORT_AND_TEST_P(HwyLogicalTest, TestAllZeroIfNegative);
 HWY_EXPORT_AND_TEST_P(HwyLogicalTest, TestAllBroadcastSignBit);
 HWY_EXPORT_AND_TEST_P(HwyLogicalTest, TestAllTestBit);
 HWY_EXPORT_AND_TEST_P(HwyLogicalTest, TestAllPopulationCount);
+HWY_EXPORT_AND_TEST_P(HwyLogicalTest, TestAllLeadingZeroCount);
+HWY_EXPORT_AND_TEST_P(HwyLogicalTest, TestAllTrailingZeroCount);
+HWY_EXPORT_AND_TEST_P(HwyLogicalTest, TestAllReverseBits);
+HWY_EXPORT_AND_TEST_P(HwyLogicalTest, TestAllRotate);
 }  // namespace hwy
 
 // Ought not to be necessary, but without this, no tests run on RVV.
@@ -263,7 +263,9 @@ struct TestScatter {
     using Offset = MakeSigned<T>;
 
     const size_t N = Lanes(d);
-    const size_t range = 4 * N;                  // number of items to scatter
+    // Number of items to scatter; byte offsets must be representable.
+    const size_t range = HWY_MIN(
+        4 * N, static_cast<size_t>(LimitsMax<Offset>()) / sizeof(T) + 1);
     const size_t max_bytes = range * sizeof(T);  // upper bound on offset
 
     RandomState rng;
@@ -321,17 +323,7 @@ struct TestScatter {
 };
 
 HWY_NOINLINE void TestAllScatter() {
-  // No u8,u16,i8,i16.
-  const ForPartialVectors<TestScatter> test;
-  test(uint32_t());
-  test(int32_t());
-
-#if HWY_CAP_INTEGER64
-  test(uint64_t());
-  test(int64_t());
-#endif
-
-  ForFloatTypes(test);
+  ForAllTypes(ForPartialVectors<TestScatter>());
 }
 
 struct TestGather {
@@ -340,7 +332,9 @@ struct TestGather {
     using Offset = MakeSigned<T>;
 
     const size_t N = Lanes(d);
-    const size_t range = 4 * N;                  // number of items to gather
+    // Number of items to gather; byte offsets must be representable.
+    const size_t range = HWY_MIN(
+        4 * N, static_cast<size_t>(LimitsMax<Offset>()) / sizeof(T) + 1);
     const size_t max_bytes = range * sizeof(T);  // upper bound on offset
 
     RandomState rng;
@@ -381,16 +375,97 @@ struct TestGather {
 };
 
 HWY_NOINLINE void TestAllGather() {
-  // No u8,u16,i8,i16.
-  const ForPartialVectors<TestGather> test;
-  test(uint32_t());
-  test(int32_t());
+  ForAllTypes(ForPartialVectors<TestGather>());
+}
 
-#if HWY_CAP_INTEGER64
-  test(uint64_t());
-  test(int64_t());
-#endif
-  ForFloatTypes(test);
+// 8-bit indices are unsigned, so all entries of a 256-byte table are reachable.
+struct TestGatherByteTable {
+  template <class T, class D>
+  HWY_NOINLINE void operator()(T /*unused*/, D d) {
+    using TI = MakeSigned<T>;
+    const Rebind<TI, D> di;
+    const size_t N = Lanes(d);
+
+    RandomState rng;
+    auto table = AllocateAligned<T>(256);
+    for (size_t i = 0; i < 256; ++i) {
+      table[i] = static_cast<T>(Random32(&rng) & 0xFF);
+    }
+
+    auto expected = AllocateAligned<T>(N);
+    auto indices = AllocateAligned<TI>(N);
+    auto mask_lanes = AllocateAligned<TI>(N);
+    for (size_t rep = 0; rep < 100; ++rep) {
+      for (size_t i = 0; i < N; ++i) {
+        // Favor the upper half, which negative index lanes would miss.
+        const uint8_t idx = static_cast<uint8_t>(Random32(&rng) | 0x80);
+        CopyBytes<1>(&idx, &indices[i]);
+        expected[i] = table[idx];
+        mask_lanes[i] = static_cast<TI>(i & 1);
+      }
+      const auto vindices = Load(di, indices.get());
+      HWY_ASSERT_VEC_EQ(d, expected.get(),
+                        GatherIndex(d, table.get(), vindices));
+      HWY_ASSERT_VEC_EQ(d, expected.get(),
+                        GatherOffset(d, table.get(), vindices));
+
+      const auto mask = RebindMask(d, Gt(Load(di, mask_lanes.get()), Zero(di)));
+      for (size_t i = 0; i < N; ++i) {
+        if (!mask_lanes[i]) expected[i] = T(0);
+      }
+      HWY_ASSERT_VEC_EQ(d, expected.get(),
+                        MaskedGatherIndex(mask, d, table.get(), vindices));
+    }
+  }
+};
+
+HWY_NOINLINE void TestAllGatherByteTable() {
+  ForPartialVectors<TestGatherByteTable>()(uint8_t());
+  ForPartialVectors<TestGatherByteTable>()(int8_t());
+}
+
+struct TestMaskedGather {
+  template <class T, class D>
+  HWY_NOINLINE void operator()(T /*unused*/, D d) {
+    using TI = MakeSigned<T>;
+    const Rebind<TI, D> di;
+    const size_t N = Lanes(d);
+    const size_t range = HWY_MIN(4 * N, static_cast<size_t>(LimitsMax<TI>()));
+
+    RandomState rng;
+
+    auto values = AllocateAligned<T>(range);
+    for (size_t i = 0; i < range; ++i) {
+      values[i] = static_cast<T>(Random32(&rng) & 0x7F);
+    }
+
+    auto expected = AllocateAligned<T>(N);
+    auto indices = AllocateAligned<TI>(N);
+    auto bool_lanes = AllocateAligned<TI>(N);
+
+    for (size_t rep = 0; rep < 100; ++rep) {
+      for (size_t i = 0; i < N; ++i) {
+        bool_lanes[i] = (Random32(&rng) & 1024) ? TI(1) : TI(0);
+        if (bool_lanes[i]) {
+          indices[i] = static_cast<TI>(Random32(&rng) % range);
+          expected[i] = values[size_t(indices[i])];
+        } else {
+          // Out of bounds: must not be accessed.
+          indices[i] = LimitsMax<TI>();
+          expected[i] = T(0);
+        }
+      }
+
+      const auto mask = RebindMask(d, Gt(Load(di, bool_lanes.get()), Zero(di)));
+      const auto actual =
+          MaskedGatherIndex(mask, d, values.get(), Load(di, indices.get()));
+      HWY_ASSERT_VEC_EQ(d, expected.get(), actual);
+    }
+  }
+};
+
+HWY_NOINLINE void TestAllMaskedGather() {
+  ForAllTypes(ForPartialVectors<TestMaskedGather>());
 }
 
 HWY_NOINLINE void TestAllCache() {
@@ -418,6 +493,8 @@ HWY_EXPORT_AND_TEST_P(HwyMemoryTest, TestAllLoadDup128);
 HWY_EXPORT_AND_TEST_P(HwyMemoryTest, TestAllStream);
 HWY_EXPORT_AND_TEST_P(HwyMemoryTest, TestAllScatter);
 HWY_EXPORT_AND_TEST_P(HwyMemoryTest, TestAllGather);
+HWY_EXPORT_AND_TEST_P(HwyMemoryTest, TestAllGatherByteTable);
+HWY_EXPORT_AND_TEST_P(HwyMemoryTest, TestAllMaskedGather);
 HWY_EXPORT_AND_TEST_P(HwyMemoryTest, TestAllCache);
 }  // namespace hwy
 
@@ -61,6 +61,36 @@ HWY_NOINLINE void TestAllOddEven() {
   ForAllTypes(ForShrinkableVectors<TestOddEven>());
 }
 
+struct TestDupEvenOdd {
+  template <class T, class D>
+  HWY_NOINLINE void operator()(T /*unused*/, D d) {
+    const size_t N = Lanes(d);
+    const auto v = Iota(d, 1);
+    auto expected_even = AllocateAligned<T>(N);
+    auto expected_odd = AllocateAligned<T>(N);
+    for (size_t i = 0; i < N; ++i) {
+      expected_even[i] = static_cast<T>(1 + (i & ~size_t{1}));
+      expected_odd[i] = static_cast<T>(1 + (i | 1));
+    }
+    HWY_ASSERT_VEC_EQ(d, expected_even.get(), DupEven(v));
+    HWY_ASSERT_VEC_EQ(d, expected_odd.get(), DupOdd(v));
+  }
+};
+
+HWY_NOINLINE void TestAllDupEvenOdd() {
+  const ForShrinkableVectors<TestDupEvenOdd> test;
+  test(uint32_t());
+  test(int32_t());
+  test(float());
+#if HWY_CAP_INTEGER64
+  test(uint64_t());
+  test(int64_t());
+#endif
+#if HWY_CAP_FLOAT64
+  test(double());
+#endif
+}
+
 struct TestTableLookupLanes {
 #if HWY_TARGET == HWY_RVV
   using Index = uint32_t;
@@ -131,6 +161,100 @@ HWY_NOINLINE void TestAllTableLookupLanes() {
   test(float());
 }
 
+struct TestReverse {
+  template <class T, class D>
+  HWY_NOINLINE void operator()(T /*unused*/, D d) {
+    const size_t N = Lanes(d);
+    const auto v = Iota(d, 1);
+    auto expected = AllocateAligned<T>(N);
+    for (size_t i = 0; i < N; ++i) {
+      expected[i] = static_cast<T>(N - i);  // == v[N - 1 - i]
+    }
+    HWY_ASSERT_VEC_EQ(d, expected.get(), Reverse(d, v));
+  }
+};
+
+HWY_NOINLINE void TestAllReverse() {
+  ForAllTypes(ForPartialVectors<TestReverse>());
+}
+
+// Calls Reverse2/4/8 depending on the tag.
+template <class D, class V>
+HWY_INLINE V ReverseGroups(hwy::SizeTag<2> /* tag */, D d, V v) {
+  return Reverse2(d, v);
+}
+template <class D, class V>
+HWY_INLINE V ReverseGroups(hwy::SizeTag<4> /* tag */, D d, V v) {
+  return Reverse4(d, v);
+}
+template <class D, class V>
+HWY_INLINE V ReverseGroups(hwy::SizeTag<8> /* tag */, D d, V v) {
+  return Reverse8(d, v);
+}
+
+template <size_t kGroup>
+struct TestReverseGroups {
+  template <class T, class D>
+  HWY_NOINLINE void operator()(T /*unused*/, D d) {
+    const size_t N = Lanes(d);
+    const auto v = Iota(d, 1);
+    auto expected = AllocateAligned<T>(N);
+    for (size_t i = 0; i < N; ++i) {
+      const size_t mirrored = i - i % kGroup + kGroup - 1 - i % kGroup;
+      expected[i] = static_cast<T>(mirrored + 1);  // == v[mirrored]
+    }
+    HWY_ASSERT_VEC_EQ(d, expected.get(),
+                      ReverseGroups(hwy::SizeTag<kGroup>(), d, v));
+  }
+};
+
+HWY_NOINLINE void TestAllReverse2() {
+  ForAllTypes(ForShrinkableVectors<TestReverseGroups<2>, 2>());
+}
+
+// Groups must not exceed 16 bytes.
+HWY_NOINLINE void TestAllReverse4() {
+  const ForShrinkableVectors<TestReverseGroups<4>, 4> test;
+  test(uint8_t());
+  test(int8_t());
+  test(uint16_t());
+  test(int16_t());
+  test(uint32_t());
+  test(int32_t());
+  test(float());
+}
+
+HWY_NOINLINE void TestAllReverse8() {
+  const ForShrinkableVectors<TestReverseGroups<8>, 8> test;
+  test(uint8_t());
+  test(int8_t());
+  test(uint16_t());
+  test(int16_t());
+}
+
+struct TestReverseBlocks {
+  template <class T, class D>
+  HWY_NOINLINE void operator()(T /*unused*/, D d) {
+    const size_t N = Lanes(d);
+    const auto v = Iota(d, 1);
+    auto expected = AllocateAligned<T>(N);
+    // Partial vectors are a single block and remain unchanged.
+    const size_t lanes_per_block = HWY_MIN(N, 16 / sizeof(T));
+    const size_t num_blocks = N / lanes_per_block;
+    for (size_t i = 0; i < N; ++i) {
+      const size_t block = i / lanes_per_block;
+      const size_t lane = i % lanes_per_block;
+      const size_t src = (num_blocks - 1 - block) * lanes_per_block + lane;
+      expected[i] = static_cast<T>(src + 1);  // == v[src]
+    }
+    HWY_ASSERT_VEC_EQ(d, expected.get(), ReverseBlocks(d, v));
+  }
+};
+
+HWY_NOINLINE void TestAllReverseBlocks() {
+  ForAllTypes(ForPartialVectors<TestReverseBlocks>());
+}
+
 class TestCompress {
   template <typename T, typename TI, size_t N>
   void CheckStored(Simd<T, N> d, Simd<TI, N> di, size_t expected_pos,
@@ -405,7 +529,13 @@ namespace hwy {
 HWY_BEFORE_TEST(HwySwizzleTest);
 HWY_EXPORT_AND_TEST_P(HwySwizzleTest, TestAllGetLane);
 HWY_EXPORT_AND_TEST_P(HwySwizzleTest, TestAllOddEven);
+HWY_EXPORT_AND_TEST_P(HwySwizzleTest, TestAllDupEvenOdd);
 HWY_EXPORT_AND_TEST_P(HwySwizzleTest, TestAllTableLookupLanes);
+HWY_EXPORT_AND_TEST_P(HwySwizzleTest, TestAllReverse);
+HWY_EXPORT_AND_TEST_P(HwySwizzleTest, TestAllReverse2);
+HWY_EXPORT_AND_TEST_P(HwySwizzleTest, TestAllReverse4);
+HWY_EXPORT_AND_TEST_P(HwySwizzleTest, TestAllReverse8);
+HWY_EXPORT_AND_TEST_P(HwySwizzleTest, TestAllReverseBlocks);
 HWY_EXPORT_AND_TEST_P(HwySwizzleTest, TestAllCompress);
 }  // namespace hwy
 